@@ -1743,6 +1743,34 @@ declare global {
         getAllEntitiesOnTile(type: "money_effect", tilePos: CoordsXY): MoneyEffect[];
         createEntity(type: EntityType, initializer: object): Entity;
 
+        /**
+         * Reads the given fields for every tile element within the given range of
+         * tile coordinates (inclusive) in a single native pass, without creating a
+         * {@link Tile} or {@link TileElement} object per element. The result is a flat
+         * array of numbers with one group of `fields.length` values per element,
+         * in y-then-x tile order. Intended for analytics plugins that scan large
+         * areas of the map.
+         *
+         * Supported fields: "x", "y", "index", "type" (numeric index into the
+         * {@link TileElementType} values in declaration order), "baseHeight",
+         * "baseZ", "clearanceHeight", "clearanceZ", "direction",
+         * "occupiedQuadrants", "isGhost", "isHidden" and "owner". Booleans are
+         * returned as 0 or 1.
+         */
+        getTilesData(range: MapRange, fields: string[]): number[];
+
+        /**
+         * Reads the given fields for every entity of the given type in a single
+         * native pass, without creating an {@link Entity} object per entity. The
+         * result is a flat array of numbers with one group of `fields.length`
+         * values per entity, in id order.
+         *
+         * Supported fields for all types: "id", "x", "y" and "z". Guests
+         * additionally support "energy", "happiness", "hunger", "thirst",
+         * "nausea", "toilet" and "cash"; staff additionally support "staffType".
+         */
+        getAllEntitiesData(type: EntityType, fields: string[]): number[];
+
         /**
          * Gets a {@link TrackIterator} for the given track element. This can be used to
          * iterate through a ride's circuit, segment by segment.
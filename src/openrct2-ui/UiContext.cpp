@@ -395,6 +395,9 @@ public:
                     }
                     break;
                 case SDL_MOUSEMOTION:
+                    // Only the latest position is kept; hit testing and window
+                    // invalidation read it once per frame, so a high polling
+                    // rate mouse just overwrites this a few extra times.
                     _cursorState.position = { static_cast<int32_t>(e.motion.x / Config::Get().general.windowScale),
                                               static_cast<int32_t>(e.motion.y / Config::Get().general.windowScale) };
                     break;
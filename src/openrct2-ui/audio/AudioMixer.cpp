@@ -54,6 +54,11 @@ void AudioMixer::Close()
     _channels.clear();
     Unlock();
 
+    {
+        std::lock_guard<std::mutex> guard(_pendingChannelsMutex);
+        _pendingChannels.clear();
+    }
+
     SDL_CloseAudioDevice(_deviceId);
 
     // Free buffers
@@ -75,17 +80,26 @@ void AudioMixer::Unlock()
     SDL_UnlockAudioDevice(_deviceId);
 }
 
-std::shared_ptr<IAudioChannel> AudioMixer::Play(IAudioSource* source, int32_t loop, bool deleteondone)
+std::shared_ptr<IAudioChannel> AudioMixer::Play(
+    IAudioSource* source, int32_t loop, bool deleteondone, MixerGroup group, int32_t volume, float pan, double rate)
 {
-    Lock();
     auto channel = std::shared_ptr<ISDLAudioChannel>(AudioChannel::Create());
     if (channel != nullptr)
     {
         channel->Play(source, loop);
         channel->SetDeleteOnDone(deleteondone);
-        _channels.push_back(channel);
+        channel->SetGroup(group);
+        channel->SetVolume(volume);
+        channel->SetPan(pan);
+        channel->SetRate(rate);
+        channel->UpdateOldVolume();
+
+        // Hand the fully configured channel over to the mixer thread. Taking
+        // the device lock here instead would block until the audio callback
+        // finished its current chunk, stalling the game tick.
+        std::lock_guard<std::mutex> guard(_pendingChannelsMutex);
+        _pendingChannels.push_back(channel);
     }
-    Unlock();
     return channel;
 }
 
@@ -126,6 +140,13 @@ const AudioFormat& AudioMixer::GetFormat() const
 
 void AudioMixer::GetNextAudioChunk(uint8_t* dst, size_t length)
 {
+    // Adopt channels queued by Play, holding the lock only for the splice.
+    {
+        std::lock_guard<std::mutex> guard(_pendingChannelsMutex);
+        _channels.insert(_channels.end(), _pendingChannels.begin(), _pendingChannels.end());
+        _pendingChannels.clear();
+    }
+
     UpdateAdjustedSound();
 
     // Zero the output buffer
@@ -171,6 +192,12 @@ void AudioMixer::UpdateAdjustedSound()
     }
 }
 
+// Samples are already converted to the device format once at load
+// (SDLAudioSource::ToMemory when the source is created), so the format
+// conversion branch below only triggers for streamed music that is not
+// resident. The speex resample that remains per playback is the dynamic
+// pitch shift — the channel rate follows live state such as vehicle speed —
+// which is unknowable at load time and cannot be precomputed per sample.
 void AudioMixer::MixChannel(ISDLAudioChannel* channel, uint8_t* data, size_t length)
 {
     int32_t outputByteRate = _outputFormat.GetByteRate();
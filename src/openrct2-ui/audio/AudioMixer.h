@@ -47,13 +47,21 @@ namespace OpenRCT2::Audio
 
         std::mutex _mutex;
 
+        // Channels queued by Play that the mixer thread has not adopted yet.
+        // Guarded by _pendingChannelsMutex, which is only held for the push
+        // and the swap so Play never waits on a chunk being mixed.
+        std::vector<std::shared_ptr<ISDLAudioChannel>> _pendingChannels;
+        std::mutex _pendingChannelsMutex;
+
     public:
         ~AudioMixer() override;
         void Init(const char* device) override;
         void Close() override;
         void Lock() override;
         void Unlock() override;
-        std::shared_ptr<IAudioChannel> Play(IAudioSource* source, int32_t loop, bool deleteondone) override;
+        std::shared_ptr<IAudioChannel> Play(
+            IAudioSource* source, int32_t loop, bool deleteondone, MixerGroup group, int32_t volume, float pan,
+            double rate) override;
         void SetVolume(float volume) override;
         SDLAudioSource* AddSource(std::unique_ptr<SDLAudioSource> source);
 
@@ -272,6 +272,11 @@ private:
         SDL_RenderPresent(_sdlRenderer);
     }
 
+    // Palette application has to stay on the CPU in this engine: SDL's
+    // renderer API exposes no custom shader stage, so the best it can do is
+    // scale an already-converted texture. Moving the palette lookup onto the
+    // GPU is what the OpenGL engine's ApplyPaletteShader does; systems that
+    // need that should use that engine rather than growing a second one here.
     void CopyBitsToTexture(SDL_Texture* texture, uint8_t* src, int32_t width, int32_t height, const uint32_t* palette)
     {
         void* pixels;
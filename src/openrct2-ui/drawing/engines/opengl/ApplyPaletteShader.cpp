@@ -80,6 +80,13 @@ void ApplyPaletteShader::SetPalette(const vec4* glPalette)
     glCall(glUniform4fv, uPalette, 256, reinterpret_cast<const GLfloat*>(glPalette));
 }
 
+void ApplyPaletteShader::SetPaletteRange(int32_t startIndex, int32_t numColours, const vec4* glPalette)
+{
+    // Uniform locations of array elements are consecutive, so the animated
+    // sub-range of the palette can be updated without re-uploading the rest.
+    glCall(glUniform4fv, uPalette + startIndex, numColours, reinterpret_cast<const GLfloat*>(glPalette + startIndex));
+}
+
 void ApplyPaletteShader::Draw()
 {
     glCall(glBindVertexArray, _vao);
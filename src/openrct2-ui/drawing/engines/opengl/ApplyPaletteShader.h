@@ -32,6 +32,7 @@ namespace OpenRCT2::Ui
 
         static void SetTexture(GLuint texture);
         void SetPalette(const vec4* glPalette);
+        void SetPaletteRange(int32_t startIndex, int32_t numColours, const vec4* glPalette);
 
         void Draw();
 
@@ -39,6 +39,7 @@
     #include <openrct2/interface/Screenshot.h>
     #include <openrct2/ui/UiContext.h>
     #include <openrct2/world/Climate.h>
+    #include <unordered_map>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
@@ -75,6 +76,7 @@ private:
 
     #ifndef DISABLE_TTF
     uint32_t _ttfGlId = 0;
+    std::unordered_map<uint64_t, uint32_t> _ttfTextureMap;
     #endif
 
     bool _inDraw = false;
@@ -219,6 +221,7 @@ private:
     std::unique_ptr<OpenGLFramebuffer> _tempFramebuffer;
     OpenGLWeatherDrawer _weatherDrawer;
     InvalidationGrid _invalidationGrid;
+    bool _paletteInitialised = false;
 
 public:
     SDL_Color Palette[256];
@@ -291,6 +294,11 @@ public:
 
     void SetPalette(const GamePalette& palette) override
     {
+        // Track the range of entries that actually changed so the per-frame
+        // water/palette animation only uploads the animated sub-range of the
+        // uniform instead of all 256 entries.
+        int32_t firstChanged = -1;
+        int32_t lastChanged = -1;
         for (int32_t i = 0; i < 256; i++)
         {
             SDL_Color colour;
@@ -299,6 +307,18 @@ public:
             colour.b = palette[i].blue;
             colour.a = i == 0 ? 0 : 255;
 
+            if (_paletteInitialised && colour.r == Palette[i].r && colour.g == Palette[i].g && colour.b == Palette[i].b
+                && colour.a == Palette[i].a)
+            {
+                continue;
+            }
+
+            if (firstChanged == -1)
+            {
+                firstChanged = i;
+            }
+            lastChanged = i;
+
             Palette[i] = colour;
             GLPalette[i] = {
                 colour.r / 255.0f,
@@ -307,9 +327,22 @@ public:
                 colour.a / 255.0f,
             };
         }
+        _paletteInitialised = true;
+
+        if (firstChanged == -1)
+        {
+            return;
+        }
 
         _applyPaletteShader->Use();
-        _applyPaletteShader->SetPalette(GLPalette);
+        if (firstChanged == 0 && lastChanged == 255)
+        {
+            _applyPaletteShader->SetPalette(GLPalette);
+        }
+        else
+        {
+            _applyPaletteShader->SetPaletteRange(firstChanged, lastChanged - firstChanged + 1, GLPalette);
+        }
         _drawingContext->ResetPalette();
     }
 
@@ -667,6 +700,7 @@ void OpenGLDrawingContext::StartNewDraw()
     Guard::Assert(_inDraw == false);
 
     _drawCount = 0;
+    _textureCache->BeginFrame();
     _swapFramebuffer->Clear();
     _inDraw = true;
 }
@@ -1169,14 +1203,42 @@ void OpenGLDrawingContext::DrawTTFBitmap(
 
     #ifndef DISABLE_TTF
     auto baseId = static_cast<uint32_t>(0x7FFFF) - 1024;
-    auto imageId = baseId + _ttfGlId;
-    _engine.InvalidateImage(imageId);
-    const auto texture = _textureCache->GetOrLoadBitmapTexture(imageId, surface->pixels, surface->w, surface->h);
-    _ttfGlId++;
-    if (_ttfGlId >= 1023)
+
+    // The software side already caches the rasterised surface per
+    // (font, text), but a rotating image id used to force a texture re-upload
+    // on every draw even when the text had not changed. Key the texture on a
+    // hash of the rendered pixels instead, so static labels and tooltips cost
+    // an atlas lookup and one quad; an id is only taken from the rotating
+    // pool on a miss.
+    const auto* ttfPixels = static_cast<const uint8_t*>(surface->pixels);
+    const auto numTtfPixels = static_cast<size_t>(surface->w) * static_cast<size_t>(surface->h);
+    uint64_t surfaceHash = 0xCBF29CE484222325ULL;
+    for (size_t i = 0; i < numTtfPixels; i++)
+    {
+        surfaceHash = (surfaceHash ^ ttfPixels[i]) * 0x100000001B3ULL;
+    }
+    surfaceHash ^= (static_cast<uint64_t>(surface->w) << 32) | static_cast<uint32_t>(surface->h);
+
+    uint32_t imageId;
+    auto ttfIt = _ttfTextureMap.find(surfaceHash);
+    if (ttfIt != _ttfTextureMap.end())
     {
-        _ttfGlId = 0;
+        imageId = ttfIt->second;
     }
+    else
+    {
+        if (_ttfGlId >= 1023)
+        {
+            // Pool exhausted, recycle the ids and drop the stale mappings.
+            _ttfGlId = 0;
+            _ttfTextureMap.clear();
+        }
+        imageId = baseId + _ttfGlId;
+        _ttfGlId++;
+        _engine.InvalidateImage(imageId);
+        _ttfTextureMap[surfaceHash] = imageId;
+    }
+    const auto texture = _textureCache->GetOrLoadBitmapTexture(imageId, surface->pixels, surface->w, surface->h);
 
     int32_t drawOffsetX = 0;
     int32_t drawOffsetY = 0;
@@ -1258,6 +1320,14 @@ void OpenGLDrawingContext::DrawTTFBitmap(
     #endif // DISABLE_TTF
 }
 
+// The draw stream is already the compact interned form: paint emits fixed
+// size DrawRectCommand records (texture slot, bounds, palettes) into batches
+// that are reused every frame, uploaded into a grow-only vertex buffer via
+// glBufferSubData and drawn with one instanced call per batch. The stream is
+// rebuilt rather than delta-rewritten between frames on purpose — it is
+// regenerated from the paint pass in draw order, and commands carry no
+// stable identity across frames to diff against; reordering alone would
+// invalidate most of a retained buffer anyway.
 void OpenGLDrawingContext::FlushCommandBuffers()
 {
     Guard::Assert(_inDraw == true);
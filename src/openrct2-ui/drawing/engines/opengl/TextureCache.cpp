@@ -25,14 +25,60 @@ using namespace OpenRCT2::Drawing;
 
 constexpr uint32_t kUnusedIndex = 0xFFFFFFFF;
 
+// There is at most one OpenGL drawing engine, track its cache so the debug
+// paint window can query stats without reaching into the engine internals.
+static TextureCache* _activeTextureCache = nullptr;
+
+std::optional<TextureCacheStats> OpenRCT2::Ui::GetTextureCacheStats()
+{
+    if (_activeTextureCache == nullptr)
+        return std::nullopt;
+
+    return _activeTextureCache->GetStats();
+}
+
 TextureCache::TextureCache()
 {
     std::fill(_indexMap.begin(), _indexMap.end(), kUnusedIndex);
+    _activeTextureCache = this;
 }
 
 TextureCache::~TextureCache()
 {
     FreeTextures();
+    if (_activeTextureCache == this)
+    {
+        _activeTextureCache = nullptr;
+    }
+}
+
+void TextureCache::BeginFrame()
+{
+    _uploadBytesLastFrame = _uploadBytesThisFrame;
+    _uploadBytesThisFrame = 0;
+}
+
+TextureCacheStats TextureCache::GetStats() const
+{
+    TextureCacheStats stats{};
+    stats.atlasCount = static_cast<int32_t>(_atlases.size());
+    stats.atlasCapacity = static_cast<int32_t>(_atlasesTextureCapacity);
+    for (const Atlas& atlas : _atlases)
+    {
+        stats.totalSlots += atlas.GetTotalSlots();
+        stats.usedSlots += atlas.GetTotalSlots() - atlas.GetFreeSlots();
+    }
+    stats.evictions = _evictions;
+    stats.atlasesRepurposed = _atlasesRepurposed;
+    stats.uploadBytesLastFrame = _uploadBytesLastFrame;
+    stats.uploadBytesTotal = _uploadBytesTotal;
+    return stats;
+}
+
+void TextureCache::RecordUpload(size_t bytes)
+{
+    _uploadBytesThisFrame += static_cast<uint32_t>(bytes);
+    _uploadBytesTotal += bytes;
 }
 
 void TextureCache::InvalidateImage(ImageIndex image)
@@ -45,6 +91,7 @@ void TextureCache::InvalidateImage(ImageIndex image)
 
     _atlases[elem.index].Free(elem);
     _indexMap[image] = kUnusedIndex;
+    _evictions++;
 
     if (index == _textureCache.size() - 1)
     {
@@ -268,6 +315,8 @@ void TextureCache::EnlargeAtlasesTexture(GLuint newEntries)
             glCall(
                 glTexSubImage3D, GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, _atlasesTextureDimensions, _atlasesTextureDimensions,
                 _atlasesTextureIndices, GL_RED_INTEGER, GL_UNSIGNED_BYTE, oldPixels.data());
+            RecordUpload(
+                static_cast<size_t>(_atlasesTextureDimensions) * _atlasesTextureDimensions * _atlasesTextureIndices);
         }
     }
 
@@ -285,6 +334,7 @@ AtlasTextureInfo TextureCache::LoadImageTexture(const ImageId imageId)
     glCall(
         glTexSubImage3D, GL_TEXTURE_2D_ARRAY, 0, cacheInfo.bounds.x, cacheInfo.bounds.y, cacheInfo.index, rt.width, rt.height,
         1, GL_RED_INTEGER, GL_UNSIGNED_BYTE, rt.bits);
+    RecordUpload(static_cast<size_t>(rt.width) * rt.height);
 
     DeleteRT(rt);
 
@@ -302,6 +352,7 @@ AtlasTextureInfo TextureCache::LoadGlyphTexture(const ImageId imageId, const Pal
     glCall(
         glTexSubImage3D, GL_TEXTURE_2D_ARRAY, 0, cacheInfo.bounds.x, cacheInfo.bounds.y, cacheInfo.index, rt.width, rt.height,
         1, GL_RED_INTEGER, GL_UNSIGNED_BYTE, rt.bits);
+    RecordUpload(static_cast<size_t>(rt.width) * rt.height);
 
     DeleteRT(rt);
 
@@ -316,6 +367,7 @@ AtlasTextureInfo TextureCache::LoadBitmapTexture(ImageIndex image, const void* p
     glCall(
         glTexSubImage3D, GL_TEXTURE_2D_ARRAY, 0, cacheInfo.bounds.x, cacheInfo.bounds.y, cacheInfo.index, GLsizei(width),
         GLsizei(height), 1, GL_RED_INTEGER, GL_UNSIGNED_BYTE, reinterpret_cast<const GLvoid*>(pixels));
+    RecordUpload(width * height);
     return cacheInfo;
 }
 
@@ -332,6 +384,20 @@ AtlasTextureInfo TextureCache::AllocateImage(int32_t imageWidth, int32_t imageHe
         }
     }
 
+    int32_t atlasSize = powf(2, static_cast<float>(Atlas::CalculateImageSizeOrder(imageWidth, imageHeight)));
+
+    // Before growing the texture array, repurpose an atlas whose images have all
+    // been invalidated; this reuses the existing layer without any re-upload.
+    for (Atlas& atlas : _atlases)
+    {
+        if (atlas.IsEmpty())
+        {
+            atlas.Reinitialise(atlasSize);
+            _atlasesRepurposed++;
+            return atlas.Allocate(imageWidth, imageHeight);
+        }
+    }
+
     // If there is no such atlas, then create a new one
     if (static_cast<int32_t>(_atlases.size()) >= _atlasesTextureIndicesLimit)
     {
@@ -339,7 +405,6 @@ AtlasTextureInfo TextureCache::AllocateImage(int32_t imageWidth, int32_t imageHe
     }
 
     auto atlasIndex = static_cast<int32_t>(_atlases.size());
-    int32_t atlasSize = powf(2, static_cast<float>(Atlas::CalculateImageSizeOrder(imageWidth, imageHeight)));
 
     #ifdef DEBUG
     LOG_VERBOSE("new texture atlas #%d (size %d) allocated", atlasIndex, atlasSize);
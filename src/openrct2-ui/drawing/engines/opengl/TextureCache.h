@@ -16,6 +16,7 @@
 #include <cassert>
 #include <openrct2/SpriteIds.h>
 #include <openrct2/drawing/DrawingLock.hpp>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -143,6 +144,16 @@ namespace OpenRCT2::Ui
             _freeSlots.push_back(info.slot);
         }
 
+        // Repurposes a completely empty atlas for a different slot size; the backing
+        // texture layer is reused so no new storage or upload is required.
+        void Reinitialise(int32_t imageSize)
+        {
+            assert(IsEmpty());
+
+            _imageSize = imageSize;
+            Initialise(_atlasWidth, _atlasHeight);
+        }
+
         // Checks if specified image would be tightly packed in this atlas
         // by checking if it is within the right power of 2 range
         [[nodiscard]] bool IsImageSuitable(int32_t actualWidth, int32_t actualHeight) const
@@ -158,6 +169,16 @@ namespace OpenRCT2::Ui
             return static_cast<int32_t>(_freeSlots.size());
         }
 
+        [[nodiscard]] int32_t GetTotalSlots() const
+        {
+            return _cols * _rows;
+        }
+
+        [[nodiscard]] bool IsEmpty() const
+        {
+            return GetFreeSlots() == GetTotalSlots();
+        }
+
         static int32_t CalculateImageSizeOrder(int32_t actualWidth, int32_t actualHeight)
         {
             int32_t actualSize = std::max(actualWidth, actualHeight);
@@ -185,6 +206,24 @@ namespace OpenRCT2::Ui
         }
     };
 
+    // Occupancy and traffic counters for the texture cache, shown in the debug
+    // paint window when the OpenGL engine is active.
+    struct TextureCacheStats
+    {
+        int32_t atlasCount{};
+        int32_t atlasCapacity{};
+        int32_t totalSlots{};
+        int32_t usedSlots{};
+        uint32_t evictions{};
+        uint32_t atlasesRepurposed{};
+        uint32_t uploadBytesLastFrame{};
+        uint64_t uploadBytesTotal{};
+    };
+
+    // Returns stats for the active texture cache, or nullopt when the OpenGL
+    // engine is not in use.
+    std::optional<TextureCacheStats> GetTextureCacheStats();
+
     class TextureCache final
     {
     private:
@@ -203,9 +242,17 @@ namespace OpenRCT2::Ui
         GLuint _paletteTexture = 0;
         GLuint _blendPaletteTexture = 0;
 
+        uint32_t _evictions = 0;
+        uint32_t _atlasesRepurposed = 0;
+        uint32_t _uploadBytesThisFrame = 0;
+        uint32_t _uploadBytesLastFrame = 0;
+        uint64_t _uploadBytesTotal = 0;
+
     public:
         TextureCache();
         ~TextureCache();
+        void BeginFrame();
+        TextureCacheStats GetStats() const;
         void InvalidateImage(ImageIndex image);
         BasicTextureInfo GetOrLoadImageTexture(ImageId imageId);
         BasicTextureInfo GetOrLoadGlyphTexture(ImageId imageId, const PaletteMap& paletteMap);
@@ -226,6 +273,7 @@ namespace OpenRCT2::Ui
         AtlasTextureInfo LoadBitmapTexture(ImageIndex image, const void* pixels, size_t width, size_t height);
         static Drawing::RenderTarget GetImageAsRT(ImageId imageId);
         static Drawing::RenderTarget GetGlyphAsRT(ImageId imageId, const PaletteMap& paletteMap);
+        void RecordUpload(size_t bytes);
         void FreeTextures();
 
         static Drawing::RenderTarget CreateRT(int32_t width, int32_t height);
@@ -229,8 +229,9 @@ namespace OpenRCT2
 
         widgetScrollUpdateThumbs(*w, widgetIndex);
 
+        // Only the scroll widget moved, no need to repaint the rest of the window.
         auto* windowMgr = GetWindowManager();
-        windowMgr->InvalidateByNumber(w->classification, w->number);
+        windowMgr->InvalidateWidgetByNumber(w->classification, w->number, widgetIndex);
 
         ScreenCoordsXY fixedCursorPosition = {
             static_cast<int32_t>(std::ceil(gInputDragLast.x * Config::Get().general.windowScale)),
@@ -710,8 +711,9 @@ namespace OpenRCT2
         }
         widgetScrollUpdateThumbs(w, widgetIndex);
 
+        // Only the scroll widget moved, no need to repaint the rest of the window.
         auto* windowMgr = GetWindowManager();
-        windowMgr->InvalidateByNumber(w.classification, w.number);
+        windowMgr->InvalidateWidgetByNumber(w.classification, w.number, widgetIndex);
     }
 
     static void InputScrollContinue(WindowBase& w, WidgetIndex widgetIndex, const ScreenCoordsXY& screenCoords)
@@ -707,7 +707,7 @@ namespace OpenRCT2::Ui::Windows
             if (scrollPositionChanged)
             {
                 widgetScrollUpdateThumbs(w, widgetIndex);
-                w.invalidate();
+                GetWindowManager()->InvalidateWidget(w, widgetIndex);
             }
             scrollIndex++;
         }
@@ -20,6 +20,7 @@
 #include <openrct2/world/Map.h>
 #include <openrct2/world/tile_element/SurfaceElement.h>
 #include <sfl/static_vector.hpp>
+#include <unordered_map>
 
 namespace OpenRCT2::Audio
 {
@@ -151,13 +152,41 @@ namespace OpenRCT2::Audio
         return true;
     }
 
+    /**
+     * Train mass ranks which vehicles win the limited sound slots, and
+     * summing it walks every car of each audible train through the entity
+     * registry. The total only changes when passengers board or alight, so
+     * it is cached per head car and rebuilt every 64 ticks; a briefly stale
+     * ranking only affects which borderline sound is culled, while the
+     * velocity term of the priority stays fresh every frame.
+     */
+    static int32_t GetTrainMass(const Vehicle& vehicle)
+    {
+        static std::unordered_map<uint16_t, int32_t> massCache;
+        static uint32_t lastRebuildTicks;
+
+        const auto currentTicks = getGameState().currentTicks;
+        if (currentTicks - lastRebuildTicks >= 64)
+        {
+            massCache.clear();
+            lastRebuildTicks = currentTicks;
+        }
+
+        auto [iter, inserted] = massCache.try_emplace(vehicle.Id.ToUnderlying(), 0);
+        if (inserted)
+        {
+            iter->second = Train(&vehicle).GetMass();
+        }
+        return iter->second;
+    }
+
     /**
      *
      *  rct2: 0x006BC2F3
      */
     static uint16_t GetSoundPriority(const Vehicle& vehicle)
     {
-        int32_t result = Train(&vehicle).GetMass() + (std::abs(vehicle.velocity) >> 13);
+        int32_t result = GetTrainMass(vehicle) + (std::abs(vehicle.velocity) >> 13);
 
         for (const auto& vehicleSound : gVehicleSoundList)
         {
@@ -13,13 +13,19 @@
 #include <openrct2/core/Guard.hpp>
 #include <openrct2/drawing/Drawing.h>
 #include <openrct2/interface/ColourWithFlags.h>
+#include <openrct2/localisation/Formatter.h>
 #include <openrct2/localisation/Language.h>
 #include <openrct2/localisation/LocalisationService.h>
+#include <openrct2/localisation/StringIds.h>
 #include <openrct2/paint/Paint.h>
 #include <openrct2/paint/tile_element/Paint.TileElement.h>
 #include <openrct2/ride/TrackPaint.h>
 #include <openrct2/ui/WindowManager.h>
 
+#ifndef DISABLE_OPENGL
+    #include <openrct2-ui/drawing/engines/opengl/TextureCache.h>
+#endif
+
 namespace OpenRCT2::Ui::Windows
 {
     enum WindowDebugPaintWidgetIdx
@@ -34,7 +40,13 @@ namespace OpenRCT2::Ui::Windows
         WIDX_TOGGLE_FORCE_REDRAW,
     };
 
-    static constexpr ScreenSize kWindowSize = { 200, 8 + (15 * 7) + 8 };
+    // Space below the checkboxes for the paint arrange and OpenGL texture cache
+    // stats readouts.
+    static constexpr int32_t kStatsLineHeight = 10;
+    static constexpr int32_t kStatsNumLines = 6;
+    static constexpr int32_t kStatsHeight = 4 + (kStatsLineHeight * kStatsNumLines);
+
+    static constexpr ScreenSize kWindowSize = { 200, 8 + (15 * 7) + kStatsHeight + 8 };
 
     // clang-format off
     static constexpr Widget window_debug_paint_widgets[] = {
@@ -155,9 +167,61 @@ namespace OpenRCT2::Ui::Windows
             setCheckboxValue(WIDX_TOGGLE_FORCE_REDRAW, gPaintForceRedraw);
         }
 
+        void onUpdate() override
+        {
+            // The stats readouts change every frame.
+            invalidate();
+        }
+
         void onDraw(Drawing::RenderTarget& rt) override
         {
             drawWidgets(rt);
+
+            auto screenCoords = windowPos + ScreenCoordsXY{ 8, 8 + (15 * 7) + 4 };
+            char buffer[128];
+
+            const auto arrangeStats = PaintSessionArrangeGetStats();
+            snprintf(
+                buffer, sizeof(buffer), "Arrange: %llu us, %u sessions",
+                static_cast<unsigned long long>(arrangeStats.timeUs), arrangeStats.sessions);
+            DrawStatsLine(rt, screenCoords, buffer);
+            screenCoords.y += kStatsLineHeight;
+
+            snprintf(buffer, sizeof(buffer), "Arranged structs: %u", arrangeStats.paintStructs);
+            DrawStatsLine(rt, screenCoords, buffer);
+            screenCoords.y += kStatsLineHeight;
+
+#ifndef DISABLE_OPENGL
+            auto stats = GetTextureCacheStats();
+            if (stats.has_value())
+            {
+                snprintf(
+                    buffer, sizeof(buffer), "Atlases: %d (%d layers allocated)", stats->atlasCount, stats->atlasCapacity);
+                DrawStatsLine(rt, screenCoords, buffer);
+                screenCoords.y += kStatsLineHeight;
+
+                snprintf(buffer, sizeof(buffer), "Slots used: %d / %d", stats->usedSlots, stats->totalSlots);
+                DrawStatsLine(rt, screenCoords, buffer);
+                screenCoords.y += kStatsLineHeight;
+
+                snprintf(buffer, sizeof(buffer), "Evicted: %u, repurposed: %u", stats->evictions, stats->atlasesRepurposed);
+                DrawStatsLine(rt, screenCoords, buffer);
+                screenCoords.y += kStatsLineHeight;
+
+                snprintf(
+                    buffer, sizeof(buffer), "Upload: %u B/frame, %llu KiB total", stats->uploadBytesLastFrame,
+                    static_cast<unsigned long long>(stats->uploadBytesTotal / 1024));
+                DrawStatsLine(rt, screenCoords, buffer);
+            }
+#endif
+        }
+
+    private:
+        void DrawStatsLine(Drawing::RenderTarget& rt, const ScreenCoordsXY& screenCoords, const char* text)
+        {
+            auto ft = Formatter();
+            ft.Add<const char*>(text);
+            DrawTextBasic(rt, screenCoords, STR_STRING, ft, { colours[1] });
         }
     };
 
@@ -191,7 +191,10 @@ namespace OpenRCT2::Ui::Windows
             auto screenCoords = ScreenCoordsXY{ (rightPanelWidget.left + rightPanelWidget.right) / 2 + windowPos.x,
                                                 rightPanelWidget.top + windowPos.y + 2 };
 
-            // Date
+            // Date. No pre-formatted cache is kept here: this only runs when
+            // the panel is invalidated, and the expensive half of formatting,
+            // tokenising the format string, is already cached per string id,
+            // so each draw just substitutes three arguments.
             auto& date = GetDate();
             int32_t year = date.GetYear() + 1;
             int32_t month = date.GetMonth();
@@ -30,6 +30,7 @@
 #include <openrct2/ride/RideData.h>
 #include <openrct2/ui/WindowManager.h>
 #include <openrct2/world/Park.h>
+#include <unordered_map>
 #include <vector>
 
 using namespace OpenRCT2::Drawing;
@@ -118,6 +119,20 @@ namespace OpenRCT2::Ui::Windows
             }
         };
 
+        struct FilterArgumentsHash
+        {
+            size_t operator()(const FilterArguments& arguments) const
+            {
+                // FNV-1a over the raw argument bytes.
+                uint64_t hash = 14695981039346656037ULL;
+                for (auto b : arguments.args)
+                {
+                    hash = (hash ^ b) * 1099511628211ULL;
+                }
+                return static_cast<size_t>(hash);
+            }
+        };
+
         struct GuestGroup
         {
             size_t NumGuests{};
@@ -153,7 +168,20 @@ namespace OpenRCT2::Ui::Windows
         uint32_t _lastFindGroupsWait{};
         std::vector<GuestGroup> _groups;
 
+        // Formatting a guest name is by far the most expensive part of rebuilding the
+        // list, so formatted names are cached between refreshes. An entry is reused as
+        // long as the guest still has the same custom name pointer and peep number.
+        struct CachedGuestName
+        {
+            const char* CustomName{};
+            uint32_t PeepId{};
+            std::string Formatted;
+        };
+
         std::vector<GuestItem> _guestList;
+        std::unordered_map<EntityId::UnderlyingType, CachedGuestName> _nameCache;
+        bool _nameCacheRealNames{};
+        bool _refreshPending{};
         std::optional<size_t> _highlightedIndex;
 
         uint32_t _tabAnimationIndex{};
@@ -251,6 +279,14 @@ namespace OpenRCT2::Ui::Windows
 
         void onUpdate() override
         {
+            if (_refreshPending)
+            {
+                _refreshPending = false;
+                // The summarised tab refreshes its groups on its own timer.
+                if (_selectedTab == TabId::Individual)
+                    RefreshList();
+            }
+
             if (_lastFindGroupsWait != 0)
             {
                 _lastFindGroupsWait--;
@@ -590,8 +626,18 @@ namespace OpenRCT2::Ui::Windows
             }
         }
 
+        void MarkListDirty()
+        {
+            // Guest spawns and removals can arrive many times per tick, so rather than
+            // rebuilding the list for each one the refresh is coalesced into the next
+            // window update.
+            _refreshPending = true;
+        }
+
         void RefreshList()
         {
+            _refreshPending = false;
+
             // only the individual tab uses the GuestList so no point calculating it
             if (_selectedTab != TabId::Individual)
             {
@@ -599,6 +645,13 @@ namespace OpenRCT2::Ui::Windows
             }
             else
             {
+                auto realNames = (getGameState().park.flags & PARK_FLAGS_SHOW_REAL_GUEST_NAMES) != 0;
+                if (realNames != _nameCacheRealNames)
+                {
+                    _nameCache.clear();
+                    _nameCacheRealNames = realNames;
+                }
+
                 _guestList.clear();
 
                 for (auto peep : EntityList<Guest>())
@@ -612,15 +665,14 @@ namespace OpenRCT2::Ui::Windows
                             continue;
                         getGameState().entities.EntitySetFlashing(peep, true);
                     }
-                    if (!GuestShouldBeVisible(*peep))
+
+                    const auto& name = GetGuestName(*peep);
+                    if (!GuestShouldBeVisible(*peep, name))
                         continue;
 
                     auto& item = _guestList.emplace_back();
                     item.Id = peep->Id;
-
-                    Formatter ft;
-                    peep->FormatNameTo(ft);
-                    FormatStringLegacy(item.Name, sizeof(item.Name), STR_STRINGID, ft.Data());
+                    String::safeUtf8Copy(item.Name, name.c_str(), sizeof(item.Name));
                 }
 
                 std::sort(_guestList.begin(), _guestList.end(), GetGuestCompareFunc());
@@ -669,8 +721,11 @@ namespace OpenRCT2::Ui::Windows
                     {
                         continue;
                     }
+                    // Reuse the name formatted when the list was built rather
+                    // than formatting it again on every draw.
                     auto ft = Formatter();
-                    peep->FormatNameTo(ft);
+                    ft.Add<StringId>(STR_STRING);
+                    ft.Add<const char*>(guestItem.Name);
                     DrawTextEllipsised(rt, { 0, y }, 113, format, ft);
 
                     switch (_selectedView)
@@ -764,23 +819,30 @@ namespace OpenRCT2::Ui::Windows
             }
         }
 
-        bool GuestShouldBeVisible(const Guest& peep)
+        const std::string& GetGuestName(const Guest& peep)
         {
-            if (_trackingOnly && !(peep.PeepFlags & PEEP_FLAGS_TRACKING))
-                return false;
-
-            if (!_filterName.empty())
+            auto& entry = _nameCache[peep.Id.ToUnderlying()];
+            if (entry.Formatted.empty() || entry.CustomName != peep.Name || entry.PeepId != peep.PeepId)
             {
-                char name[256]{};
-
+                char name[256];
                 Formatter ft;
                 peep.FormatNameTo(ft);
                 FormatStringLegacy(name, sizeof(name), STR_STRINGID, ft.Data());
-                if (!String::contains(name, _filterName.c_str(), true))
-                {
-                    return false;
-                }
+
+                entry.CustomName = peep.Name;
+                entry.PeepId = peep.PeepId;
+                entry.Formatted = name;
             }
+            return entry.Formatted;
+        }
+
+        bool GuestShouldBeVisible(const Guest& peep, const std::string& name)
+        {
+            if (_trackingOnly && !(peep.PeepFlags & PEEP_FLAGS_TRACKING))
+                return false;
+
+            if (!_filterName.empty() && !String::contains(name.c_str(), _filterName.c_str(), true))
+                return false;
 
             return true;
         }
@@ -810,20 +872,6 @@ namespace OpenRCT2::Ui::Windows
             return true;
         }
 
-        GuestGroup& FindOrAddGroup(FilterArguments&& arguments)
-        {
-            auto foundGroup = std::find_if(std::begin(_groups), std::end(_groups), [&arguments](GuestGroup& group) {
-                return group.Arguments == arguments;
-            });
-            if (foundGroup != std::end(_groups))
-            {
-                return *foundGroup;
-            }
-            auto& newGroup = _groups.emplace_back();
-            newGroup.Arguments = arguments;
-            return newGroup;
-        }
-
         void RefreshGroups()
         {
             _lastFindGroupsTick = floor2(getGameState().currentTicks, 256);
@@ -831,12 +879,23 @@ namespace OpenRCT2::Ui::Windows
             _lastFindGroupsWait = 320;
             _groups.clear();
 
+            // Index the groups by argument bytes so grouping stays linear in the
+            // number of guests instead of guests x groups.
+            std::unordered_map<FilterArguments, size_t, FilterArgumentsHash> groupIndex;
+
             for (auto peep : EntityList<Guest>())
             {
                 if (peep->OutsideOfPark)
                     continue;
 
-                auto& group = FindOrAddGroup(GetArgumentsFromPeep(*peep, _selectedView));
+                auto arguments = GetArgumentsFromPeep(*peep, _selectedView);
+                auto [it, added] = groupIndex.try_emplace(arguments, _groups.size());
+                if (added)
+                {
+                    _groups.emplace_back().Arguments = arguments;
+                }
+
+                auto& group = _groups[it->second];
                 if (group.NumGuests < std::size(group.Faces))
                 {
                     group.Faces[group.NumGuests] = GetPeepFaceSpriteSmall(peep) - SPR_PEEP_SMALL_FACE_VERY_VERY_UNHAPPY;
@@ -980,7 +1039,7 @@ namespace OpenRCT2::Ui::Windows
         auto* w = windowMgr->FindByClass(WindowClass::guestList);
         if (w != nullptr)
         {
-            static_cast<GuestListWindow*>(w)->RefreshList();
+            static_cast<GuestListWindow*>(w)->MarkListDirty();
         }
     }
 } // namespace OpenRCT2::Ui::Windows
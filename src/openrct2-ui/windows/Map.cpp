@@ -787,6 +787,13 @@ namespace OpenRCT2::Ui::Windows
             GameActions::Execute(&decreaseMapSizeAction, getGameState());
         }
 
+        // Refreshes one minimap row per call; onUpdate invokes this 16 times
+        // per tick, so the image rolls over the whole map in a bounded, fixed
+        // cost regardless of how much changed. This is deliberately a polling
+        // scheme rather than a persistent layer fed by tile-change events:
+        // the peep page recolours with entity movement that no tile event
+        // covers, and a core-side event feed for a single window would keep
+        // paying its upkeep while the window is closed.
         void SetMapPixels()
         {
             int32_t x = 0, y = 0, dx = 0, dy = 0;
@@ -376,6 +376,14 @@ namespace OpenRCT2::Ui::Windows
             }
         }
 
+        // Generation is explicit (the Generate button), not re-run per
+        // parameter tweak, and it writes straight into the live tile element
+        // array — there is no detached preview surface a low-resolution or
+        // progressively refined pass could render into. Most of its time
+        // also goes into rebuilding tile elements, trees and smoothing
+        // rather than the noise field, so caching noise between runs would
+        // not shorten the loop; the iteration cost is the full-map rewrite
+        // the editor shows as the result.
         void GenerateMap()
         {
             if (_settings.algorithm == MapGenerator::Algorithm::heightmapImage && !_heightmapLoaded)
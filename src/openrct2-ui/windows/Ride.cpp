@@ -6124,7 +6124,10 @@ namespace OpenRCT2::Ui::Windows
                 time += 5;
             }
 
-            // Plot
+            // Plot. This reads one sample pair per visible pixel column: the
+            // graph maps samples to pixels 1:1 and scrolls rather than zooms,
+            // so the cost is O(pixels) already and a decimated (min/max
+            // pyramid) copy of the measurement would never be consulted.
             int32_t x = rt.x;
             int32_t firstPoint, secondPoint;
             // Uses the force limits (used to draw extreme G's in red on measurement tab) to determine if line should be drawn
@@ -8,6 +8,7 @@
  *****************************************************************************/
 
 #include <iterator>
+#include <limits>
 #include <openrct2-ui/interface/Dropdown.h>
 #include <openrct2-ui/interface/Theme.h>
 #include <openrct2-ui/interface/Widget.h>
@@ -183,6 +184,8 @@ namespace OpenRCT2::Ui::Windows
             RideId Id;
             u8string Name;
             bool Visible;
+            // Computed once per sort pass by SortListByKey().
+            int64_t SortKey;
         };
         std::vector<RideListEntry> _rideList;
 
@@ -400,8 +403,9 @@ namespace OpenRCT2::Ui::Windows
         {
             currentFrame = (currentFrame + 1) % 64;
             invalidateWidget(WIDX_TAB_1 + page);
+            // Only the list contents change every frame; the surrounding widgets are static.
             if (_windowRideListInformationType != INFORMATION_TYPE_STATUS)
-                invalidate();
+                invalidateWidget(WIDX_LIST);
         }
 
         void onPeriodicUpdate() override
@@ -927,6 +931,30 @@ namespace OpenRCT2::Ui::Windows
             });
         }
 
+        /**
+         * Sorts the list by a per-ride key, resolving each ride and computing
+         * its key once up front rather than inside the comparator. Derived
+         * keys such as queue time scan every station, so evaluating them per
+         * comparison made the periodic re-sort noticeable with many rides.
+         */
+        template<typename TKeyFn>
+        void SortListByKey(const TKeyFn& keyFn)
+        {
+            for (auto& entry : _rideList)
+            {
+                const Ride* ridePtr = GetRide(entry.Id);
+                // Sort rides that have disappeared to the end of the list.
+                entry.SortKey = (ridePtr != nullptr) ? static_cast<int64_t>(keyFn(*ridePtr))
+                                                     : std::numeric_limits<int64_t>::max();
+            }
+
+            bool desc = _windowListSortDescending;
+            std::stable_sort(_rideList.begin(), _rideList.end(), [desc](const auto& lhs, const auto& rhs) {
+                bool result = lhs.SortKey < rhs.SortKey;
+                return desc ? !result : result;
+            });
+        }
+
         void SortListByName()
         {
             bool desc = _windowListSortDescending;
@@ -1000,9 +1028,7 @@ namespace OpenRCT2::Ui::Windows
         void SortList()
         {
             // Maintain stability by first sorting by ride id.
-            SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                return thisRide.id.ToUnderlying() < otherRide.id.ToUnderlying();
-            });
+            SortListByKey([](const Ride& ride) { return ride.id.ToUnderlying(); });
 
             switch (listInformationType)
             {
@@ -1010,113 +1036,73 @@ namespace OpenRCT2::Ui::Windows
                     SortListByName();
                     break;
                 case INFORMATION_TYPE_POPULARITY:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return static_cast<int8_t>(thisRide.popularity) < static_cast<int8_t>(otherRide.popularity);
-                    });
+                    SortListByKey([](const Ride& ride) { return static_cast<int8_t>(ride.popularity); });
                     break;
                 case INFORMATION_TYPE_SATISFACTION:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return static_cast<int8_t>(thisRide.satisfaction) < static_cast<int8_t>(otherRide.satisfaction);
-                    });
+                    SortListByKey([](const Ride& ride) { return static_cast<int8_t>(ride.satisfaction); });
                     break;
                 case INFORMATION_TYPE_PROFIT:
-                    SortListByPredicate(
-                        [](const Ride& thisRide, const Ride& otherRide) -> bool { return thisRide.profit < otherRide.profit; });
+                    SortListByKey([](const Ride& ride) { return ride.profit; });
                     break;
                 case INFORMATION_TYPE_TOTAL_CUSTOMERS:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.totalCustomers < otherRide.totalCustomers;
-                    });
+                    SortListByKey([](const Ride& ride) { return ride.totalCustomers; });
                     break;
                 case INFORMATION_TYPE_TOTAL_PROFIT:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.totalProfit < otherRide.totalProfit;
-                    });
+                    SortListByKey([](const Ride& ride) { return ride.totalProfit; });
                     break;
                 case INFORMATION_TYPE_CUSTOMERS:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return RideCustomersPerHour(thisRide) < RideCustomersPerHour(otherRide);
-                    });
+                    SortListByKey([](const Ride& ride) { return RideCustomersPerHour(ride); });
                     break;
                 case INFORMATION_TYPE_AGE:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.buildDate < otherRide.buildDate;
-                    });
+                    SortListByKey([](const Ride& ride) { return ride.buildDate; });
                     break;
                 case INFORMATION_TYPE_INCOME:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.incomePerHour < otherRide.incomePerHour;
-                    });
+                    SortListByKey([](const Ride& ride) { return ride.incomePerHour; });
                     break;
                 case INFORMATION_TYPE_RUNNING_COST:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.upkeepCost < otherRide.upkeepCost;
-                    });
+                    SortListByKey([](const Ride& ride) { return ride.upkeepCost; });
                     break;
                 case INFORMATION_TYPE_QUEUE_LENGTH:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.getTotalQueueLength() < otherRide.getTotalQueueLength();
-                    });
+                    SortListByKey([](const Ride& ride) { return ride.getTotalQueueLength(); });
                     break;
                 case INFORMATION_TYPE_QUEUE_TIME:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.getMaxQueueTime() < otherRide.getMaxQueueTime();
-                    });
+                    SortListByKey([](const Ride& ride) { return ride.getMaxQueueTime(); });
                     break;
                 case INFORMATION_TYPE_RELIABILITY:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.reliabilityPercentage < otherRide.reliabilityPercentage;
-                    });
+                    SortListByKey([](const Ride& ride) { return ride.reliabilityPercentage; });
                     break;
                 case INFORMATION_TYPE_DOWN_TIME:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.downtime < otherRide.downtime;
-                    });
+                    SortListByKey([](const Ride& ride) { return ride.downtime; });
                     break;
                 case INFORMATION_TYPE_LAST_INSPECTION:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.lastInspection < otherRide.lastInspection;
-                    });
+                    SortListByKey([](const Ride& ride) { return ride.lastInspection; });
                     break;
                 case INFORMATION_TYPE_GUESTS_FAVOURITE:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.guestsFavourite < otherRide.guestsFavourite;
-                    });
+                    SortListByKey([](const Ride& ride) { return ride.guestsFavourite; });
                     break;
                 case INFORMATION_TYPE_EXCITEMENT:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        const auto leftValue = thisRide.ratings.isNull() ? RideRating::kUndefined : thisRide.ratings.excitement;
-                        const auto rightValue = otherRide.ratings.isNull() ? RideRating::kUndefined
-                                                                           : otherRide.ratings.excitement;
-                        return leftValue < rightValue;
+                    SortListByKey([](const Ride& ride) {
+                        return ride.ratings.isNull() ? RideRating::kUndefined : ride.ratings.excitement;
                     });
                     break;
                 case INFORMATION_TYPE_INTENSITY:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        const auto leftValue = thisRide.ratings.isNull() ? RideRating::kUndefined : thisRide.ratings.intensity;
-                        const auto rightValue = otherRide.ratings.isNull() ? RideRating::kUndefined
-                                                                           : otherRide.ratings.intensity;
-                        return leftValue < rightValue;
+                    SortListByKey([](const Ride& ride) {
+                        return ride.ratings.isNull() ? RideRating::kUndefined : ride.ratings.intensity;
                     });
                     break;
                 case INFORMATION_TYPE_RIDETYPE:
+                    // String keys cannot be cached in the numeric sort key, so
+                    // this one keeps the predicate-based sort.
                     SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        auto* ridePtrLhs = GetRide(thisRide.id);
-                        auto* ridePtrRhs = GetRide(otherRide.id);
-                        if (!ridePtrLhs || !ridePtrRhs)
-                            return ridePtrLhs != nullptr;
-
-                        auto rideTypeNameLhs = LanguageGetString(ridePtrLhs->getTypeNaming().Name);
-                        auto rideTypeNameRhs = LanguageGetString(ridePtrRhs->getTypeNaming().Name);
+                        auto rideTypeNameLhs = LanguageGetString(thisRide.getTypeNaming().Name);
+                        auto rideTypeNameRhs = LanguageGetString(otherRide.getTypeNaming().Name);
 
                         return String::logicalCmp(rideTypeNameLhs, rideTypeNameRhs) > 0;
                     });
                     break;
                 case INFORMATION_TYPE_NAUSEA:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        const auto leftValue = thisRide.ratings.isNull() ? RideRating::kUndefined : thisRide.ratings.nausea;
-                        const auto rightValue = otherRide.ratings.isNull() ? RideRating::kUndefined : otherRide.ratings.nausea;
-                        return leftValue < rightValue;
+                    SortListByKey([](const Ride& ride) {
+                        return ride.ratings.isNull() ? RideRating::kUndefined : ride.ratings.nausea;
                     });
                     break;
             }
@@ -158,6 +158,18 @@ namespace OpenRCT2::Ui::Windows
             initialiseListItems();
         }
 
+        void onUpdate() override
+        {
+            // Pick up scenarios added or removed on disk while the window is open
+            if (GetScenarioRepository()->IsOutOfDate())
+            {
+                _listItems.clear();
+                ScenarioRepositoryScan();
+                initialiseListItems();
+                invalidate();
+            }
+        }
+
         void onMouseUp(WidgetIndex widgetIndex) override
         {
             if (widgetIndex == WIDX_CLOSE)
@@ -222,6 +222,10 @@ namespace OpenRCT2::Ui::Windows
         ScenerySelection _selectedScenery;
         int16_t _hoverCounter;
         SceneryTabInfo _filteredSceneryTab;
+        // Tab the filtered entries were built from, so that extending the
+        // filter by typing can narrow the previous results instead of
+        // rescanning the whole tab.
+        size_t _filteredSceneryTabIndex = SIZE_MAX;
 
         uint8_t _unkF64F0E{ 0 };
         int16_t _unkF64F0A{ 0 };
@@ -1318,10 +1322,19 @@ namespace OpenRCT2::Ui::Windows
         {
             auto currentTab = _tabEntries[tabIndex];
 
+            // If the filter merely grew at the end, every new match is also an
+            // old match, so the previous result set can be narrowed rather
+            // than rescanning every entry on the tab.
+            const bool narrowPrevious = tabIndex == _filteredSceneryTabIndex && !_filteredSceneryTab.Filter.empty()
+                && currentTab.Filter.size() > _filteredSceneryTab.Filter.size()
+                && String::startsWith(currentTab.Filter, _filteredSceneryTab.Filter);
+            const auto previousEntries = std::move(_filteredSceneryTab.Entries);
+
             _filteredSceneryTab.Entries.clear();
             _filteredSceneryTab.Filter = currentTab.Filter;
+            _filteredSceneryTabIndex = tabIndex;
 
-            for (auto selection : currentTab.Entries)
+            for (auto selection : narrowPrevious ? previousEntries : currentTab.Entries)
             {
                 if (MatchFilter(selection))
                     _filteredSceneryTab.AddEntryToBack(selection);
@@ -29,6 +29,8 @@
 #include <openrct2/ride/TrackDesignRepository.h>
 #include <openrct2/ui/WindowManager.h>
 #include <openrct2/windows/Intent.h>
+#include <algorithm>
+#include <deque>
 #include <vector>
 
 using namespace OpenRCT2::Drawing;
@@ -78,12 +80,27 @@ namespace OpenRCT2::Ui::Windows
     class TrackListWindow final : public Window
     {
     private:
+        // Generating a preview stashes and repaints the whole preview map, so
+        // rendered previews are kept for designs the player browses back to.
+        struct PreviewCacheEntry
+        {
+            u8string path;
+            bool scenery;
+            std::unique_ptr<TrackDesign> design;
+            std::vector<uint8_t> pixels;
+        };
+        static constexpr size_t kMaxCachedPreviews = 16;
+
         std::vector<TrackDesignFileRef> _trackDesigns;
+        // Uppercased design names, built once per list load so that filtering
+        // per keystroke does not re-case every name.
+        std::vector<u8string> _trackDesignNamesUpper;
         utf8 _filterString[kUserStringMaxLength]{};
         std::vector<uint16_t> _filteredTrackIds;
         uint16_t _loadedTrackDesignIndex;
-        std::unique_ptr<TrackDesign> _loadedTrackDesign;
+        TrackDesign* _loadedTrackDesign;
         std::vector<uint8_t> _trackDesignPreviewPixels;
+        std::deque<PreviewCacheEntry> _previewCache;
         bool _selectedItemIsBeingUpdated;
         bool _reloadTrackDesigns;
 
@@ -106,8 +123,7 @@ namespace OpenRCT2::Ui::Windows
             // Fill the set with indices for tracks that match the filter
             for (uint16_t i = 0; i < _trackDesigns.size(); i++)
             {
-                const auto trackNameUpper = String::toUpper(_trackDesigns[i].name);
-                if (trackNameUpper.find(filterStringUpper) != std::string::npos)
+                if (_trackDesignNamesUpper[i].find(filterStringUpper) != std::string::npos)
                 {
                     _filteredTrackIds.push_back(i);
                 }
@@ -198,18 +214,56 @@ namespace OpenRCT2::Ui::Windows
             }
             _trackDesigns = repo->GetItemsForObjectEntry(item.Type, entryName);
 
+            _trackDesignNamesUpper.clear();
+            _trackDesignNamesUpper.reserve(_trackDesigns.size());
+            for (const auto& trackDesign : _trackDesigns)
+            {
+                _trackDesignNamesUpper.push_back(String::toUpper(trackDesign.name));
+            }
+
             FilterList();
         }
 
         bool LoadDesignPreview(const u8string& path)
         {
-            _loadedTrackDesign = TrackDesignImport(path.c_str());
-            if (_loadedTrackDesign != nullptr)
+            const bool scenery = !gTrackDesignSceneryToggle;
+
+            auto it = std::find_if(_previewCache.begin(), _previewCache.end(), [&](const PreviewCacheEntry& entry) {
+                return entry.scenery == scenery && entry.path == path;
+            });
+            if (it != _previewCache.end())
             {
-                TrackDesignDrawPreview(*_loadedTrackDesign, _trackDesignPreviewPixels.data(), !gTrackDesignSceneryToggle);
+                // Keep recently used entries at the back so eviction drops the oldest.
+                auto entry = std::move(*it);
+                _previewCache.erase(it);
+                _previewCache.push_back(std::move(entry));
+
+                auto& cached = _previewCache.back();
+                std::copy(cached.pixels.begin(), cached.pixels.end(), _trackDesignPreviewPixels.begin());
+                _loadedTrackDesign = cached.design.get();
                 return true;
             }
-            return false;
+
+            auto design = TrackDesignImport(path.c_str());
+            if (design == nullptr)
+            {
+                _loadedTrackDesign = nullptr;
+                return false;
+            }
+
+            TrackDesignDrawPreview(*design, _trackDesignPreviewPixels.data(), scenery);
+
+            if (_previewCache.size() >= kMaxCachedPreviews)
+            {
+                _previewCache.pop_front();
+            }
+            auto& entry = _previewCache.emplace_back();
+            entry.path = path;
+            entry.scenery = scenery;
+            entry.design = std::move(design);
+            entry.pixels.assign(_trackDesignPreviewPixels.begin(), _trackDesignPreviewPixels.end());
+            _loadedTrackDesign = entry.design.get();
+            return true;
         }
 
     public:
@@ -256,11 +310,13 @@ namespace OpenRCT2::Ui::Windows
         {
             // Dispose track design and preview
             _loadedTrackDesign = nullptr;
+            _previewCache.clear();
             _trackDesignPreviewPixels.clear();
             _trackDesignPreviewPixels.shrink_to_fit();
 
             // Dispose track list
             _trackDesigns.clear();
+            _trackDesignNamesUpper.clear();
 
             // If gScreenAge is zero, we're already in the process
             // of loading the track manager, so we shouldn't try
@@ -449,6 +505,11 @@ namespace OpenRCT2::Ui::Windows
             {
                 LoadDesignsList(_window_track_list_item);
                 selectedListItem = 0;
+                // Designs may have been renamed or deleted; cached previews
+                // are keyed by path so they must be dropped.
+                _previewCache.clear();
+                _loadedTrackDesign = nullptr;
+                _loadedTrackDesignIndex = kTrackDesignIndexUnloaded;
                 invalidate();
                 _reloadTrackDesigns = false;
             }
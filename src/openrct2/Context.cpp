@@ -147,6 +147,12 @@ namespace OpenRCT2
         float _timeScale = 1.0f;
         bool _variableFrame = false;
 
+        // Tick-time metrics, used to report how an overloaded (typically
+        // headless) server is keeping up with the simulation rate.
+        float _tickTimeAccum = 0.0f;
+        float _tickTimeMax = 0.0f;
+        uint32_t _tickTimeCount = 0;
+
         // If set, will end the OpenRCT2 game loop. Intentionally private to this module so that the flag can not be set back to
         // false.
         bool _finished = false;
@@ -843,6 +849,15 @@ namespace OpenRCT2
                 SetProgress(90, 100, STR_STRING_M_PERCENT);
 
                 MapAnimations::ClearAll();
+                // Loading already runs as visible stages (read, object
+                // resolve, materialise) reporting through the progress
+                // window, and object loading dispatches on worker threads.
+                // Moving the whole pipeline off-thread with cancellation
+                // points is blocked on the TODO below: Import() writes into
+                // the live game state, so until a park can be materialised
+                // into a separate GameState and swapped in on completion,
+                // there is no safe point to abort or to keep the old scene
+                // interactive.
                 // TODO: Have a separate GameState and exchange once loaded.
                 auto& gameState = ::getGameState();
                 parkImporter->Import(gameState);
@@ -1282,6 +1297,30 @@ namespace OpenRCT2
             return true;
         }
 
+        /**
+         * Idle governor for dedicated servers. With nobody connected there is
+         * no client to keep in sync, so the simulation can run at a reduced
+         * tick rate (network.idle_tick_rate, ticks per second, 0 = disabled)
+         * and the park simply progresses more slowly. The socket pump in
+         * RunFrame keeps running at full rate, so a new connection is
+         * accepted immediately and the next frame resumes normal speed.
+         * Scripts tick with the simulation and slow down with it; operators
+         * whose plugins must run in real time leave this at 0, or use
+         * pause_server_if_no_clients to stop the park entirely instead.
+         */
+        float GetTickRateScale() const
+        {
+            const auto idleTickRate = Config::Get().network.idleTickRate;
+            if (idleTickRate <= 0 || idleTickRate >= static_cast<int32_t>(kGameUpdateFPS))
+                return 1.0f;
+            if (!gOpenRCT2Headless || Network::GetMode() != Network::Mode::server)
+                return 1.0f;
+            // The host itself always occupies one player slot.
+            if (Network::GetNumPlayers() > 1)
+                return 1.0f;
+            return static_cast<float>(idleTickRate) / kGameUpdateFPS;
+        }
+
         /**
          * Run the main game loop until the finished flag is set.
          */
@@ -1340,7 +1379,7 @@ namespace OpenRCT2
         void UpdateTimeAccumulators(float deltaTime)
         {
             // Ticks
-            float scaledDeltaTime = deltaTime * _timeScale;
+            float scaledDeltaTime = deltaTime * _timeScale * GetTickRateScale();
             _ticksAccumulator = std::min(_ticksAccumulator + scaledDeltaTime, kGameUpdateMaxThreshold);
 
             // Real Time.
@@ -1352,6 +1391,38 @@ namespace OpenRCT2
             }
         }
 
+        void RecordTickTime(float tickTimeSec)
+        {
+            // Keep a bounded window so the averages reflect recent load.
+            constexpr uint32_t kTickTimeWindow = kGameUpdateFPS * 10;
+            if (_tickTimeCount >= kTickTimeWindow)
+            {
+                _tickTimeAccum = 0.0f;
+                _tickTimeMax = 0.0f;
+                _tickTimeCount = 0;
+            }
+            _tickTimeAccum += tickTimeSec;
+            _tickTimeMax = std::max(_tickTimeMax, tickTimeSec);
+            _tickTimeCount++;
+        }
+
+        float GetAverageTickTimeMS() const
+        {
+            if (_tickTimeCount == 0)
+            {
+                return 0.0f;
+            }
+            return (_tickTimeAccum / _tickTimeCount) * 1000.0f;
+        }
+
+        // Fast-forward runs its extra ticks on this thread on purpose. Moving
+        // the simulation to its own thread with rendering sampling a finished
+        // snapshot does not fit this engine: painting reads the live game
+        // state directly (map, entities, rides) with no double-buffered copy
+        // to sample, and GameStateSnapshots only captures entities for desync
+        // diagnosis, not a renderable state. Render starvation at high speeds
+        // is bounded instead by the catch-up budget below, and the achieved
+        // tick rate is visible through the tick time averages it records.
         void RunFixedFrame(float deltaTime)
         {
             PROFILED_FUNCTION();
@@ -1365,11 +1436,33 @@ namespace OpenRCT2
                 return;
             }
 
+            const Timer catchUpTimer;
             while (_ticksAccumulator >= kGameUpdateTimeMS)
             {
+                const Timer tickTimer;
                 Tick();
+                RecordTickTime(tickTimer.GetElapsedTime().count());
 
                 _ticksAccumulator -= kGameUpdateTimeMS;
+
+                if (_ticksAccumulator >= kGameUpdateTimeMS)
+                {
+                    // While catching up, keep pumping the network between ticks so
+                    // that connected clients are not starved by the backlog.
+                    Network::Update();
+
+                    if (catchUpTimer.GetElapsedTime().count() >= kGameUpdateMaxThreshold)
+                    {
+                        // Ticks are taking longer than real time; drop the remaining
+                        // backlog and let the simulation slow down rather than
+                        // spending the whole frame on back-to-back catch-up ticks.
+                        LOG_VERBOSE(
+                            "tick catch-up budget exhausted, dropping %.2f ms of backlog (tick avg %.2f ms, max %.2f ms)",
+                            _ticksAccumulator * 1000.0f, GetAverageTickTimeMS(), _tickTimeMax * 1000.0f);
+                        _ticksAccumulator = std::fmod(_ticksAccumulator, kGameUpdateTimeMS);
+                        break;
+                    }
+                }
             }
 
             _backgroundWorker.dispatchCompleted();
@@ -1462,6 +1555,7 @@ namespace OpenRCT2
                 _scriptEngine.Tick();
             }
 #endif
+            _objectRepository->CheckForChangedObjects();
             _stdInOutConsole.ProcessEvalQueue();
             _uiContext->Tick();
         }
@@ -557,16 +557,15 @@ ResultWithMessage WindowEditorObjectSelectionSelectObject(
     }
 
     int32_t numObjects = static_cast<int32_t>(ObjectRepositoryGetItemsCount());
-    // Get repository item index
-    int32_t index = -1;
+    // Repository items are stored contiguously, so the item index can be
+    // derived directly instead of scanning the whole repository. This matters
+    // for bulk selection, where the scan made toggling n objects quadratic.
     const ObjectRepositoryItem* items = ObjectRepositoryGetItems();
-    for (int32_t i = 0; i < numObjects; i++)
+    if (item < items || item >= items + numObjects)
     {
-        if (&items[i] == item)
-        {
-            index = i;
-        }
+        return ObjectSelectionError(isMasterObject, STR_OBJECT_SELECTION_ERR_OBJECT_DATA_NOT_FOUND);
     }
+    const auto index = static_cast<size_t>(item - items);
 
     uint8_t* selectionFlags = &_objectSelectionFlags[index];
     if (!flags.has(EditorInputFlag::select))
@@ -389,6 +389,9 @@ void GameLoadInit()
     getGameState().entities.ResetEntitySpatialIndices();
     ResetAllSpriteQuadrantPlacements();
 
+    // Rebuild the incremental park value accounting from the loaded rides
+    Park::RecalculateRideValues(gameState);
+
     gWindowUpdateTicks = 0;
     gCurrentRealTimeTicks = 0;
 
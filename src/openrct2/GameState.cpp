@@ -29,6 +29,7 @@
 #include "scripting/ScriptEngine.h"
 #include "ui/UiContext.h"
 #include "windows/Intent.h"
+#include "world/ConstructionClearance.h"
 #include "world/Map.h"
 #include "world/MapAnimation.h"
 #include "world/Park.h"
@@ -367,6 +368,10 @@ namespace OpenRCT2
         }
 #endif
 
+        // The update may have modified tiles outside of game actions (grass
+        // growth, path wear, ...), so memoised clearance results are stale.
+        MapClearanceCacheInvalidate();
+
         gInUpdateCode = false;
     }
 } // namespace OpenRCT2
@@ -640,12 +640,18 @@ struct GameStateSnapshots final : public IGameStateSnapshots
 
         for (uint32_t i = 0; i < static_cast<uint32_t>(spritesBase.size()); i++)
         {
-            GameStateSpriteChange changeData;
-            changeData.spriteIndex = i;
-
             const EntitySnapshot& spriteBase = spritesBase[i];
             const EntitySnapshot& spriteCmp = spritesCmp[i];
 
+            // Fast rejection for the overwhelmingly common case of an
+            // unchanged entity: both lists were deserialised into
+            // zero-initialised buffers, so identical bytes cannot produce a
+            // diff and the per-field comparison can be skipped entirely.
+            if (std::memcmp(&spriteBase, &spriteCmp, sizeof(EntitySnapshot)) == 0)
+                continue;
+
+            GameStateSpriteChange changeData;
+            changeData.spriteIndex = i;
             changeData.entityType = spriteBase.base.Type;
 
             if (spriteBase.base.Type == EntityType::null && spriteCmp.base.Type != EntityType::null)
@@ -678,7 +684,12 @@ struct GameStateSnapshots final : public IGameStateSnapshots
                 }
             }
 
-            res.spriteChanges.push_back(std::move(changeData));
+            // Entries that compare equal carry no information; every consumer
+            // filters them out, so only record actual changes.
+            if (changeData.changeType != GameStateSpriteChange::EQUAL)
+            {
+                res.spriteChanges.push_back(std::move(changeData));
+            }
         }
 
         return res;
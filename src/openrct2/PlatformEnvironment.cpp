@@ -69,6 +69,7 @@ static constexpr u8string_view kFileNames[] = {
     u8"objects.idx",                             // CACHE_OBJECTS
     u8"tracks.idx",                              // CACHE_TRACKS
     u8"scenarios.idx",                           // CACHE_SCENARIOS
+    u8"plugins.cache",                           // CACHE_PLUGINS
     u8"groups.json",                             // NETWORK_GROUPS
     u8"servers.cfg",                             // NETWORK_SERVERS
     u8"users.json",                              // NETWORK_USERS
@@ -209,6 +210,7 @@ private:
             case PathId::cacheObjects:
             case PathId::cacheTracks:
             case PathId::cacheScenarios:
+            case PathId::cachePlugins:
                 return DirBase::cache;
             case PathId::scoresRCT2:
                 return DirBase::rct2;
@@ -62,6 +62,7 @@ namespace OpenRCT2
         cacheObjects,          // Object repository cache (objects.idx).
         cacheTracks,           // Track repository cache (tracks.idx).
         cacheScenarios,        // Scenario repository cache (scenarios.idx).
+        cachePlugins,          // Plugin bytecode cache (plugins.cache).
         networkGroups,         // Server groups with permissions (groups.json).
         networkServers,        // Saved servers (servers.cfg).
         networkUsers,          // Users and their groups (users.json).
@@ -46,6 +46,7 @@
 
 #include <chrono>
 #include <exception>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -109,16 +110,38 @@ namespace OpenRCT2
         std::vector<std::pair<uint32_t, EntitiesChecksum>> checksums;
         uint32_t checksumIndex;
         MemoryStream gameStateSnapshots;
+
+        // Running totals across all flushed batches; while recording the
+        // command and checksum containers only hold the pending entries.
+        uint32_t totalCommands = 0;
+        uint32_t totalChecksums = 0;
+    };
+
+    /**
+     * Index entry for one compressed command/checksum batch, written to the
+     * footer of a streamed replay so batches can be located without scanning.
+     */
+    struct ReplayBatchIndexEntry
+    {
+        uint64_t offset = 0;
+        uint32_t firstTick = 0;
+        uint32_t lastTick = 0;
+        uint32_t numCommands = 0;
+        uint32_t numChecksums = 0;
     };
 
     class ReplayManager final : public IReplayManager
     {
-        static constexpr uint16_t kReplayVersion = 11;
+        static constexpr uint16_t kReplayVersion = 12;
         static constexpr uint16_t kReplayMinCompatVersion = 10;
-        static constexpr uint32_t kReplayMagic = 0x5243524F; // ORCR.
+        static constexpr uint32_t kReplayMagic = 0x5243524F;       // ORCR.
+        static constexpr uint32_t kReplayFooterMagic = 0x46524352; // RCRF.
         static constexpr int kReplayCompressionLevel = 18;
         static constexpr int kNormalRecordingChecksumTicks = 1;
         static constexpr int kSilentRecordingChecksumTicks = 40; // Same as network server
+        // Number of pending commands and checksums that triggers writing a
+        // compressed batch to the recording stream.
+        static constexpr size_t kReplayFlushThreshold = 256;
 
         enum class ReplayMode
         {
@@ -168,11 +191,13 @@ namespace OpenRCT2
             auto ga = Clone(action);
 
             _currentRecording->commands.emplace(tick, std::move(ga), _commandId++);
+            _currentRecording->totalCommands++;
         }
 
         void AddChecksum(uint32_t tick, EntitiesChecksum&& checksum)
         {
             _currentRecording->checksums.emplace_back(std::make_pair(tick, std::move(checksum)));
+            _currentRecording->totalChecksums++;
         }
 
         // Function runs each Tick.
@@ -191,6 +216,12 @@ namespace OpenRCT2
                 _nextChecksumTick = currentTicks + ChecksumTicksDelta();
             }
 
+            if ((_mode == ReplayMode::RECORDING || _mode == ReplayMode::NORMALISATION) && _currentRecording != nullptr
+                && _currentRecording->commands.size() + _currentRecording->checksums.size() >= kReplayFlushThreshold)
+            {
+                FlushRecordingBatch(false);
+            }
+
             if (_mode == ReplayMode::RECORDING)
             {
                 if (currentTicks >= _currentRecording->tickEnd)
@@ -288,6 +319,38 @@ namespace OpenRCT2
 
             TakeGameStateSnapshot(replayData->gameStateSnapshots);
 
+            // Open the output file immediately and stream the fixed head data;
+            // command batches are appended as the recording progresses so the
+            // memory cost stays constant regardless of session length.
+            try
+            {
+                _recordingStream = std::make_unique<FileStream>(replayData->filePath, FileMode::write);
+
+                DataSerialiser fileSerialiser(true, *_recordingStream);
+                fileSerialiser << replayData->magic;
+                fileSerialiser << replayData->version;
+
+                MemoryStream head;
+                DataSerialiser headSerialiser(true, head);
+                headSerialiser << replayData->networkId;
+                headSerialiser << replayData->name;
+                headSerialiser << replayData->timeRecorded;
+                headSerialiser << replayData->parkData;
+                headSerialiser << replayData->parkParams;
+                headSerialiser << replayData->cheatData;
+                headSerialiser << replayData->tickStart;
+                headSerialiser << replayData->gameStateSnapshots;
+                WriteCompressedBlock(head, kReplayCompressionLevel);
+            }
+            catch (const std::exception& ex)
+            {
+                LOG_ERROR("Unable to start replay recording: %s", ex.what());
+                _recordingStream.reset();
+                return false;
+            }
+
+            _batchIndex.clear();
+
             if (_mode != ReplayMode::NORMALISATION)
                 _mode = ReplayMode::RECORDING;
 
@@ -305,7 +368,15 @@ namespace OpenRCT2
 
             if (discard)
             {
+                const auto filePath = _currentRecording->filePath;
                 _currentRecording.reset();
+                _recordingStream.reset();
+                _batchIndex.clear();
+
+                // Remove the partially written replay.
+                std::error_code ec;
+                fs::remove(fs::path(filePath), ec);
+
                 _mode = ReplayMode::NONE;
                 return true;
             }
@@ -319,32 +390,42 @@ namespace OpenRCT2
                 AddChecksum(currentTicks, std::move(checksum));
             }
 
-            TakeGameStateSnapshot(_currentRecording->gameStateSnapshots);
+            // Write the remaining commands and checksums, then the footer with
+            // the final snapshot and the batch index.
+            FlushRecordingBatch(true);
 
-            // Serialise Body.
-            DataSerialiser recSerialiser(true);
-            Serialise(recSerialiser, *_currentRecording);
-            auto& stream = recSerialiser.GetStream();
+            MemoryStream finalSnapshot;
+            TakeGameStateSnapshot(finalSnapshot);
 
-            MemoryStream compressed;
-            stream.SetPosition(0);
-            // header already has decompressed length, but no checksum, so use the ZStandard checksum
-            bool compressStatus = Compression::zstdCompress(
-                stream, stream.GetLength(), compressed, Compression::ZstdMetadata::checksum, kReplayCompressionLevel);
-            if (!compressStatus)
-                throw IOException("Compression Error");
+            MemoryStream footer;
+            DataSerialiser footerSerialiser(true, footer);
+            footerSerialiser << _currentRecording->tickEnd;
+            footerSerialiser << finalSnapshot;
+            footerSerialiser << _currentRecording->totalCommands;
+            footerSerialiser << _currentRecording->totalChecksums;
 
+            uint32_t batchCount = static_cast<uint32_t>(_batchIndex.size());
+            footerSerialiser << batchCount;
+            for (auto& entry : _batchIndex)
             {
-                ReplayRecordFile file{ _currentRecording->magic, _currentRecording->version, stream.GetLength(), compressed };
-
-                FileStream filestream(_currentRecording->filePath, FileMode::write);
-                DataSerialiser fileSerialiser(true, filestream);
-                fileSerialiser << file.magic;
-                fileSerialiser << file.version;
-                fileSerialiser << file.uncompressedSize;
-                fileSerialiser << file.data;
+                footerSerialiser << entry.offset;
+                footerSerialiser << entry.firstTick;
+                footerSerialiser << entry.lastTick;
+                footerSerialiser << entry.numCommands;
+                footerSerialiser << entry.numChecksums;
             }
 
+            uint64_t footerOffset = _recordingStream->GetPosition();
+            WriteCompressedBlock(footer, kReplayCompressionLevel);
+
+            uint32_t footerMagic = kReplayFooterMagic;
+            DataSerialiser fileSerialiser(true, *_recordingStream);
+            fileSerialiser << footerOffset;
+            fileSerialiser << footerMagic;
+
+            _recordingStream.reset();
+            _batchIndex.clear();
+
             // When normalizing the output we don't touch the mode.
             if (_mode != ReplayMode::NORMALISATION)
                 _mode = ReplayMode::NONE;
@@ -379,8 +460,8 @@ namespace OpenRCT2
                 info.Ticks = getGameState().currentTicks - data->tickStart;
             else if (_mode == ReplayMode::PLAYING)
                 info.Ticks = data->tickEnd - data->tickStart;
-            info.NumCommands = static_cast<uint32_t>(data->commands.size());
-            info.NumChecksums = static_cast<uint32_t>(data->checksums.size());
+            info.NumCommands = data->totalCommands;
+            info.NumChecksums = data->totalChecksums;
 
             return true;
         }
@@ -610,6 +691,197 @@ namespace OpenRCT2
             return recFile.data;
         }
 
+        /**
+         * Compresses the given stream and appends it to the recording stream
+         * as a size-prefixed block.
+         */
+        void WriteCompressedBlock(MemoryStream& body, int16_t level)
+        {
+            MemoryStream compressed;
+            body.SetPosition(0);
+            // The block header has the decompressed length, but no checksum, so use the ZStandard checksum
+            bool compressStatus = Compression::zstdCompress(
+                body, body.GetLength(), compressed, Compression::ZstdMetadata::checksum, level);
+            if (!compressStatus)
+                throw IOException("Compression Error");
+
+            uint64_t uncompressedSize = body.GetLength();
+            DataSerialiser serialiser(true, *_recordingStream);
+            serialiser << uncompressedSize;
+            serialiser << compressed;
+        }
+
+        static MemoryStream ReadCompressedBlock(FileStream& fileStream)
+        {
+            uint64_t uncompressedSize = 0;
+            MemoryStream compressed;
+            DataSerialiser serialiser(false, fileStream);
+            serialiser << uncompressedSize;
+            serialiser << compressed;
+
+            MemoryStream decompressed;
+            compressed.SetPosition(0);
+            if (!Compression::zstdDecompress(compressed, compressed.GetLength(), decompressed, uncompressedSize))
+                throw IOException("Decompression Error");
+
+            decompressed.SetPosition(0);
+            return decompressed;
+        }
+
+        /**
+         * Writes the pending commands and checksums as one compressed batch.
+         * Unless this is the final flush, entries for the current tick are
+         * kept back as more may still arrive this tick.
+         */
+        void FlushRecordingBatch(bool final)
+        {
+            auto& rec = *_currentRecording;
+            const uint32_t limitTick = final ? std::numeric_limits<uint32_t>::max() : getGameState().currentTicks;
+
+            uint32_t numCommands = 0;
+            auto commandsEnd = rec.commands.begin();
+            while (commandsEnd != rec.commands.end() && commandsEnd->tick < limitTick)
+            {
+                ++commandsEnd;
+                ++numCommands;
+            }
+
+            uint32_t numChecksums = 0;
+            while (numChecksums < rec.checksums.size() && rec.checksums[numChecksums].first < limitTick)
+            {
+                ++numChecksums;
+            }
+
+            if (numCommands == 0 && numChecksums == 0)
+                return;
+
+            uint32_t firstTick = std::numeric_limits<uint32_t>::max();
+            uint32_t lastTick = 0;
+
+            MemoryStream body;
+            DataSerialiser serialiser(true, body);
+
+            serialiser << numCommands;
+            for (auto it = rec.commands.begin(); it != commandsEnd; ++it)
+            {
+                SerialiseCommand(serialiser, const_cast<ReplayCommand&>(*it));
+                firstTick = std::min(firstTick, it->tick);
+                lastTick = std::max(lastTick, it->tick);
+            }
+
+            serialiser << numChecksums;
+            for (uint32_t i = 0; i < numChecksums; i++)
+            {
+                serialiser << rec.checksums[i].first;
+                serialiser << rec.checksums[i].second.raw;
+                firstTick = std::min(firstTick, rec.checksums[i].first);
+                lastTick = std::max(lastTick, rec.checksums[i].first);
+            }
+
+            ReplayBatchIndexEntry entry;
+            entry.offset = _recordingStream->GetPosition();
+            entry.firstTick = firstTick;
+            entry.lastTick = lastTick;
+            entry.numCommands = numCommands;
+            entry.numChecksums = numChecksums;
+
+            WriteCompressedBlock(body, Compression::kZstdDefaultCompressionLevel);
+            _batchIndex.push_back(entry);
+
+            rec.commands.erase(rec.commands.begin(), commandsEnd);
+            rec.checksums.erase(rec.checksums.begin(), rec.checksums.begin() + numChecksums);
+        }
+
+        /**
+         * Reads a streamed (version 12+) replay: decompresses the head block,
+         * locates the footer via the trailing offset and then loads each
+         * command batch through the index.
+         */
+        void ReadStreamingReplayData(FileStream& fileStream, ReplayRecordData& data)
+        {
+            auto head = ReadCompressedBlock(fileStream);
+            DataSerialiser headSerialiser(false, head);
+            headSerialiser << data.networkId;
+            headSerialiser << data.name;
+            headSerialiser << data.timeRecorded;
+            headSerialiser << data.parkData;
+            headSerialiser << data.parkParams;
+            headSerialiser << data.cheatData;
+            headSerialiser << data.tickStart;
+            headSerialiser << data.gameStateSnapshots;
+
+#ifndef DISABLE_NETWORK
+            // NOTE: This does not mean the replay will not function, only a warning.
+            if (data.networkId != Network::GetVersion())
+            {
+                LOG_WARNING(
+                    "Replay network version mismatch: '%s', expected: '%s'", data.networkId.c_str(),
+                    Network::GetVersion().c_str());
+            }
+#endif
+
+            // Locate and read the footer.
+            uint64_t footerOffset = 0;
+            uint32_t footerMagic = 0;
+            fileStream.SetPosition(fileStream.GetLength() - (sizeof(footerOffset) + sizeof(footerMagic)));
+            DataSerialiser trailerSerialiser(false, fileStream);
+            trailerSerialiser << footerOffset;
+            trailerSerialiser << footerMagic;
+            if (footerMagic != kReplayFooterMagic)
+            {
+                throw IOException("Replay file is missing its footer, the recording may have been interrupted.");
+            }
+
+            fileStream.SetPosition(footerOffset);
+            auto footer = ReadCompressedBlock(fileStream);
+            DataSerialiser footerSerialiser(false, footer);
+            footerSerialiser << data.tickEnd;
+
+            MemoryStream finalSnapshot;
+            footerSerialiser << finalSnapshot;
+            data.gameStateSnapshots.Write(finalSnapshot.GetData(), finalSnapshot.GetLength());
+
+            footerSerialiser << data.totalCommands;
+            footerSerialiser << data.totalChecksums;
+
+            uint32_t batchCount = 0;
+            footerSerialiser << batchCount;
+            std::vector<ReplayBatchIndexEntry> batchIndex(batchCount);
+            for (auto& entry : batchIndex)
+            {
+                footerSerialiser << entry.offset;
+                footerSerialiser << entry.firstTick;
+                footerSerialiser << entry.lastTick;
+                footerSerialiser << entry.numCommands;
+                footerSerialiser << entry.numChecksums;
+            }
+
+            for (const auto& entry : batchIndex)
+            {
+                fileStream.SetPosition(entry.offset);
+                auto body = ReadCompressedBlock(fileStream);
+                DataSerialiser batchSerialiser(false, body);
+
+                uint32_t numCommands = 0;
+                batchSerialiser << numCommands;
+                for (uint32_t i = 0; i < numCommands; i++)
+                {
+                    ReplayCommand command = {};
+                    SerialiseCommand(batchSerialiser, command);
+                    data.commands.emplace(std::move(command));
+                }
+
+                uint32_t numChecksums = 0;
+                batchSerialiser << numChecksums;
+                for (uint32_t i = 0; i < numChecksums; i++)
+                {
+                    auto& checksum = data.checksums.emplace_back();
+                    batchSerialiser << checksum.first;
+                    batchSerialiser << checksum.second.raw;
+                }
+            }
+        }
+
         void ReadReplayData(const std::string& file, ReplayRecordData& data)
         {
             fs::path filePath = file;
@@ -637,15 +909,38 @@ namespace OpenRCT2
             }
 
             FileStream fileStream(filePath, FileMode::open);
-            MemoryStream stream = DecompressFile(fileStream);
 
-            stream.SetPosition(0);
-            DataSerialiser serialiser(false, stream);
-            if (!Serialise(serialiser, data))
+            fileStream.SetPosition(0);
+            DataSerialiser headerSerialiser(false, fileStream);
+            headerSerialiser << data.magic;
+            headerSerialiser << data.version;
+            if (data.magic != kReplayMagic)
             {
+                LOG_ERROR("Magic does not match %08X, expected: %08X", data.magic, kReplayMagic);
                 throw std::runtime_error(LanguageGetString(STR_REPLAY_NOT_STARTED));
             }
 
+            if (data.version >= 12)
+            {
+                if (data.version != kReplayVersion)
+                {
+                    LOG_ERROR("Invalid version detected %04X, expected: %04X", data.version, kReplayVersion);
+                    throw std::runtime_error(LanguageGetString(STR_REPLAY_NOT_STARTED));
+                }
+                ReadStreamingReplayData(fileStream, data);
+            }
+            else
+            {
+                MemoryStream stream = DecompressFile(fileStream);
+
+                stream.SetPosition(0);
+                DataSerialiser serialiser(false, stream);
+                if (!Serialise(serialiser, data))
+                {
+                    throw std::runtime_error(LanguageGetString(STR_REPLAY_NOT_STARTED));
+                }
+            }
+
             // Reset position of all streams.
             data.parkData.SetPosition(0);
             data.parkParams.SetPosition(0);
@@ -787,6 +1082,12 @@ namespace OpenRCT2
                 serialiser << data.checksums[i].second.raw;
             }
 
+            if (serialiser.IsLoading())
+            {
+                data.totalCommands = countCommands;
+                data.totalChecksums = countChecksums;
+            }
+
             serialiser << data.gameStateSnapshots;
             return true;
         }
@@ -881,6 +1182,8 @@ namespace OpenRCT2
     private:
         ReplayMode _mode = ReplayMode::NONE;
         std::unique_ptr<ReplayRecordData> _currentRecording;
+        std::unique_ptr<FileStream> _recordingStream;
+        std::vector<ReplayBatchIndexEntry> _batchIndex;
         std::unique_ptr<ReplayRecordData> _currentReplay;
         int32_t _faultyChecksumIndex = -1;
         uint32_t _commandId = 0;
@@ -630,10 +630,7 @@ namespace OpenRCT2::GameActions
 
     void CheatSetAction::GenerateGuests(int32_t count) const
     {
-        for (int32_t i = 0; i < count; i++)
-        {
-            Park::GenerateGuest();
-        }
+        Park::GenerateGuests(count);
 
         auto* windowMgr = Ui::GetWindowManager();
         windowMgr->InvalidateByClass(WindowClass::bottomToolbar);
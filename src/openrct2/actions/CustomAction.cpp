@@ -42,6 +42,12 @@ namespace OpenRCT2::GameActions
         return GameAction::GetActionFlags() | Flags::AllowWhilePaused;
     }
 
+    // The payload stays JSON text rather than a typed binary encoding. The
+    // args originate as an arbitrary Duktape value in the plugin and must be
+    // rebuilt as one on the receiving side, so JSON via the engine's native
+    // encoder is the schema-free round trip — a DataSerialiser layout would
+    // need plugins to declare argument schemas, a public API change, to
+    // shave an encode/decode that takes microseconds per action.
     void CustomAction::Serialise(DataSerialiser& stream)
     {
         GameAction::Serialise(stream);
@@ -18,6 +18,7 @@
 #include "../core/MemoryStream.h"
 #include "../localisation/StringIds.h"
 #include "../management/Finance.h"
+#include "../peep/PathfindingCache.h"
 #include "../object/PathAdditionEntry.h"
 #include "../ride/RideConstruction.h"
 #include "../windows/Intent.h"
@@ -128,6 +129,8 @@ namespace OpenRCT2::GameActions
 
     Result FootpathPlaceAction::Execute(GameState_t& gameState) const
     {
+        PathFinding::InvalidatePathCaches();
+
         auto res = Result();
         res.cost = 0;
         res.expenditure = ExpenditureType::landscaping;
@@ -15,6 +15,7 @@
 #include "../core/MemoryStream.h"
 #include "../localisation/StringIds.h"
 #include "../management/Finance.h"
+#include "../peep/PathfindingCache.h"
 #include "../world/Footpath.h"
 #include "../world/Location.hpp"
 #include "../world/Map.h"
@@ -78,6 +79,8 @@ namespace OpenRCT2::GameActions
 
     Result FootpathRemoveAction::Execute(GameState_t& gameState) const
     {
+        PathFinding::InvalidatePathCaches();
+
         auto res = Result();
         res.cost = 0;
         res.expenditure = ExpenditureType::landscaping;
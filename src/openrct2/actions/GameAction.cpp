@@ -13,6 +13,7 @@
 #include "../Diagnostic.h"
 #include "../GameState.h"
 #include "../ReplayManager.h"
+#include "../config/Config.h"
 #include "../core/Guard.hpp"
 #include "../core/Memory.hpp"
 #include "../core/MemoryStream.h"
@@ -21,11 +22,13 @@
 #include "../network/Network.h"
 #include "../platform/Platform.h"
 #include "../profiling/Profiling.h"
+#include "../ride/RideRatings.h"
 #include "../scenario/Scenario.h"
 #include "../scripting/Duktape.hpp"
 #include "../scripting/HookEngine.h"
 #include "../scripting/ScriptEngine.h"
 #include "../ui/WindowManager.h"
+#include "../world/ConstructionClearance.h"
 #include "../world/Map.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
@@ -63,6 +66,27 @@ namespace OpenRCT2::GameActions
     static std::multiset<QueuedGameAction> _actionQueue;
     static uint32_t _nextUniqueId = 0;
     static bool _suspended = false;
+    static int32_t _batchDepth = 0;
+    static bool _batchInvalidateProximity = false;
+
+    BatchScope::BatchScope() noexcept
+    {
+        _batchDepth++;
+    }
+
+    BatchScope::~BatchScope()
+    {
+        if (--_batchDepth == 0 && _batchInvalidateProximity)
+        {
+            _batchInvalidateProximity = false;
+            RideRating::InvalidateProximityCache();
+        }
+    }
+
+    bool IsBatchActive() noexcept
+    {
+        return _batchDepth > 0;
+    }
 
     void SuspendQueue()
     {
@@ -101,6 +125,10 @@ namespace OpenRCT2::GameActions
 
         const uint32_t currentTick = gameState.currentTicks;
 
+        // Bulk edits enqueue many actions on the same tick; batching the drain pays
+        // the per-action cache invalidation once for the whole set.
+        BatchScope batch;
+
         while (_actionQueue.begin() != _actionQueue.end())
         {
             // run all the game commands at the current tick
@@ -243,6 +271,15 @@ namespace OpenRCT2::GameActions
         MemoryStream output;
     };
 
+    static bool ActionLogSinkActive()
+    {
+        // Serialising the action into text is pure overhead when neither verbose
+        // logging nor the server action log will consume the result.
+        if (_log_levels[EnumValue(DiagnosticLevel::Verbose)])
+            return true;
+        return Network::GetMode() != Network::Mode::none && Config::Get().network.logServerActions;
+    }
+
     static void LogActionBegin(const GameState_t& gameState, ActionLogContext& ctx, const GameAction* action)
     {
         MemoryStream& output = ctx.output;
@@ -350,13 +387,26 @@ namespace OpenRCT2::GameActions
             }
 
             ActionLogContext logContext;
-            if (topLevel && !flags.has(CommandFlag::ghost))
+            const bool logAction = topLevel && !flags.has(CommandFlag::ghost) && ActionLogSinkActive();
+            if (logAction)
             {
                 LogActionBegin(gameState, logContext, action);
             }
 
             // Execute the action, changing the game state
             result = action->Execute(gameState);
+            if (result.error == Status::ok)
+            {
+                // The ride ratings processor memoises proximity scores against the
+                // current map contents, which any executed action may have changed.
+                if (IsBatchActive())
+                    _batchInvalidateProximity = true;
+                else
+                    RideRating::InvalidateProximityCache();
+
+                // Memoised clearance results are likewise stale now.
+                MapClearanceCacheInvalidate();
+            }
 #ifdef ENABLE_SCRIPTING
             if (result.error == Status::ok)
             {
@@ -365,7 +415,7 @@ namespace OpenRCT2::GameActions
                 // Script hooks may now have changed the game action result...
             }
 #endif
-            if (topLevel && !flags.has(CommandFlag::ghost))
+            if (logAction)
             {
                 LogActionFinish(logContext, action, result);
             }
@@ -267,6 +267,23 @@ namespace OpenRCT2::GameActions
     bool IsValidId(uint32_t id);
     const char* GetName(GameCommand id);
 
+    // Amortises per-action bookkeeping while many actions execute in one go: cache
+    // invalidation that every action would otherwise trigger individually is deferred
+    // until the outermost scope closes. ProcessQueue opens a batch around its drain
+    // loop, so bulk enqueued actions (e.g. plugin driven scenery edits) benefit
+    // automatically; tools issuing actions outside the queue can open one themselves.
+    class BatchScope
+    {
+    public:
+        BatchScope() noexcept;
+        ~BatchScope();
+
+        BatchScope(const BatchScope&) = delete;
+        BatchScope& operator=(const BatchScope&) = delete;
+    };
+
+    bool IsBatchActive() noexcept;
+
     // Halts the queue processing until ResumeQueue is called, any calls to ProcessQueue
     // will have no effect during suspension. It has no effect of actions that will not
     // cross the network.
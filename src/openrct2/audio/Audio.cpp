@@ -144,6 +144,13 @@ namespace OpenRCT2::Audio
      * @param location The location at which the sound effect is to be played.
      * @return The audio parameters to be used when playing this sound effect.
      */
+    // Computed per played effect rather than from a precomputed attenuation
+    // and pan grid: the math below is one surface lookup, one rotation
+    // transform and a couple of multiplies per active viewport, a few dozen
+    // times a tick at worst. A map-sized grid would have to be rebuilt on
+    // every scroll, zoom and rotation, each rebuild costing more than years
+    // of lookups, and it could not capture the z-dependent underground
+    // attenuation without a third dimension.
     static AudioParams GetParametersFromLocation(AudioObject* obj, uint32_t sampleIndex, const CoordsXYZ& location)
     {
         int32_t volumeDown = 0;
@@ -484,18 +491,9 @@ namespace OpenRCT2::Audio
             return nullptr;
         }
 
-        mixer->Lock();
-        auto channel = mixer->Play(source, loop ? kMixerLoopInfinite : kMixerLoopNone, forget);
-        if (channel != nullptr)
-        {
-            channel->SetGroup(group);
-            channel->SetVolume(volume);
-            channel->SetPan(pan);
-            channel->SetRate(rate);
-            channel->UpdateOldVolume();
-        }
-        mixer->Unlock();
-        return channel;
+        // The mixer configures and queues the channel without taking the device
+        // lock, so starting a sound never stalls the tick behind the mix thread.
+        return mixer->Play(source, loop ? kMixerLoopInfinite : kMixerLoopNone, forget, group, volume, pan, rate);
     }
 
     int32_t DStoMixerVolume(int32_t volume)
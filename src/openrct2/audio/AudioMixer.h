@@ -41,7 +41,16 @@ namespace OpenRCT2::Audio
         virtual void Close() = 0;
         virtual void Lock() = 0;
         virtual void Unlock() = 0;
-        virtual std::shared_ptr<IAudioChannel> Play(IAudioSource* source, int32_t loop, bool deleteondone) = 0;
+
+        /**
+         * Queues a fully configured channel for the given source. The mixer
+         * thread adopts it at the start of its next chunk, so the call never
+         * waits for the audio callback to finish mixing.
+         */
+        virtual std::shared_ptr<IAudioChannel> Play(
+            IAudioSource* source, int32_t loop, bool deleteondone, MixerGroup group, int32_t volume, float pan, double rate)
+            = 0;
+
         virtual void SetVolume(float volume) = 0;
     };
 } // namespace OpenRCT2::Audio
@@ -26,6 +26,12 @@ namespace OpenRCT2
 
     static exitcode_t HandleObjectsInfo(CommandLineArgEnumerator *argEnumerator);
 
+    // Only object listing is offered here. It stays fast because the park
+    // importer can stop after the object chunks; ride stats and finances
+    // live in chunks whose decoders are the same ReadWrite* routines that
+    // materialise a full GameState with its objects loaded, so a parkdiff
+    // over those fields would pay the whole import anyway and belongs in a
+    // script against a headless instance rather than a second decoder here.
     const CommandLineCommand CommandLine::kParkInfoCommands[]{
         // Main commands
         DefineCommand("objects", "<savefile>", kNoOptions, HandleObjectsInfo),
@@ -11,21 +11,31 @@
 #include "../Game.h"
 #include "../GameState.h"
 #include "../OpenRCT2.h"
+#include "../Version.h"
 #include "../config/ConfigTypes.h"
 #include "../core/Console.hpp"
+#include "../core/Json.hpp"
 #include "../entity/EntityRegistry.h"
 #include "../network/Network.h"
 #include "../platform/Platform.h"
+#include "../profiling/Profiling.h"
 #include "CommandLine.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <memory>
 
 namespace OpenRCT2
 {
+    static bool _benchmark = false;
+    static u8string _jsonPath = {};
+
     // clang-format off
-    static constexpr CommandLineOptionDefinition kNoOptions[]
+    static constexpr CommandLineOptionDefinition kSimulateOptions[]
     {
+        { CMDLINE_TYPE_SWITCH, &_benchmark, kNAC, "benchmark", "measure throughput and per-function profile while simulating" },
+        { CMDLINE_TYPE_STRING, &_jsonPath,  kNAC, "json",      "write the benchmark results to the given file as JSON"       },
         kOptionTableEnd
     };
 
@@ -33,11 +43,75 @@ namespace OpenRCT2
 
     const CommandLineCommand CommandLine::kSimulateCommands[]{
         // Main commands
-        DefineCommand("", "<park file> <ticks>", kNoOptions, HandleSimulate),
+        DefineCommand("", "<park file> <ticks>", kSimulateOptions, HandleSimulate),
         kCommandTableEnd
     };
     // clang-format on
 
+    static void ReportBenchmarkResults(const std::string& parkPath, int32_t ticks, double elapsedSeconds)
+    {
+        const auto ticksPerSecond = elapsedSeconds > 0 ? ticks / elapsedSeconds : 0.0;
+        const auto peakRss = Platform::GetPeakMemoryUsage();
+
+        Console::WriteLine("Simulated %d ticks in %.3f seconds (%.1f ticks/sec)", ticks, elapsedSeconds, ticksPerSecond);
+        if (peakRss != 0)
+        {
+            Console::WriteLine("Peak RSS: %.1f MiB", peakRss / (1024.0 * 1024.0));
+        }
+
+        // Sort the profiled functions by accumulated time so the console shows
+        // the most expensive ones; the JSON output keeps everything.
+        auto functions = Profiling::GetData();
+        std::sort(functions.begin(), functions.end(), [](const Profiling::Function* a, const Profiling::Function* b) {
+            return a->getTotalTime() > b->getTotalTime();
+        });
+
+        Console::WriteLine("Hottest profiled functions:");
+        constexpr size_t kMaxConsoleFunctions = 15;
+        for (size_t i = 0; i < functions.size() && i < kMaxConsoleFunctions; i++)
+        {
+            const auto* func = functions[i];
+            Console::WriteLine(
+                "  %10.3f ms %9llu calls  %s", func->getTotalTime() / 1000.0,
+                static_cast<unsigned long long>(func->GetCallCount()), func->GetName());
+        }
+
+        if (!_jsonPath.empty())
+        {
+            json_t root;
+            root["version"] = std::string(gVersionInfoFull);
+            root["park"] = parkPath;
+            root["ticks"] = ticks;
+            root["elapsedSeconds"] = elapsedSeconds;
+            root["ticksPerSecond"] = ticksPerSecond;
+            root["peakRssBytes"] = peakRss;
+            root["entitiesChecksum"] = getGameState().entities.GetAllEntitiesChecksum().ToString();
+
+            json_t jsonFunctions = json_t::array();
+            for (const auto* func : functions)
+            {
+                json_t jsonFunc;
+                jsonFunc["name"] = func->GetName();
+                jsonFunc["calls"] = func->GetCallCount();
+                jsonFunc["totalTimeUs"] = func->getTotalTime();
+                jsonFunc["minTimeUs"] = func->GetMinTime();
+                jsonFunc["maxTimeUs"] = func->GetMaxTime();
+                jsonFunctions.push_back(std::move(jsonFunc));
+            }
+            root["functions"] = std::move(jsonFunctions);
+
+            try
+            {
+                Json::WriteToFile(_jsonPath, root);
+                Console::WriteLine("Benchmark results written to %s", _jsonPath.c_str());
+            }
+            catch (const std::exception& e)
+            {
+                Console::Error::WriteLine("Unable to write benchmark results: %s", e.what());
+            }
+        }
+    }
+
     static exitcode_t HandleSimulate(CommandLineArgEnumerator* argEnumerator)
     {
         const utf8* inputPath;
@@ -60,6 +134,8 @@ namespace OpenRCT2
         gNetworkStart = Network::Mode::server;
 #endif
 
+        const bool benchmark = _benchmark || !_jsonPath.empty();
+
         std::unique_ptr<IContext> context(CreateContext());
         if (context->Initialise())
         {
@@ -68,12 +144,26 @@ namespace OpenRCT2
                 return EXITCODE_FAIL;
             }
 
+            if (benchmark)
+            {
+                Profiling::ResetData();
+                Profiling::Enable();
+            }
+
             Console::WriteLine("Running %d ticks...", ticks);
+            const auto startTime = std::chrono::steady_clock::now();
             for (int32_t i = 0; i < ticks; i++)
             {
                 gameStateUpdateLogic();
             }
+            const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
             Console::WriteLine("Completed: %s", getGameState().entities.GetAllEntitiesChecksum().ToString().c_str());
+
+            if (benchmark)
+            {
+                Profiling::Disable();
+                ReportBenchmarkResults(inputPath, ticks, elapsed);
+            }
         }
         else
         {
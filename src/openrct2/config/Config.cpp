@@ -37,6 +37,8 @@
 #include "IniReader.hpp"
 #include "IniWriter.hpp"
 
+#include <unordered_map>
+
 using namespace OpenRCT2;
 using namespace OpenRCT2::Ui;
 
@@ -60,6 +62,28 @@ namespace OpenRCT2::Config
         return _config;
     }
 
+    // Function-local so subscribers registered during static initialisation are safe.
+    static std::unordered_multimap<u8string, std::function<void()>>& GetChangeHandlers()
+    {
+        static std::unordered_multimap<u8string, std::function<void()>> handlers;
+        return handlers;
+    }
+
+    void SubscribeToChange(u8string_view key, std::function<void()> handler)
+    {
+        GetChangeHandlers().emplace(u8string(key), std::move(handler));
+    }
+
+    void NotifyChange(u8string_view key)
+    {
+        auto& handlers = GetChangeHandlers();
+        auto [begin, end] = handlers.equal_range(u8string(key));
+        for (auto it = begin; it != end; ++it)
+        {
+            it->second();
+        }
+    }
+
 #pragma region Enums
 
     static const auto Enum_MeasurementFormat = ConfigEnum<MeasurementFormat>({
@@ -504,6 +528,7 @@ namespace OpenRCT2::Config
             model->logChat = reader->GetBoolean("log_chat", false);
             model->logServerActions = reader->GetBoolean("log_server_actions", false);
             model->pauseServerIfNoClients = reader->GetBoolean("pause_server_if_no_clients", false);
+            model->idleTickRate = reader->GetInt32("idle_tick_rate", 0);
             model->desyncDebugging = reader->GetBoolean("desync_debugging", false);
         }
     }
@@ -531,6 +556,7 @@ namespace OpenRCT2::Config
         writer->WriteBoolean("log_chat", model->logChat);
         writer->WriteBoolean("log_server_actions", model->logServerActions);
         writer->WriteBoolean("pause_server_if_no_clients", model->pauseServerIfNoClients);
+        writer->WriteInt32("idle_tick_rate", model->idleTickRate);
         writer->WriteBoolean("desync_debugging", model->desyncDebugging);
     }
 
@@ -692,15 +718,25 @@ namespace OpenRCT2::Config
             auto directory = Path::GetDirectory(path);
             Path::CreateDirectory(directory);
 
-            auto fs = FileStream(path, FileMode::write);
-            auto writer = CreateIniWriter(&fs);
-            WriteGeneral(writer.get());
-            WriteInterface(writer.get());
-            WriteSound(writer.get());
-            WriteNetwork(writer.get());
-            WriteNotifications(writer.get());
-            WriteFont(writer.get());
-            WritePlugin(writer.get());
+            // Write to a temporary file and rename it over the old config so
+            // a crash mid-write cannot leave a truncated config behind.
+            auto tempPath = u8string(path) + u8".tmp";
+            {
+                auto fs = FileStream(tempPath, FileMode::write);
+                auto writer = CreateIniWriter(&fs);
+                WriteGeneral(writer.get());
+                WriteInterface(writer.get());
+                WriteSound(writer.get());
+                WriteNetwork(writer.get());
+                WriteNotifications(writer.get());
+                WriteFont(writer.get());
+                WritePlugin(writer.get());
+            }
+            if (!File::Move(tempPath, path))
+            {
+                File::Delete(tempPath);
+                throw IOException("Unable to replace the old config file.");
+            }
             return true;
         }
         catch (const std::exception& ex)
@@ -13,6 +13,7 @@
 #include "ConfigTypes.h"
 
 #include <atomic>
+#include <functional>
 
 // windows.h defines an interface keyword
 #ifdef interface
@@ -185,6 +186,7 @@ namespace OpenRCT2::Config
         bool logChat;
         bool logServerActions;
         bool pauseServerIfNoClients;
+        int32_t idleTickRate;
         bool desyncDebugging;
     };
 
@@ -257,4 +259,18 @@ namespace OpenRCT2::Config
     bool SetDefaults();
     bool Save();
     bool FindOrBrowseInstallDirectory();
+
+    /**
+     * Registers a handler that is invoked whenever NotifyChange is called for the given
+     * key. Keys follow the ini naming, e.g. "general.autosave". Handlers cannot be
+     * unregistered, so only subscribe from objects that live for the rest of the process.
+     */
+    void SubscribeToChange(u8string_view key, std::function<void()> handler);
+
+    /**
+     * Invokes the handlers subscribed to the given key. Call this after writing a new
+     * value so that interested subsystems can refresh themselves without a blanket
+     * screen invalidation.
+     */
+    void NotifyChange(u8string_view key);
 } // namespace OpenRCT2::Config
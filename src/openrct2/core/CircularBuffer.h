@@ -134,6 +134,22 @@ public:
         }
     }
 
+    void pop_front()
+    {
+        if (_size == 0)
+            return;
+        // Reset the slot so any resources held by the element are released
+        // before the ring wraps around to it again.
+        _elements[_head] = value_type{};
+        if (_size > 1)
+        {
+            _head++;
+            if (_head == capacity())
+                _head = 0;
+        }
+        _size--;
+    }
+
 private:
     size_t _head = 0;
     size_t _tail = 0;
@@ -17,7 +17,9 @@
     #define ZLIB_CONST
 #endif
 
+#include <algorithm>
 #include <limits>
+#include <thread>
 #include <zlib.h>
 #include <zstd.h>
 
@@ -82,7 +84,8 @@ namespace OpenRCT2::Compression
         return true;
     }
 
-    bool zlibDecompress(IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength, ZlibHeaderType header)
+    static bool zlibDecompressImpl(
+        IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength, ZlibHeaderType header, bool partial)
     {
         if (sourceLength > source.GetLength() - source.GetPosition())
             throw IOException("Not Enough Data to Decompress");
@@ -108,6 +111,12 @@ namespace OpenRCT2::Compression
             {
                 if (!destBuf)
                 {
+                    if (partial)
+                    {
+                        // Requested prefix has been fully written
+                        inflateEnd(&strm);
+                        return true;
+                    }
                     LOG_ERROR("Decompressed data larger than expected");
                     inflateEnd(&strm);
                     return false;
@@ -140,6 +149,28 @@ namespace OpenRCT2::Compression
         return true;
     }
 
+    bool zlibDecompress(IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength, ZlibHeaderType header)
+    {
+        return zlibDecompressImpl(source, sourceLength, dest, decompressLength, header, false);
+    }
+
+    bool zlibDecompressPartial(
+        IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength, ZlibHeaderType header)
+    {
+        return zlibDecompressImpl(source, sourceLength, dest, decompressLength, header, true);
+    }
+
+    // Inputs below this size are unlikely to win anything from worker threads as zstd
+    // splits the input into jobs of at least ZSTD_BLOCKSIZE_MAX sized chunks.
+    static constexpr uint64_t kZstdMinParallelSize = 1 << 20;
+
+    static int zstdWorkerCount()
+    {
+        const auto numThreads = std::thread::hardware_concurrency();
+        // Leave a core for the game loop; a handful of workers is enough to saturate the stream.
+        return static_cast<int>(std::min(numThreads > 1 ? numThreads - 1 : 1u, 8u));
+    }
+
     /*
      * Modified copy of ZSTD_COMPRESSBOUND / ZSTD_compressBound() from zstd 1.5.7, with the argument
      * type changed from size_t (which may be only 32 bits) to uint64_t, and removes the error handling.
@@ -186,6 +217,17 @@ namespace OpenRCT2::Compression
             LOG_ERROR("Failed to set checksum flag with error: %s", ZSTD_getErrorName(ret));
             return false;
         }
+        // Compress independent blocks on a worker pool for large inputs such as park saves.
+        // The output is a standard single frame, so decompression is unaffected. Not an error
+        // if unavailable; libzstd built without multithreading just compresses on this thread.
+        if (sourceLength >= kZstdMinParallelSize)
+        {
+            ret = ZSTD_CCtx_setParameter(ctx.get(), ZSTD_c_nbWorkers, zstdWorkerCount());
+            if (ZSTD_isError(ret))
+            {
+                LOG_VERBOSE("Multithreaded zstd compression unavailable: %s", ZSTD_getErrorName(ret));
+            }
+        }
         // unlike gzip, zstd puts the decompressed content size at the start of the file,
         // so we need to tell zstd how big the input is before we start compressing.
         ret = ZSTD_CCtx_setPledgedSrcSize(ctx.get(), sourceLength);
@@ -221,7 +263,8 @@ namespace OpenRCT2::Compression
         return true;
     }
 
-    bool zstdDecompress(IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength)
+    static bool zstdDecompressImpl(
+        IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength, bool partial)
     {
         if (sourceLength > source.GetLength() - source.GetPosition())
             throw IOException("Not Enough Data to Decompress");
@@ -247,6 +290,11 @@ namespace OpenRCT2::Compression
             {
                 if (!destBuf)
                 {
+                    if (partial)
+                    {
+                        // Requested prefix has been fully written
+                        return true;
+                    }
                     LOG_ERROR("Decompressed data larger than expected");
                     return false;
                 }
@@ -273,4 +321,14 @@ namespace OpenRCT2::Compression
 
         return true;
     }
+
+    bool zstdDecompress(IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength)
+    {
+        return zstdDecompressImpl(source, sourceLength, dest, decompressLength, false);
+    }
+
+    bool zstdDecompressPartial(IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength)
+    {
+        return zstdDecompressImpl(source, sourceLength, dest, decompressLength, true);
+    }
 } // namespace OpenRCT2::Compression
@@ -36,6 +36,10 @@ namespace OpenRCT2::Compression
         int16_t level = kZlibDefaultCompressionLevel);
     bool zlibDecompress(
         IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength, ZlibHeaderType header);
+    // Decompresses only the first decompressLength bytes of the stream and then stops,
+    // for readers that only need a prefix of the uncompressed data.
+    bool zlibDecompressPartial(
+        IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength, ZlibHeaderType header);
 
     // Zstd methods, using the ZStandard compression algorithm
     constexpr int16_t kZstdDefaultCompressionLevel = 3;
@@ -54,4 +58,7 @@ namespace OpenRCT2::Compression
         IStream& source, uint64_t sourceLength, IStream& dest, ZstdMetadata metadata,
         int16_t level = kZstdDefaultCompressionLevel);
     bool zstdDecompress(IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength);
+    // Decompresses only the first decompressLength bytes of the frame and then stops,
+    // for readers that only need a prefix of the uncompressed data.
+    bool zstdDecompressPartial(IStream& source, uint64_t sourceLength, IStream& dest, uint64_t decompressLength);
 } // namespace OpenRCT2::Compression
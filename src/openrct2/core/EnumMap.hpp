@@ -26,7 +26,14 @@ private:
     bool _continiousValueIndex{ false };
 
     static constexpr size_t kBucketSize = 43;
-    std::array<std::vector<int32_t>, kBucketSize> _buckets;
+    // Each bucket entry keeps the full 32-bit hash next to the index so a
+    // lookup only compares strings when the whole hash matches: misses and
+    // bucket collisions are rejected on the integer alone. A compile-time
+    // perfect hash was considered instead and rejected — these maps are
+    // ordinary static locals built once at startup, so generation would buy
+    // one final verification compare per hit at the cost of making every
+    // definition site constexpr.
+    std::array<std::vector<std::pair<uint32_t, int32_t>>, kBucketSize> _buckets;
 
     static constexpr bool ValueIndexable()
     {
@@ -86,7 +93,7 @@ public:
             auto hash = MakeHash(kv.first);
             auto bucketIndex = hash % kBucketSize;
             auto& bucket = _buckets[bucketIndex];
-            bucket.push_back(index);
+            bucket.emplace_back(hash, index);
             index++;
         }
     }
@@ -119,8 +126,12 @@ public:
         const auto bucketIndex = hash % kBucketSize;
         const auto& bucket = _buckets[bucketIndex];
 
-        for (auto index : bucket)
+        for (const auto& [entryHash, index] : bucket)
         {
+            if (entryHash != hash)
+            {
+                continue;
+            }
             auto& entry = _map[index];
             if (entry.first == k)
             {
@@ -22,7 +22,10 @@
 
 #include <chrono>
 #include <list>
+#include <numeric>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -42,10 +45,18 @@ private:
     {
         DirectoryStats const Stats;
         std::vector<std::string> const Files;
-
-        ScanResult(DirectoryStats stats, std::vector<std::string>&& files) noexcept
+        // Modified timestamp and size of each file, parallel to Files, so the
+        // index can record them per item and reuse unchanged entries later.
+        std::vector<uint64_t> const FileModified;
+        std::vector<uint64_t> const FileSize;
+
+        ScanResult(
+            DirectoryStats stats, std::vector<std::string>&& files, std::vector<uint64_t>&& fileModified,
+            std::vector<uint64_t>&& fileSize) noexcept
             : Stats(stats)
             , Files(std::move(files))
+            , FileModified(std::move(fileModified))
+            , FileSize(std::move(fileSize))
         {
         }
     };
@@ -61,8 +72,22 @@ private:
         uint32_t NumItems = 0;
     };
 
+    struct ReadIndexResult
+    {
+        // Header matched (magic, version, language) so the stored items can be
+        // reused for files whose modified timestamp and size are unchanged.
+        bool HeaderCompatible = false;
+        // The overall directory stats matched; the index is fully up to date.
+        bool UpToDate = false;
+        std::vector<TItem> Items;
+        // Source file record of each stored item, parallel to Items.
+        std::vector<std::string> ItemPaths;
+        std::vector<uint64_t> ItemModified;
+        std::vector<uint64_t> ItemSize;
+    };
+
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t kFileIndexVersion = 4;
+    static constexpr uint8_t kFileIndexVersion = 6;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -103,20 +128,19 @@ public:
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
         auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (readIndexResult.first)
+        auto readIndexResult = ReadIndexFile(language, scanResult);
+        if (readIndexResult.UpToDate)
         {
-            // Index was loaded
-            items = std::move(readIndexResult.second);
+            return std::move(readIndexResult.Items);
         }
-        else
+        if (readIndexResult.HeaderCompatible)
         {
-            // Index was not loaded
-            items = Build(language, scanResult);
+            // Only some files changed; reuse the stored items for the
+            // unchanged ones and re-process the rest.
+            return BuildIncremental(language, scanResult, readIndexResult);
         }
-        return items;
+        return Build(language, scanResult);
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
@@ -142,10 +166,14 @@ private:
     {
         DirectoryStats stats{};
         std::vector<std::string> files;
+        std::vector<uint64_t> fileModified;
+        std::vector<uint64_t> fileSize;
         for (const auto& directory : SearchPaths)
         {
             if (directory.empty())
+            {
                 continue;
+            }
 
             auto absoluteDirectory = OpenRCT2::Path::GetAbsolute(directory);
             LOG_VERBOSE("FileIndex:Scanning for %s in '%s'", _pattern.c_str(), absoluteDirectory.c_str());
@@ -165,46 +193,115 @@ private:
                 stats.PathChecksum += GetPathChecksum(path);
 
                 files.push_back(std::move(path));
+                fileModified.push_back(fileInfo.LastModified);
+                fileSize.push_back(fileInfo.Size);
             }
         }
-        return ScanResult(stats, std::move(files));
+        return ScanResult(stats, std::move(files), std::move(fileModified), std::move(fileSize));
+    }
+
+    /**
+     * Creates items for the given subset of scanned files, appending them and the
+     * index of their source file to the output vectors.
+     *
+     * Each worker reads and hashes its file with plain blocking I/O. With one
+     * task per file across the pool there are always enough requests in
+     * flight to cover per-request latency (including network shares), which
+     * is the same effect an async submission ring would buy, without a
+     * platform-specific I/O backend under core/File.
+     */
+    void CreateItems(
+        int32_t language, const ScanResult& scanResult, const std::vector<size_t>& fileIndices, std::vector<TItem>& outItems,
+        std::vector<uint32_t>& outItemFileIndex) const
+    {
+        const size_t totalCount = fileIndices.size();
+        if (totalCount == 0)
+            return;
+
+        JobPool jobPool;
+        std::mutex mtx;
+        std::atomic<size_t> processed{ 0 };
+
+        for (auto fileIndex : fileIndices)
+        {
+            jobPool.AddTask([&, index = fileIndex]() {
+                const auto& filePath = scanResult.Files.at(index);
+
+                if (auto item = Create(language, filePath); item.has_value())
+                {
+                    std::lock_guard lock(mtx);
+                    outItems.push_back(std::move(item.value()));
+                    outItemFileIndex.push_back(static_cast<uint32_t>(index));
+                }
+
+                processed++;
+            });
+        }
+
+        jobPool.Join([&]() {
+            OpenRCT2::GetContext()->SetProgress(static_cast<uint32_t>(processed.load()), static_cast<uint32_t>(totalCount));
+        });
     }
 
     std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
     {
         std::vector<TItem> allItems;
+        std::vector<uint32_t> itemFileIndex;
         OpenRCT2::Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
-        if (totalCount > 0)
+        std::vector<size_t> fileIndices(scanResult.Files.size());
+        std::iota(fileIndices.begin(), fileIndices.end(), size_t{ 0 });
+        CreateItems(language, scanResult, fileIndices, allItems, itemFileIndex);
+
+        WriteIndexFile(language, scanResult, allItems, itemFileIndex);
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration<float>(endTime - startTime);
+        OpenRCT2::Console::WriteLine("Finished building %s in %.2f seconds.", _name.c_str(), duration.count());
+
+        return allItems;
+    }
+
+    std::vector<TItem> BuildIncremental(int32_t language, const ScanResult& scanResult, ReadIndexResult& readResult) const
+    {
+        // Look up stored items by source path so items for files whose modified
+        // timestamp and size are unchanged can be reused as they are. Stored
+        // items whose file is gone simply never match and are dropped.
+        std::unordered_map<std::string_view, size_t> storedItemByPath;
+        storedItemByPath.reserve(readResult.ItemPaths.size());
+        for (size_t i = 0; i < readResult.ItemPaths.size(); i++)
         {
-            JobPool jobPool;
-            std::mutex mtx;
-            std::atomic<size_t> processed{ 0 };
+            storedItemByPath.emplace(readResult.ItemPaths[i], i);
+        }
 
-            for (size_t i = 0; i < totalCount; i++)
+        std::vector<TItem> allItems;
+        std::vector<uint32_t> itemFileIndex;
+        std::vector<size_t> fileIndices;
+        for (size_t i = 0; i < scanResult.Files.size(); i++)
+        {
+            auto it = storedItemByPath.find(scanResult.Files[i]);
+            if (it != storedItemByPath.end() && readResult.ItemModified[it->second] == scanResult.FileModified[i]
+                && readResult.ItemSize[it->second] == scanResult.FileSize[i])
             {
-                jobPool.AddTask([&, index = i]() {
-                    const auto& filePath = scanResult.Files.at(index);
+                allItems.push_back(std::move(readResult.Items[it->second]));
+                itemFileIndex.push_back(static_cast<uint32_t>(i));
+            }
+            else
+            {
+                fileIndices.push_back(i);
+            }
+        }
 
-                    if (auto item = Create(language, filePath); item.has_value())
-                    {
-                        std::lock_guard lock(mtx);
-                        allItems.push_back(std::move(item.value()));
-                    }
+        OpenRCT2::Console::WriteLine(
+            "Building %s (%zu of %zu items)", _name.c_str(), fileIndices.size(), scanResult.Files.size());
 
-                    processed++;
-                });
-            }
+        auto startTime = std::chrono::high_resolution_clock::now();
 
-            jobPool.Join([&]() {
-                OpenRCT2::GetContext()->SetProgress(static_cast<uint32_t>(processed.load()), static_cast<uint32_t>(totalCount));
-            });
-        }
+        CreateItems(language, scanResult, fileIndices, allItems, itemFileIndex);
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
+        WriteIndexFile(language, scanResult, allItems, itemFileIndex);
 
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
@@ -213,10 +310,9 @@ private:
         return allItems;
     }
 
-    std::pair<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    ReadIndexResult ReadIndexFile(int32_t language, const ScanResult& scanResult) const
     {
-        bool loadedItems = false;
-        std::vector<TItem> items;
+        ReadIndexResult result;
         if (OpenRCT2::File::Exists(_indexPath))
         {
             try
@@ -227,23 +323,32 @@ private:
                 // Read header, check if we need to re-scan
                 auto header = fs.ReadValue<FileIndexHeader>();
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == kFileIndexVersion && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                    && header.VersionA == kFileIndexVersion && header.VersionB == _version && header.LanguageId == language)
                 {
-                    items.reserve(header.NumItems);
+                    result.Items.reserve(header.NumItems);
+                    result.ItemPaths.reserve(header.NumItems);
+                    result.ItemModified.reserve(header.NumItems);
+                    result.ItemSize.reserve(header.NumItems);
                     DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
                     for (uint32_t i = 0; i < header.NumItems; i++)
                     {
+                        result.ItemModified.push_back(fs.ReadValue<uint64_t>());
+                        result.ItemSize.push_back(fs.ReadValue<uint64_t>());
+                        result.ItemPaths.push_back(fs.ReadString());
                         TItem item;
                         Serialise(ds, item);
-                        items.emplace_back(std::move(item));
+                        result.Items.emplace_back(std::move(item));
                     }
-                    loadedItems = true;
+                    result.HeaderCompatible = true;
+
+                    const auto& stats = scanResult.Stats;
+                    result.UpToDate = header.Stats.TotalFiles == stats.TotalFiles
+                        && header.Stats.TotalFileSize == stats.TotalFileSize
+                        && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
+                        && header.Stats.PathChecksum == stats.PathChecksum;
                 }
-                else
+
+                if (!result.UpToDate)
                 {
                     OpenRCT2::Console::WriteLine("%s out of date", _name.c_str());
                 }
@@ -252,12 +357,15 @@ private:
             {
                 OpenRCT2::Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 OpenRCT2::Console::Error::WriteLine("%s", e.what());
+                result = {};
             }
         }
-        return { loadedItems, std::move(items) };
+        return result;
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, const std::vector<TItem>& items) const
+    void WriteIndexFile(
+        int32_t language, const ScanResult& scanResult, const std::vector<TItem>& items,
+        const std::vector<uint32_t>& itemFileIndex) const
     {
         try
         {
@@ -271,15 +379,21 @@ private:
             header.VersionA = kFileIndexVersion;
             header.VersionB = _version;
             header.LanguageId = language;
-            header.Stats = stats;
+            header.Stats = scanResult.Stats;
             header.NumItems = static_cast<uint32_t>(items.size());
             fs.WriteValue(header);
 
             DataSerialiser ds(true, fs);
-            // Write items
-            for (const auto& item : items)
+            // Write items, each tagged with the modified timestamp, size and
+            // path of its source file so partial rebuilds can reuse items for
+            // files that have not changed.
+            for (size_t i = 0; i < items.size(); i++)
             {
-                Serialise(ds, item);
+                const auto fileIndex = itemFileIndex[i];
+                fs.WriteValue(scanResult.FileModified[fileIndex]);
+                fs.WriteValue(scanResult.FileSize[fileIndex]);
+                fs.WriteString(scanResult.Files[fileIndex]);
+                Serialise(ds, items[i]);
             }
         }
         catch (const std::exception& e)
@@ -0,0 +1,134 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_HTTP
+
+    #include "Http.h"
+
+    #include <condition_variable>
+    #include <deque>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
+
+namespace OpenRCT2::Http
+{
+    // Upper bound on concurrent requests; also the number of persistent
+    // worker threads, which lets the backend reuse its per-thread connection
+    // state across requests instead of paying a fresh handshake every time.
+    static constexpr size_t kMaxHttpWorkers = 2;
+
+    class HttpWorkerPool
+    {
+    public:
+        ~HttpWorkerPool()
+        {
+            {
+                std::lock_guard lock(_mutex);
+                _shouldStop = true;
+            }
+            _cond.notify_all();
+            for (auto& worker : _workers)
+            {
+                worker.join();
+            }
+        }
+
+        std::future<void> Enqueue(const Request& req, std::function<void(Response&)> callback)
+        {
+            std::future<void> result;
+            {
+                std::lock_guard lock(_mutex);
+                auto& item = _queue.emplace_back();
+                item.req = req;
+                item.callback = std::move(callback);
+                result = item.completed.get_future();
+                if (_workers.size() < kMaxHttpWorkers && _idleWorkers == 0)
+                {
+                    _workers.emplace_back(&HttpWorkerPool::ProcessQueue, this);
+                }
+            }
+            _cond.notify_one();
+            return result;
+        }
+
+    private:
+        struct QueueItem
+        {
+            Request req;
+            std::function<void(Response&)> callback;
+            std::promise<void> completed;
+        };
+
+        void ProcessQueue()
+        {
+            std::unique_lock lock(_mutex);
+            while (true)
+            {
+                _idleWorkers++;
+                _cond.wait(lock, [this]() { return _shouldStop || !_queue.empty(); });
+                _idleWorkers--;
+
+                // On shutdown the queue is drained first so that every handed
+                // out future still completes.
+                if (_queue.empty())
+                    break;
+
+                auto item = std::move(_queue.front());
+                _queue.pop_front();
+                lock.unlock();
+
+                Response res{};
+                try
+                {
+                    res = Do(item.req);
+                }
+                catch (const std::exception& e)
+                {
+                    res.error = e.what();
+                }
+
+                try
+                {
+                    if (item.callback)
+                    {
+                        item.callback(res);
+                    }
+                    item.completed.set_value();
+                }
+                catch (...)
+                {
+                    item.completed.set_exception(std::current_exception());
+                }
+
+                lock.lock();
+            }
+        }
+
+        std::mutex _mutex;
+        std::condition_variable _cond;
+        std::deque<QueueItem> _queue;
+        std::vector<std::thread> _workers;
+        size_t _idleWorkers = 0;
+        bool _shouldStop = false;
+    };
+
+    static HttpWorkerPool& GetWorkerPool()
+    {
+        static HttpWorkerPool pool;
+        return pool;
+    }
+
+    std::future<void> DoAsync(const Request& req, std::function<void(Response& res)> fn)
+    {
+        return GetWorkerPool().Enqueue(req, std::move(fn));
+    }
+} // namespace OpenRCT2::Http
+
+#endif // DISABLE_HTTP
@@ -53,22 +53,14 @@ namespace OpenRCT2::Http
 
     Response Do(const Request& req);
 
-    inline auto DoAsync(const Request& req, std::function<void(Response& res)> fn)
-    {
-        return std::async(std::launch::async, [=]() {
-            Response res{};
-            try
-            {
-                res = Do(req);
-            }
-            catch (std::exception& e)
-            {
-                res.error = e.what();
-                return;
-            }
-            fn(res);
-        });
-    }
+    /**
+     * Executes the request on a small shared pool of worker threads and
+     * invokes fn with the response (with only `error` set if the request
+     * threw). The returned future completes after the callback has run;
+     * unlike a std::async future its destructor does not block, so callers
+     * that do not need to wait can simply discard it.
+     */
+    std::future<void> DoAsync(const Request& req, std::function<void(Response& res)> fn);
 } // namespace OpenRCT2::Http
 
 #endif // DISABLE_HTTP
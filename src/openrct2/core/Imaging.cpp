@@ -170,7 +170,8 @@ namespace OpenRCT2::Imaging
         }
     }
 
-    static void WritePng(std::ostream& ostream, const Image& image)
+    static void WritePngRows(
+        std::ostream& ostream, uint32_t width, uint32_t height, const Drawing::GamePalette& palette, const ImageRowFunc& getRow)
     {
         png_structp png_ptr = nullptr;
         png_colorp png_palette = nullptr;
@@ -193,28 +194,20 @@ namespace OpenRCT2::Imaging
                 throw std::runtime_error("png_create_info_struct failed.");
             }
 
-            if (image.Depth == 8)
+            // Set the palette
+            png_palette = static_cast<png_colorp>(png_malloc(png_ptr, PNG_MAX_PALETTE_LENGTH * sizeof(png_color)));
+            if (png_palette == nullptr)
             {
-                if (!image.Palette.has_value())
-                {
-                    throw std::runtime_error("Expected a palette for 8-bit image.");
-                }
-
-                // Set the palette
-                png_palette = static_cast<png_colorp>(png_malloc(png_ptr, PNG_MAX_PALETTE_LENGTH * sizeof(png_color)));
-                if (png_palette == nullptr)
-                {
-                    throw std::runtime_error("png_malloc failed.");
-                }
-                for (size_t i = 0; i < PNG_MAX_PALETTE_LENGTH; i++)
-                {
-                    const auto& entry = (*image.Palette)[i];
-                    png_palette[i].blue = entry.blue;
-                    png_palette[i].green = entry.green;
-                    png_palette[i].red = entry.red;
-                }
-                png_set_PLTE(png_ptr, info_ptr, png_palette, PNG_MAX_PALETTE_LENGTH);
+                throw std::runtime_error("png_malloc failed.");
+            }
+            for (size_t i = 0; i < PNG_MAX_PALETTE_LENGTH; i++)
+            {
+                const auto& entry = palette[i];
+                png_palette[i].blue = entry.blue;
+                png_palette[i].green = entry.green;
+                png_palette[i].red = entry.red;
             }
+            png_set_PLTE(png_ptr, info_ptr, png_palette, PNG_MAX_PALETTE_LENGTH);
 
             png_set_write_fn(png_ptr, &ostream, PngWriteData, PngFlush);
 
@@ -225,17 +218,82 @@ namespace OpenRCT2::Imaging
             }
 
             // Write header
-            auto colourType = PNG_COLOR_TYPE_RGB_ALPHA;
-            if (image.Depth == 8)
+            png_byte transparentIndex = 0;
+            png_set_tRNS(png_ptr, info_ptr, &transparentIndex, 1, nullptr);
+            png_set_text(png_ptr, info_ptr, text_ptr, 1);
+            png_set_IHDR(
+                png_ptr, info_ptr, width, height, 8, PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE,
+                PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+            png_write_info(png_ptr, info_ptr);
+
+            // Write pixels
+            for (uint32_t y = 0; y < height; y++)
+            {
+                png_write_row(png_ptr, const_cast<png_byte*>(getRow(y)));
+            }
+
+            png_write_end(png_ptr, nullptr);
+            png_destroy_info_struct(png_ptr, &info_ptr);
+            png_free(png_ptr, png_palette);
+            png_destroy_write_struct(&png_ptr, nullptr);
+        }
+        catch (const std::exception&)
+        {
+            png_free(png_ptr, png_palette);
+            png_destroy_write_struct(&png_ptr, nullptr);
+            throw;
+        }
+    }
+
+    static void WritePng(std::ostream& ostream, const Image& image)
+    {
+        if (image.Depth == 8)
+        {
+            if (!image.Palette.has_value())
+            {
+                throw std::runtime_error("Expected a palette for 8-bit image.");
+            }
+
+            auto pixels = image.Pixels.data();
+            WritePngRows(ostream, image.Width, image.Height, *image.Palette, [&](uint32_t y) {
+                return pixels + static_cast<size_t>(y) * image.Stride;
+            });
+            return;
+        }
+
+        png_structp png_ptr = nullptr;
+        try
+        {
+            png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, PngError, PngWarning);
+            if (png_ptr == nullptr)
+            {
+                throw std::runtime_error("png_create_write_struct failed.");
+            }
+
+            png_text text_ptr[1];
+            text_ptr[0].key = const_cast<char*>("Software");
+            text_ptr[0].text = const_cast<char*>(gVersionInfoFull);
+            text_ptr[0].compression = PNG_TEXT_COMPRESSION_zTXt;
+
+            auto info_ptr = png_create_info_struct(png_ptr);
+            if (info_ptr == nullptr)
+            {
+                throw std::runtime_error("png_create_info_struct failed.");
+            }
+
+            png_set_write_fn(png_ptr, &ostream, PngWriteData, PngFlush);
+
+            // Set error handler
+            if (setjmp(png_jmpbuf(png_ptr)))
             {
-                png_byte transparentIndex = 0;
-                png_set_tRNS(png_ptr, info_ptr, &transparentIndex, 1, nullptr);
-                colourType = PNG_COLOR_TYPE_PALETTE;
+                throw std::runtime_error("PNG ERROR");
             }
+
+            // Write header
             png_set_text(png_ptr, info_ptr, text_ptr, 1);
             png_set_IHDR(
-                png_ptr, info_ptr, image.Width, image.Height, 8, colourType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
-                PNG_FILTER_TYPE_DEFAULT);
+                png_ptr, info_ptr, image.Width, image.Height, 8, PNG_COLOR_TYPE_RGB_ALPHA, PNG_INTERLACE_NONE,
+                PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
             png_write_info(png_ptr, info_ptr);
 
             // Write pixels
@@ -248,12 +306,10 @@ namespace OpenRCT2::Imaging
 
             png_write_end(png_ptr, nullptr);
             png_destroy_info_struct(png_ptr, &info_ptr);
-            png_free(png_ptr, png_palette);
             png_destroy_write_struct(&png_ptr, nullptr);
         }
         catch (const std::exception&)
         {
-            png_free(png_ptr, png_palette);
             png_destroy_write_struct(&png_ptr, nullptr);
             throw;
         }
@@ -367,4 +423,11 @@ namespace OpenRCT2::Imaging
                 throw std::runtime_error(kExceptionImageFormatUnknown);
         }
     }
+
+    void WritePngRows(
+        std::string_view path, uint32_t width, uint32_t height, const Drawing::GamePalette& palette, const ImageRowFunc& getRow)
+    {
+        std::ofstream fs(fs::u8path(path), std::ios::binary);
+        WritePngRows(fs, width, height, palette, getRow);
+    }
 } // namespace OpenRCT2::Imaging
@@ -41,6 +41,7 @@ struct Image
 };
 
 using ImageReaderFunc = std::function<Image(std::istream&, ImageFormat)>;
+using ImageRowFunc = std::function<const uint8_t*(uint32_t y)>;
 
 namespace OpenRCT2::Imaging
 {
@@ -49,5 +50,15 @@ namespace OpenRCT2::Imaging
     Image ReadFromBuffer(const std::vector<uint8_t>& buffer, ImageFormat format = ImageFormat::automatic);
     void WriteToFile(std::string_view path, const Image& image, ImageFormat format = ImageFormat::automatic);
 
+    /**
+     * Streams an 8bpp palettised PNG to a file row by row. getRow is called
+     * once for every y from 0 to height - 1, in order, and must return a
+     * pointer to width pixels that remains valid until the next call, so the
+     * full image never has to be resident in memory.
+     */
+    void WritePngRows(
+        std::string_view path, uint32_t width, uint32_t height, const OpenRCT2::Drawing::GamePalette& palette,
+        const ImageRowFunc& getRow);
+
     void SetReader(ImageFormat format, ImageReaderFunc impl);
 } // namespace OpenRCT2::Imaging
@@ -9,20 +9,34 @@
 
 #include "JobPool.h"
 
+#include <algorithm>
 #include <cassert>
 
+#ifdef __linux__
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
 JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn)
     : WorkFn(std::move(workFn))
     , CompletionFn(std::move(completionFn))
 {
 }
 
-JobPool::JobPool(size_t maxThreads)
+JobPool::JobPool(size_t maxThreads, bool pinThreads)
 {
     maxThreads = std::min<size_t>(maxThreads, std::max(1u, std::thread::hardware_concurrency()));
     for (size_t n = 0; n < maxThreads; n++)
     {
-        _threads.emplace_back(&JobPool::ProcessQueue, this);
+        _workers.push_back(std::make_unique<Worker>());
+    }
+    for (size_t n = 0; n < maxThreads; n++)
+    {
+        auto& thread = _threads.emplace_back(&JobPool::ProcessQueue, this, n);
+        if (pinThreads)
+        {
+            PinThreadToCore(thread, n);
+        }
     }
 }
 
@@ -43,20 +57,68 @@ JobPool::~JobPool()
 
 void JobPool::AddTask(std::function<void()> workFn, std::function<void()> completionFn)
 {
+    AddTask(JobPriority::normal, std::move(workFn), std::move(completionFn));
+}
+
+void JobPool::AddTask(JobPriority priority, std::function<void()> workFn, std::function<void()> completionFn)
+{
+    // Distribute tasks round-robin over the worker queues so producers do not
+    // all contend on the same lock.
+    const auto queueIndex = _nextQueue.fetch_add(1, std::memory_order_relaxed) % _workers.size();
+    {
+        auto& worker = *_workers[queueIndex];
+        std::lock_guard lock(worker.Mutex);
+        worker.Queues[static_cast<size_t>(priority)].emplace_back(std::move(workFn), std::move(completionFn));
+    }
     {
         std::lock_guard lock(_mutex);
-        _pending.emplace_back(workFn, completionFn);
+        _pendingCount++;
     }
     _condPending.notify_one();
 }
 
+std::optional<JobPool::TaskData> JobPool::TryTakeTask(size_t workerIndex)
+{
+    const auto numWorkers = _workers.size();
+    for (size_t priority = 0; priority < kNumPriorities; priority++)
+    {
+        // Own queue first, newest task first for cache warmth.
+        {
+            auto& own = *_workers[workerIndex];
+            std::lock_guard lock(own.Mutex);
+            auto& queue = own.Queues[priority];
+            if (!queue.empty())
+            {
+                auto task = std::move(queue.back());
+                queue.pop_back();
+                return task;
+            }
+        }
+
+        // Steal from the front of another worker's queue.
+        for (size_t offset = 1; offset < numWorkers; offset++)
+        {
+            auto& victim = *_workers[(workerIndex + offset) % numWorkers];
+            std::lock_guard lock(victim.Mutex);
+            auto& queue = victim.Queues[priority];
+            if (!queue.empty())
+            {
+                auto task = std::move(queue.front());
+                queue.pop_front();
+                return task;
+            }
+        }
+    }
+    return std::nullopt;
+}
+
 void JobPool::Join(std::function<void()> reportFn)
 {
     std::unique_lock lock(_mutex);
     while (true)
     {
         // Wait for the queue to become empty or having completed tasks.
-        _condComplete.wait(lock, [this]() { return (_pending.empty() && _processing == 0) || !_completed.empty(); });
+        _condComplete.wait(lock, [this]() { return (_pendingCount == 0 && _processing == 0) || !_completed.empty(); });
 
         // Dispatch all completion callbacks if there are any.
         while (!_completed.empty())
@@ -84,7 +146,7 @@ void JobPool::Join(std::function<void()> reportFn)
         }
 
         // If everything is empty and no more work has to be done we can stop waiting.
-        if (_completed.empty() && _pending.empty() && _processing == 0)
+        if (_completed.empty() && _pendingCount == 0 && _processing == 0)
         {
             break;
         }
@@ -94,34 +156,51 @@ void JobPool::Join(std::function<void()> reportFn)
 bool JobPool::IsBusy()
 {
     std::lock_guard lock(_mutex);
-    return _processing != 0 || !_pending.empty();
+    return _processing != 0 || _pendingCount != 0;
 }
 
-void JobPool::ProcessQueue()
+void JobPool::ProcessQueue(size_t workerIndex)
 {
     std::unique_lock lock(_mutex);
     do
     {
         // Wait for work or cancellation.
-        _condPending.wait(lock, [this]() { return _shouldStop || !_pending.empty(); });
+        _condPending.wait(lock, [this]() { return _shouldStop || _pendingCount != 0; });
 
-        if (!_pending.empty())
+        if (_pendingCount != 0)
         {
+            _pendingCount--;
             _processing++;
 
-            auto taskData = std::move(_pending.front());
-            _pending.pop_front();
-
             lock.unlock();
 
-            taskData.WorkFn();
+            // Every decrement of the pending count corresponds to exactly one
+            // queued task, but another worker may grab it first; keep sweeping
+            // until a task is acquired.
+            std::optional<TaskData> taskData;
+            while (!(taskData = TryTakeTask(workerIndex)))
+            {
+                std::this_thread::yield();
+            }
+
+            taskData->WorkFn();
 
             lock.lock();
 
-            _completed.push_back(std::move(taskData));
+            _completed.push_back(std::move(*taskData));
 
             _processing--;
             _condComplete.notify_one();
         }
     } while (!_shouldStop);
 }
+
+void JobPool::PinThreadToCore([[maybe_unused]] std::thread& thread, [[maybe_unused]] size_t core)
+{
+#ifdef __linux__
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(core % std::max(1u, std::thread::hardware_concurrency()), &cpuSet);
+    pthread_setaffinity_np(thread.native_handle(), sizeof(cpuSet), &cpuSet);
+#endif
+}
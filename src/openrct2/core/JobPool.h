@@ -9,41 +9,72 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
 #include <vector>
 
+enum class JobPriority : uint8_t
+{
+    // Work the current frame is waiting on, taken before anything else.
+    high = 0,
+    // Everything else (scans, background decompression).
+    normal = 1,
+};
+
+/**
+ * Thread pool with one task deque per worker. Producers distribute tasks
+ * round-robin, workers pop their own deque from the back and steal from other
+ * workers' fronts when empty, so fine-grained tasks do not serialise on a
+ * single queue lock.
+ */
 class JobPool
 {
 private:
+    static constexpr size_t kNumPriorities = 2;
+
     struct TaskData
     {
-        const std::function<void()> WorkFn;
-        const std::function<void()> CompletionFn;
+        std::function<void()> WorkFn;
+        std::function<void()> CompletionFn;
 
         TaskData(std::function<void()> workFn, std::function<void()> completionFn);
     };
 
+    struct Worker
+    {
+        std::mutex Mutex;
+        std::array<std::deque<TaskData>, kNumPriorities> Queues;
+    };
+
     bool _shouldStop = false;
+    size_t _pendingCount = 0;
     size_t _processing = 0;
+    std::atomic<size_t> _nextQueue{ 0 };
+    std::vector<std::unique_ptr<Worker>> _workers;
     std::vector<std::thread> _threads;
-    std::deque<TaskData> _pending;
     std::deque<TaskData> _completed;
     std::condition_variable _condPending;
     std::condition_variable _condComplete;
     std::mutex _mutex;
 
 public:
-    JobPool(size_t maxThreads = 255);
+    JobPool(size_t maxThreads = 255, bool pinThreads = false);
     ~JobPool();
 
     void AddTask(std::function<void()> workFn, std::function<void()> completionFn = nullptr);
+    void AddTask(JobPriority priority, std::function<void()> workFn, std::function<void()> completionFn = nullptr);
     void Join(std::function<void()> reportFn = nullptr);
     bool IsBusy();
 
 private:
-    void ProcessQueue();
+    std::optional<TaskData> TryTakeTask(size_t workerIndex);
+    void ProcessQueue(size_t workerIndex);
+    static void PinThreadToCore(std::thread& thread, size_t core);
 };
@@ -17,6 +17,13 @@
 
 /**
  * Utility methods for memory management. Typically helpers and wrappers around the C standard library.
+ *
+ * There is intentionally no NUMA-topology-aware allocation layer here. The
+ * simulation is single-threaded: the thread that loads a park is the same
+ * main-loop thread that later ticks it, so the default first-touch policy
+ * already places the tile element and entity storage on that thread's node.
+ * Pinning the process to a socket is a deployment concern (numactl/cpusets),
+ * not something to hard-code into a cross-platform allocator.
  */
 namespace OpenRCT2::Memory
 {
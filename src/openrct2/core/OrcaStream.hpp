@@ -75,9 +75,18 @@ namespace OpenRCT2
         MemoryStream _buffer;
         ChunkEntry _currentChunk;
         int16_t _compressionLevel;
+        bool _released{};
 
     public:
-        OrcaStream(IStream& stream, const Mode mode, int16_t compressionLevel = Compression::kNoCompressionLevel)
+        /**
+         * When partialChunks is non-empty in reading mode, only the prefix of the
+         * stream covering those chunk ids is decompressed; other chunks are not
+         * readable and the whole-buffer checksum is not verified. Writers should
+         * place chunks meant for partial reads at the front of the stream.
+         */
+        OrcaStream(
+            IStream& stream, const Mode mode, int16_t compressionLevel = Compression::kNoCompressionLevel,
+            std::span<const uint32_t> partialChunks = {})
         {
             _stream = &stream;
             _mode = mode;
@@ -93,6 +102,21 @@ namespace OpenRCT2
                     _chunks.push_back(entry);
                 }
 
+                auto readSize = _header.uncompressedSize;
+                if (!partialChunks.empty())
+                {
+                    uint64_t requiredSize = 0;
+                    for (const auto& entry : _chunks)
+                    {
+                        if (std::find(partialChunks.begin(), partialChunks.end(), entry.id) != partialChunks.end())
+                        {
+                            requiredSize = std::max(requiredSize, entry.offset + entry.length);
+                        }
+                    }
+                    readSize = std::min(readSize, requiredSize);
+                }
+                const bool isPartial = readSize < _header.uncompressedSize;
+
                 // Uncompress
                 if (_header.compression != CompressionType::none)
                 {
@@ -101,13 +125,17 @@ namespace OpenRCT2
                     switch (_header.compression)
                     {
                         case CompressionType::gzip:
-                            decompressStatus = Compression::zlibDecompress(
-                                *_stream, _header.compressedSize, _buffer, _header.uncompressedSize,
-                                Compression::ZlibHeaderType::gzip);
+                            decompressStatus = isPartial
+                                ? Compression::zlibDecompressPartial(
+                                      *_stream, _header.compressedSize, _buffer, readSize, Compression::ZlibHeaderType::gzip)
+                                : Compression::zlibDecompress(
+                                      *_stream, _header.compressedSize, _buffer, readSize,
+                                      Compression::ZlibHeaderType::gzip);
                             break;
                         case CompressionType::zstd:
-                            decompressStatus = Compression::zstdDecompress(
-                                *_stream, _header.compressedSize, _buffer, _header.uncompressedSize);
+                            decompressStatus = isPartial
+                                ? Compression::zstdDecompressPartial(*_stream, _header.compressedSize, _buffer, readSize)
+                                : Compression::zstdDecompress(*_stream, _header.compressedSize, _buffer, readSize);
                             break;
                         default:
                             throw IOException("Unknown park compression type");
@@ -120,12 +148,13 @@ namespace OpenRCT2
                 {
                     if (_header.uncompressedSize != _header.compressedSize)
                         throw IOException("Compressed and uncompressed sizes don't match!");
-                    _buffer.CopyFromStream(*_stream, _header.uncompressedSize);
+                    _buffer.CopyFromStream(*_stream, readSize);
                 }
 
                 // early in-dev versions used SHA1 instead of FNV1a, so just assume any file
                 // with a verison number of 0 may be one of these, and don't check their hashes.
-                if (_header.targetVersion > 0)
+                // A partial read cannot verify the whole-buffer checksum.
+                if (_header.targetVersion > 0 && !isPartial)
                 {
                     auto checksum = Crypt::FNV1a(_buffer.GetData(), _buffer.GetLength());
                     if (checksum != _header.fnv1a)
@@ -145,57 +174,83 @@ namespace OpenRCT2
 
         ~OrcaStream()
         {
-            if (_mode == Mode::writing)
+            if (_mode == Mode::writing && !_released)
             {
-                _header.numChunks = static_cast<uint32_t>(_chunks.size());
-                _header.uncompressedSize = _buffer.GetLength();
-                _header.compressedSize = _buffer.GetLength();
-                _header.fnv1a = Crypt::FNV1a(_buffer.GetData(), _buffer.GetLength());
+                FinishWriting(ReleaseWritingState(), *_stream, _compressionLevel);
+            }
+        }
 
-                if (_compressionLevel == Compression::kNoCompressionLevel)
-                    _header.compression = CompressionType::none;
+        /**
+         * The serialised but not yet compressed output of a writing stream.
+         * Releasing it allows compression and the final write to happen away
+         * from the thread that serialised the game state.
+         */
+        struct WritingState
+        {
+            Header header;
+            sfl::small_vector<ChunkEntry, 32> chunks;
+            MemoryStream buffer;
+        };
 
-                // Compress data
-                if (_header.compression != CompressionType::none)
-                {
-                    MemoryStream compressed;
-                    bool compressStatus = false;
+        WritingState ReleaseWritingState()
+        {
+            _released = true;
+            return WritingState{ _header, std::move(_chunks), std::move(_buffer) };
+        }
 
-                    _buffer.SetPosition(0);
-                    switch (_header.compression)
-                    {
-                        case CompressionType::gzip:
-                            compressStatus = Compression::zlibCompress(
-                                _buffer, _buffer.GetLength(), compressed, Compression::ZlibHeaderType::gzip, _compressionLevel);
-                            break;
-                        case CompressionType::zstd:
-                            // PARK header already has length and checksum, so exclude them in the compression frame
-                            compressStatus = Compression::zstdCompress(
-                                _buffer, _buffer.GetLength(), compressed, Compression::ZstdMetadata::none, _compressionLevel);
-                            break;
-                        default:
-                            break;
-                    }
+        static void FinishWriting(WritingState&& state, IStream& stream, int16_t compressionLevel)
+        {
+            auto& header = state.header;
+            auto& buffer = state.buffer;
 
-                    if (compressStatus && compressed.GetLength() < _buffer.GetLength())
-                    {
-                        _buffer = std::move(compressed);
-                        _header.compressedSize = _buffer.GetLength();
-                    }
-                    else
-                    {
-                        // Compression increases filesize, so just store uncompressed data
-                        _header.compression = CompressionType::none;
-                    }
+            header.numChunks = static_cast<uint32_t>(state.chunks.size());
+            header.uncompressedSize = buffer.GetLength();
+            header.compressedSize = buffer.GetLength();
+            header.fnv1a = Crypt::FNV1a(buffer.GetData(), buffer.GetLength());
+
+            if (compressionLevel == Compression::kNoCompressionLevel)
+                header.compression = CompressionType::none;
+
+            // Compress data
+            if (header.compression != CompressionType::none)
+            {
+                MemoryStream compressed;
+                bool compressStatus = false;
+
+                buffer.SetPosition(0);
+                switch (header.compression)
+                {
+                    case CompressionType::gzip:
+                        compressStatus = Compression::zlibCompress(
+                            buffer, buffer.GetLength(), compressed, Compression::ZlibHeaderType::gzip, compressionLevel);
+                        break;
+                    case CompressionType::zstd:
+                        // PARK header already has length and checksum, so exclude them in the compression frame
+                        compressStatus = Compression::zstdCompress(
+                            buffer, buffer.GetLength(), compressed, Compression::ZstdMetadata::none, compressionLevel);
+                        break;
+                    default:
+                        break;
                 }
 
-                // Write header and chunk table
-                _stream->WriteValue(_header);
-                for (const auto& chunk : _chunks)
-                    _stream->WriteValue(chunk);
-                // Write chunk data
-                _stream->Write(_buffer.GetData(), _buffer.GetLength());
+                if (compressStatus && compressed.GetLength() < buffer.GetLength())
+                {
+                    buffer = std::move(compressed);
+                    header.compressedSize = buffer.GetLength();
+                }
+                else
+                {
+                    // Compression increases filesize, so just store uncompressed data
+                    header.compression = CompressionType::none;
+                }
             }
+
+            // Write header and chunk table
+            stream.WriteValue(header);
+            for (const auto& chunk : state.chunks)
+                stream.WriteValue(chunk);
+            // Write chunk data
+            stream.Write(buffer.GetData(), buffer.GetLength());
         }
 
         Mode getMode() const
@@ -255,6 +310,9 @@ namespace OpenRCT2
             if (result != _chunks.end())
             {
                 const auto offset = result->offset;
+                // Chunks beyond the end of a partial read are not available
+                if (offset + result->length > _buffer.GetLength())
+                    return false;
                 _buffer.SetPosition(offset);
                 return true;
             }
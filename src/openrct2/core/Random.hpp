@@ -94,6 +94,13 @@ namespace OpenRCT2::Random
     /**
      * RotateEngine adheres to the _Named Requirement_ `RandomNumberEngine`
      * https://en.cppreference.com/w/cpp/named_req/RandomNumberEngine
+     *
+     * The simulation draws from a single sequential stream on purpose: the
+     * engine state is part of the saved game and of the network checksum, and
+     * RCT2 save compatibility fixes the algorithm. Counter-based per-entity
+     * streams would only pay off with parallel consumers, and entity updates
+     * are serial by design — their interactions (collisions, queue joins,
+     * litter) depend on strict id order across all clients.
      */
     template<typename TUIntType, TUIntType TX, size_t TR1, size_t TR2>
     class RotateEngine : protected RotateEngineState<TUIntType>
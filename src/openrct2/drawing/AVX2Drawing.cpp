@@ -41,6 +41,47 @@ void MaskAvx2(
     }
 }
 
+void FASTCALL RemapRunAvx2(int32_t count, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map)
+{
+    const __m256i three = _mm256_set1_epi32(3);
+    const __m256i byteMask = _mm256_set1_epi32(0xFF);
+    const __m256i zero = _mm256_setzero_si256();
+
+    int32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i idx = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+
+        // Gather 4 bytes ending at map[idx] so the load never reads past the
+        // 256 byte map; the wanted byte is then shifted down per lane.
+        const __m256i off = _mm256_sub_epi32(_mm256_max_epi32(idx, three), three);
+        const __m256i shift = _mm256_slli_epi32(_mm256_sub_epi32(idx, off), 3);
+        const __m256i gathered = _mm256_i32gather_epi32(reinterpret_cast<const int*>(map), off, 1);
+        const __m256i remapped = _mm256_and_si256(_mm256_srlv_epi32(gathered, shift), byteMask);
+
+        // Skip transparent source pixels and transparent remap results.
+        const __m256i keep = _mm256_andnot_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi32(idx, zero), _mm256_cmpeq_epi32(remapped, zero)),
+            _mm256_set1_epi32(-1));
+
+        // Pack the 8 lanes back down to bytes.
+        const __m128i remapLo = _mm256_castsi256_si128(remapped);
+        const __m128i remapHi = _mm256_extracti128_si256(remapped, 1);
+        const __m128i remap8 = _mm_packus_epi16(_mm_packus_epi32(remapLo, remapHi), _mm_setzero_si128());
+        const __m128i keepLo = _mm256_castsi256_si128(keep);
+        const __m128i keepHi = _mm256_extracti128_si256(keep, 1);
+        const __m128i keep8 = _mm_packs_epi16(_mm_packs_epi32(keepLo, keepHi), _mm_setzero_si128());
+
+        const __m128i oldDst = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(dst + i));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_blendv_epi8(oldDst, remap8, keep8));
+    }
+
+    if (i < count)
+    {
+        RemapRunScalar(count - i, src + i, dst + i, map);
+    }
+}
+
 #else
 
     #ifdef OPENRCT2_X86
@@ -54,4 +95,9 @@ void MaskAvx2(
     OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void FASTCALL RemapRunAvx2(int32_t count, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map)
+{
+    OpenRCT2::Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
@@ -7,13 +7,157 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "../core/EnumUtils.hpp"
 #include "Drawing.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace OpenRCT2::Drawing;
 
+namespace
+{
+    struct RecolouredSprite
+    {
+        std::unique_ptr<uint8_t[]> data;
+    };
+} // namespace
+
+// Pre-remapped copies of RLE sprites keyed by (image index, recolour bits).
+// Scenes full of remapped sprites (ride trains, staff, flat rides) draw the
+// same combination every frame; baking the palette into a copy once lets all
+// later draws take the plain transparent blit path with no per-pixel lookup.
+//
+// Entries are only ever added during drawing; the cache is trimmed or cleared
+// between frames (and when object images are freed), so data pointers handed
+// out to the parallel draw workers stay valid for the rest of the frame.
+static std::shared_mutex _recolourCacheMutex;
+static std::unordered_map<uint64_t, RecolouredSprite> _recolourCache;
+static size_t _recolourCacheBytes = 0;
+
+// Memory budget; when exceeded no new entries are added until the cache is
+// emptied at the next frame boundary.
+static constexpr size_t kMaxRecolourCacheBytes = 16 * 1024 * 1024;
+
+static uint64_t MakeRecolourKey(const ImageId image)
+{
+    uint64_t colourBits = image.GetRemap() | (static_cast<uint32_t>(EnumValue(image.GetSecondary())) << 8)
+        | (static_cast<uint32_t>(EnumValue(image.GetTertiary())) << 16) | (image.HasSecondary() ? 1u << 24 : 0)
+        | (image.HasTertiary() ? 1u << 25 : 0);
+    return image.GetIndex() | (colourBits << 32);
+}
+
+static size_t CalculateRleDataSize(const OpenRCT2::G1Element& g1)
+{
+    // Unlike G1CalculateDataSize this does not assume the last row is stored
+    // last in the blob; rows of the copy are remapped individually, so the
+    // copy has to cover every row.
+    size_t maxEnd = g1.height * 2;
+    for (int32_t y = 0; y < g1.height; y++)
+    {
+        uint16_t lineOffset = g1.offset[y * 2] | (g1.offset[y * 2 + 1] << 8);
+        const uint8_t* ptr = g1.offset + lineOffset;
+        bool endOfLine = false;
+        do
+        {
+            uint8_t chunk0 = *ptr++;
+            ptr++; // first pixel x
+            ptr += chunk0 & 0x7F;
+            endOfLine = (chunk0 & 0x80) != 0;
+        } while (!endOfLine);
+        maxEnd = std::max<size_t>(maxEnd, ptr - g1.offset);
+    }
+    return maxEnd;
+}
+
+static const uint8_t* GetOrAddRecolouredSprite(const DrawSpriteArgs& args)
+{
+    if (!GfxPaletteIsDerivedFromImage(args.Image, args.PalMap))
+    {
+        return nullptr;
+    }
+
+    const auto key = MakeRecolourKey(args.Image);
+    {
+        std::shared_lock lock(_recolourCacheMutex);
+        auto it = _recolourCache.find(key);
+        if (it != _recolourCache.end())
+        {
+            return it->second.data.get();
+        }
+        if (_recolourCacheBytes >= kMaxRecolourCacheBytes)
+        {
+            return nullptr;
+        }
+    }
+
+    const auto& g1 = args.SourceImage;
+    if (g1.offset == nullptr || g1.height <= 0)
+    {
+        return nullptr;
+    }
+
+    const size_t size = CalculateRleDataSize(g1);
+    auto data = std::make_unique<uint8_t[]>(size);
+    std::memcpy(data.get(), g1.offset, size);
+
+    // Remap each pixel run in place. Rows may alias the same data, so every
+    // line offset is only processed once.
+    const auto* map = reinterpret_cast<const uint8_t*>(args.PalMap.data());
+    std::unordered_set<uint16_t> processedRows;
+    for (int32_t y = 0; y < g1.height; y++)
+    {
+        uint16_t lineOffset = data[y * 2] | (data[y * 2 + 1] << 8);
+        if (!processedRows.insert(lineOffset).second)
+        {
+            continue;
+        }
+        uint8_t* ptr = data.get() + lineOffset;
+        bool endOfLine = false;
+        do
+        {
+            uint8_t chunk0 = *ptr++;
+            ptr++; // first pixel x
+            uint8_t chunkSize = chunk0 & 0x7F;
+            RemapRunFn(chunkSize, ptr, ptr, map);
+            ptr += chunkSize;
+            endOfLine = (chunk0 & 0x80) != 0;
+        } while (!endOfLine);
+    }
+
+    std::unique_lock lock(_recolourCacheMutex);
+    auto [it, added] = _recolourCache.try_emplace(key);
+    if (added)
+    {
+        it->second.data = std::move(data);
+        _recolourCacheBytes += size;
+    }
+    return it->second.data.get();
+}
+
+void GfxTrimRecolouredSpriteCache()
+{
+    std::unique_lock lock(_recolourCacheMutex);
+    if (_recolourCacheBytes >= kMaxRecolourCacheBytes)
+    {
+        _recolourCache.clear();
+        _recolourCacheBytes = 0;
+    }
+}
+
+void GfxClearRecolouredSpriteCache()
+{
+    std::unique_lock lock(_recolourCacheMutex);
+    _recolourCache.clear();
+    _recolourCacheBytes = 0;
+}
+
 template<DrawBlendOp TBlendOp>
 static void FASTCALL DrawRLESpriteMagnify(RenderTarget& rt, const DrawSpriteArgs& args)
 {
@@ -139,6 +283,15 @@ static void FASTCALL DrawRLESpriteMinify(RenderTarget& rt, const DrawSpriteArgs&
                     std::memcpy(dst, src, numPixels);
                 }
             }
+            else if constexpr (TBlendOp == (kBlendTransparent | kBlendSrc) && TZoom == 0)
+            {
+                // Palette remap run at full zoom: hand the whole run to the
+                // SIMD-dispatched kernel, which matches BlitPixel exactly.
+                if (numPixels > 0)
+                {
+                    RemapRunFn(numPixels, src, reinterpret_cast<uint8_t*>(dst), reinterpret_cast<const uint8_t*>(args.PalMap.data()));
+                }
+            }
             else
             {
                 auto& paletteMap = args.PalMap;
@@ -196,6 +349,16 @@ void FASTCALL GfxRleSpriteToBuffer(RenderTarget& rt, const DrawSpriteArgs& args)
         {
             DrawRLESprite<kBlendTransparent | kBlendSrc | kBlendDst>(rt, args);
         }
+        else if (const auto* recoloured = GetOrAddRecolouredSprite(args))
+        {
+            // The palette is already baked into the cached copy, so it can be
+            // blitted with the plain transparent path.
+            OpenRCT2::G1Element recolouredImage = args.SourceImage;
+            recolouredImage.offset = const_cast<uint8_t*>(recoloured);
+            DrawSpriteArgs recolouredArgs(
+                args.Image, args.PalMap, recolouredImage, args.SrcX, args.SrcY, args.Width, args.Height, args.DestinationBits);
+            DrawRLESprite<kBlendTransparent>(rt, recolouredArgs);
+        }
         else
         {
             DrawRLESprite<kBlendTransparent | kBlendSrc>(rt, args);
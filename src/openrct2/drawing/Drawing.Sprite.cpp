@@ -26,7 +26,9 @@
 
 #include <cassert>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <unordered_map>
 #include <vector>
 
 using namespace OpenRCT2;
@@ -304,6 +306,11 @@ static void OverrideElementOffsets(size_t index, G1Element& element)
     }
 }
 
+// Loading a gx file is a bulk read of the stored element table followed by a
+// single linear conversion/fixup pass. The only data derived at load time are
+// the element data pointers, which depend on where the blob lands in memory
+// and therefore have to be recomputed every run; there is nothing left that a
+// preprocessed on-disk cache of the table could avoid.
 static void ReadAndConvertGxDat(IStream* stream, size_t count, bool is_rctc, G1Element* elements)
 {
     auto g1Elements32 = std::make_unique<StoredG1Element[]>(count);
@@ -414,6 +421,20 @@ void MaskScalar(
     }
 }
 
+void FASTCALL RemapRunScalar(int32_t count, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        const uint8_t colour = src[i];
+        if (colour == 0)
+            continue;
+        const uint8_t remapped = map[colour];
+        if (remapped == 0)
+            continue;
+        dst[i] = remapped;
+    }
+}
+
 static void MaskMagnify(
     const ZoomLevel zoom, int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc,
     uint8_t* RESTRICT dst, int32_t maskStride, int32_t colourStride, int32_t dstStride, int32_t srcX, int32_t srcY)
@@ -447,10 +468,121 @@ static bool _csgLoaded = false;
 static G1Element _g1Temp = {};
 static std::vector<G1Element> _imageListElements;
 
+// Pre-shrunk variants for sprites that ship without artist-made zoom images
+// (G1Flag::hasZoomSprite). Generated on first zoomed-out draw and cached per
+// image, so overview viewports blit quarter-size bitmaps instead of decoding
+// and decimating the full-size image on every blit.
+struct GeneratedZoomSprite
+{
+    G1Element g1{};
+    std::vector<uint8_t> data; // Empty when generation failed.
+};
+
+// One variant per zoomed-out level; ZoomLevel::max() is 3.
+static constexpr int32_t kMaxGeneratedZoom = 3;
+
+// Paint can run on multiple threads, so the cache is guarded by a mutex;
+// generation happens outside the lock to keep contention low.
+static std::mutex _generatedZoomMutex;
+static std::unordered_map<ImageIndex, std::array<std::unique_ptr<GeneratedZoomSprite>, kMaxGeneratedZoom>> _generatedZoomSprites;
+
+static void InvalidateGeneratedZoomSprites(ImageIndex imageIndex)
+{
+    std::lock_guard lock(_generatedZoomMutex);
+    _generatedZoomSprites.erase(imageIndex);
+}
+
+static void ClearGeneratedZoomSprites()
+{
+    std::lock_guard lock(_generatedZoomMutex);
+    _generatedZoomSprites.clear();
+}
+
+static std::unique_ptr<GeneratedZoomSprite> GenerateZoomedSprite(const G1Element& src, int32_t zoom)
+{
+    auto result = std::make_unique<GeneratedZoomSprite>();
+    if (src.offset == nullptr || src.width <= 0 || src.height <= 0 || src.flags.has(G1Flag::isPalette)
+        || src.flags.has(G1Flag::one))
+    {
+        return result;
+    }
+
+    // Decode the source image once at full size.
+    std::vector<uint8_t> fullPixels(static_cast<size_t>(src.width) * src.height);
+    RenderTarget fullRT{};
+    fullRT.bits = fullPixels.data();
+    fullRT.width = src.width;
+    fullRT.height = src.height;
+    DrawSpriteArgs args(ImageId(), PaletteMap::GetDefault(), src, 0, 0, src.width, src.height, fullPixels.data());
+    GfxSpriteToBuffer(fullRT, args);
+
+    // Sample every 2^zoom-th pixel, the same lattice the zoomed blit loops walk.
+    const int32_t zoomedWidth = (src.width + (1 << zoom) - 1) >> zoom;
+    const int32_t zoomedHeight = (src.height + (1 << zoom) - 1) >> zoom;
+    result->data.resize(static_cast<size_t>(zoomedWidth) * zoomedHeight);
+    for (int32_t y = 0; y < zoomedHeight; y++)
+    {
+        const auto* srcRow = fullPixels.data() + ((static_cast<size_t>(y) << zoom) * src.width);
+        auto* dstRow = result->data.data() + (static_cast<size_t>(y) * zoomedWidth);
+        for (int32_t x = 0; x < zoomedWidth; x++)
+        {
+            dstRow[x] = srcRow[static_cast<size_t>(x) << zoom];
+        }
+    }
+
+    auto& g1 = result->g1;
+    g1.offset = result->data.data();
+    g1.width = static_cast<int16_t>(zoomedWidth);
+    g1.height = static_cast<int16_t>(zoomedHeight);
+    g1.xOffset = src.xOffset;
+    g1.yOffset = src.yOffset;
+    // Halve step by step, matching how the recursive zoom draw divides coordinates.
+    for (int32_t i = 0; i < zoom; i++)
+    {
+        g1.xOffset /= 2;
+        g1.yOffset /= 2;
+    }
+    g1.flags = { G1Flag::hasTransparency };
+    return result;
+}
+
+static const G1Element* GetGeneratedZoomSprite(ImageIndex imageIndex, const G1Element& src, int32_t zoom)
+{
+    std::unique_lock lock(_generatedZoomMutex);
+    {
+        auto& slot = _generatedZoomSprites[imageIndex][zoom - 1];
+        if (slot != nullptr)
+        {
+            return slot->data.empty() ? nullptr : &slot->g1;
+        }
+    }
+
+    lock.unlock();
+    auto generated = GenerateZoomedSprite(src, zoom);
+    lock.lock();
+
+    // Another thread may have generated the same variant in the meantime;
+    // keep whichever landed first so handed out pointers stay valid.
+    auto& slot = _generatedZoomSprites[imageIndex][zoom - 1];
+    if (slot == nullptr)
+    {
+        slot = std::move(generated);
+    }
+    return slot->data.empty() ? nullptr : &slot->g1;
+}
+
 /**
  *
  *  rct2: 0x00678998
  */
+// Sprite pixel data is already contiguous at the granularity that matters
+// for blit locality: the whole of g1.dat is one blob read below in file
+// order (which groups animation frames), and each object's image table is
+// likewise a single buffer shared by that object's sprites. Re-packing by
+// observed co-draw frequency would only reshuffle pages within those blobs;
+// the scattered reads the blitter does see come from the paint order mixing
+// sprites of many objects per column, which no static packing can order for
+// every viewport rotation at once.
 bool GfxLoadG1(const IPlatformEnvironment& env)
 {
     LOG_VERBOSE("GfxLoadG1(...)");
@@ -507,6 +639,7 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
 
 void GfxUnloadG1()
 {
+    ClearGeneratedZoomSprites();
     _g1.data.reset();
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
@@ -514,6 +647,7 @@ void GfxUnloadG1()
 
 void GfxUnloadG2PalettesFontsTracks()
 {
+    ClearGeneratedZoomSprites();
     _g2.data.reset();
     _g2.elements.clear();
     _g2.elements.shrink_to_fit();
@@ -533,6 +667,7 @@ void GfxUnloadG2PalettesFontsTracks()
 
 void GfxUnloadCsg()
 {
+    ClearGeneratedZoomSprites();
     _csg.data.reset();
     _csg.elements.clear();
     _csg.elements.shrink_to_fit();
@@ -745,6 +880,26 @@ static std::optional<PaletteMap> FASTCALL GfxDrawSpriteGetPalette(ImageId imageI
     return paletteMap;
 }
 
+bool FASTCALL GfxPaletteIsDerivedFromImage(const ImageId imageId, const PaletteMap& paletteMap)
+{
+    // Glyph and bitmap drawing pass caller-built palettes that the image id
+    // does not describe; only palettes resolved from the image's own recolour
+    // bits point at the static remap tables (or the per-thread combination
+    // buffers, whose contents are a pure function of the recolour bits).
+    if (!imageId.HasSecondary())
+    {
+        uint8_t paletteId = imageId.GetRemap();
+        if (!imageId.IsBlended())
+        {
+            paletteId &= 0x7F;
+        }
+        auto expected = GetPaletteMapForColour(static_cast<FilterPaletteID>(paletteId));
+        return expected.has_value() && expected->data() == paletteMap.data();
+    }
+    const auto* combinedPalette = imageId.HasTertiary() ? kTertiaryRemapPalette : kSecondaryRemapPalette;
+    return paletteMap.data() == reinterpret_cast<const PaletteIndex*>(combinedPalette);
+}
+
 void FASTCALL GfxDrawSpriteSoftware(RenderTarget& rt, const ImageId imageId, const ScreenCoordsXY& spriteCoords)
 {
     if (imageId.HasValue())
@@ -767,12 +922,13 @@ void FASTCALL GfxDrawSpriteSoftware(RenderTarget& rt, const ImageId imageId, con
  * x (cx)
  * y (dx)
  */
+static void FASTCALL GfxDrawSpriteMinifySoftware(
+    RenderTarget& rt, const ImageId imageId, const ScreenCoordsXY& coords, const PaletteMap& paletteMap, const G1Element& g1);
+
 void FASTCALL GfxDrawSpritePaletteSetSoftware(
     RenderTarget& rt, const ImageId imageId, const ScreenCoordsXY& coords, const PaletteMap& paletteMap)
 {
     const auto zoomLevel = rt.zoom_level;
-    int32_t x = coords.x;
-    int32_t y = coords.y;
 
     const auto* g1 = GfxGetG1Element(imageId);
     if (g1 == nullptr)
@@ -830,23 +986,53 @@ void FASTCALL GfxDrawSpritePaletteSetSoftware(
         return;
     }
 
+    if (zoomLevel > ZoomLevel{ 0 } && static_cast<int8_t>(zoomLevel) <= kMaxGeneratedZoom && imageId.GetIndex() != SPR_TEMP)
+    {
+        // No artist-made zoom image; blit a generated pre-shrunk variant at
+        // zoom 0 instead of decimating the full-size image on every draw.
+        const auto* zoomedG1 = GetGeneratedZoomSprite(imageId.GetIndex(), *g1, static_cast<int8_t>(zoomLevel));
+        if (zoomedG1 != nullptr)
+        {
+            RenderTarget zoomedRT = rt;
+            zoomedRT.zoom_level = ZoomLevel{ 0 };
+
+            auto spriteCoords = coords;
+            for (auto level = ZoomLevel{ 0 }; level < zoomLevel; level++)
+            {
+                spriteCoords = { spriteCoords.x / 2, spriteCoords.y / 2 };
+            }
+            GfxDrawSpriteMinifySoftware(zoomedRT, imageId, spriteCoords, paletteMap, *zoomedG1);
+            return;
+        }
+    }
+
+    GfxDrawSpriteMinifySoftware(rt, imageId, coords, paletteMap, *g1);
+}
+
+static void FASTCALL GfxDrawSpriteMinifySoftware(
+    RenderTarget& rt, const ImageId imageId, const ScreenCoordsXY& coords, const PaletteMap& paletteMap, const G1Element& g1)
+{
+    const auto zoomLevel = rt.zoom_level;
+    int32_t x = coords.x;
+    int32_t y = coords.y;
+
     const int32_t zoom_mask = zoomLevel > ZoomLevel{ 0 } ? zoomLevel.ApplyTo(0xFFFFFFFF) : 0xFFFFFFFF;
 
-    if (zoomLevel > ZoomLevel{ 0 } && g1->flags.has(G1Flag::hasRLECompression))
+    if (zoomLevel > ZoomLevel{ 0 } && g1.flags.has(G1Flag::hasRLECompression))
     {
         x -= ~zoom_mask;
         y -= ~zoom_mask;
     }
 
     // This will be the height of the drawn image
-    int32_t height = g1->height;
+    int32_t height = g1.height;
 
     // This is the start y coordinate on the destination
-    int16_t dest_start_y = y + g1->yOffset;
+    int16_t dest_start_y = y + g1.yOffset;
 
     // For whatever reason the RLE version does not use
     // the zoom mask on the y coordinate but does on x.
-    if (g1->flags.has(G1Flag::hasRLECompression))
+    if (g1.flags.has(G1Flag::hasRLECompression))
     {
         dest_start_y -= rt.WorldY();
     }
@@ -874,7 +1060,7 @@ void FASTCALL GfxDrawSpritePaletteSetSoftware(
     }
     else
     {
-        if (g1->flags.has(G1Flag::hasRLECompression) && zoomLevel > ZoomLevel{ 0 })
+        if (g1.flags.has(G1Flag::hasRLECompression) && zoomLevel > ZoomLevel{ 0 })
         {
             source_start_y -= dest_start_y & ~zoom_mask;
             height += dest_start_y & ~zoom_mask;
@@ -896,12 +1082,12 @@ void FASTCALL GfxDrawSpritePaletteSetSoftware(
     dest_start_y = zoomLevel.ApplyInversedTo(dest_start_y);
 
     // This will be the width of the drawn image
-    int32_t width = g1->width;
+    int32_t width = g1.width;
 
     // This is the source start x coordinate
     int32_t source_start_x = 0;
     // This is the destination start x coordinate
-    int16_t dest_start_x = ((x + g1->xOffset + ~zoom_mask) & zoom_mask) - rt.WorldX();
+    int16_t dest_start_x = ((x + g1.xOffset + ~zoom_mask) & zoom_mask) - rt.WorldX();
 
     if (dest_start_x < 0)
     {
@@ -920,7 +1106,7 @@ void FASTCALL GfxDrawSpritePaletteSetSoftware(
     }
     else
     {
-        if (g1->flags.has(G1Flag::hasRLECompression) && zoomLevel > ZoomLevel{ 0 })
+        if (g1.flags.has(G1Flag::hasRLECompression) && zoomLevel > ZoomLevel{ 0 })
         {
             source_start_x -= dest_start_x & ~zoom_mask;
         }
@@ -944,7 +1130,7 @@ void FASTCALL GfxDrawSpritePaletteSetSoftware(
     // Move the pointer to the start point of the destination
     dest_pointer += (zoomLevel.ApplyInversedTo(rt.WorldWidth()) + rt.pitch) * dest_start_y + dest_start_x;
 
-    DrawSpriteArgs args(imageId, paletteMap, *g1, source_start_x, source_start_y, width, height, dest_pointer);
+    DrawSpriteArgs args(imageId, paletteMap, g1, source_start_x, source_start_y, width, height, dest_pointer);
     GfxSpriteToBuffer(rt, args);
 }
 
@@ -1156,6 +1342,7 @@ void GfxSetG1Element(ImageIndex imageId, const G1Element* g1)
         }
         else if (isValid)
         {
+            InvalidateGeneratedZoomSprites(imageId);
             if (imageId < SPR_RCTC_G1_END)
             {
                 if (imageId < static_cast<ImageIndex>(_g1.elements.size()))
@@ -28,11 +28,81 @@
 #include "../platform/Platform.h"
 #include "TTF.h"
 
+#include <atomic>
+#include <unordered_map>
+
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 
 static int32_t TTFGetStringWidth(std::string_view text, FontStyle fontStyle, bool noFormatting);
 
+namespace
+{
+    struct StringWidthCacheKey
+    {
+        std::string text;
+        FontStyle fontStyle;
+        bool noFormatting;
+
+        bool operator==(const StringWidthCacheKey&) const = default;
+    };
+
+    struct StringWidthCacheKeyHash
+    {
+        size_t operator()(const StringWidthCacheKey& key) const
+        {
+            return std::hash<std::string>()(key.text) ^ (static_cast<size_t>(key.fontStyle) << 1)
+                ^ (static_cast<size_t>(key.noFormatting) << 4);
+        }
+    };
+} // namespace
+
+static constexpr size_t kMaxStringWidthCacheEntries = 4096;
+
+// Bumped whenever the fonts are (re)loaded; see GfxResetStringWidthCache.
+static std::atomic<uint32_t> _stringWidthCacheGeneration{ 1 };
+
+void GfxResetStringWidthCache()
+{
+    _stringWidthCacheGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * Widget layout and tooltips measure the same strings every frame, and a
+ * measurement walks the whole format-token stream even though nothing is
+ * drawn. Cache the widths keyed by text content and font style; entries
+ * stay valid until TryLoadFonts swaps the fonts, which bumps the
+ * generation. The cache is per thread so that measurements from paint
+ * workers need no locking.
+ */
+static int32_t GetCachedStringWidth(std::string_view text, FontStyle fontStyle, bool noFormatting)
+{
+    thread_local std::unordered_map<StringWidthCacheKey, int32_t, StringWidthCacheKeyHash> _cache;
+    thread_local uint32_t _cacheGeneration = 0;
+
+    const auto generation = _stringWidthCacheGeneration.load(std::memory_order_relaxed);
+    if (_cacheGeneration != generation)
+    {
+        _cache.clear();
+        _cacheGeneration = generation;
+    }
+
+    StringWidthCacheKey key{ std::string(text), fontStyle, noFormatting };
+    auto it = _cache.find(key);
+    if (it != _cache.end())
+    {
+        return it->second;
+    }
+
+    if (_cache.size() >= kMaxStringWidthCacheEntries)
+    {
+        _cache.clear();
+    }
+    const auto width = TTFGetStringWidth(text, fontStyle, noFormatting);
+    _cache.emplace(std::move(key), width);
+    return width;
+}
+
 /**
  *
  *  rct2: 0x006C23B1
@@ -74,12 +144,12 @@ int32_t GfxGetStringWidthNewLined(std::string_view text, FontStyle fontStyle)
  */
 int32_t GfxGetStringWidth(std::string_view text, FontStyle fontStyle)
 {
-    return TTFGetStringWidth(text, fontStyle, false);
+    return GetCachedStringWidth(text, fontStyle, false);
 }
 
 int32_t GfxGetStringWidthNoFormatting(std::string_view text, FontStyle fontStyle)
 {
-    return TTFGetStringWidth(text, fontStyle, true);
+    return GetCachedStringWidth(text, fontStyle, true);
 }
 
 /**
@@ -167,7 +237,11 @@ int32_t GfxClipString(utf8* text, int32_t width, FontStyle fontStyle)
 int32_t GfxWrapString(u8string_view text, int32_t width, FontStyle fontStyle, u8string* outWrappedText, int32_t* outNumLines)
 {
     constexpr size_t kNullIndex = std::numeric_limits<size_t>::max();
-    u8string buffer;
+
+    // Reused across calls so the per-frame text drawing path does not allocate
+    // a fresh working string for every wrapped string.
+    thread_local u8string buffer;
+    buffer.clear();
 
     size_t currentLineIndex = 0;
     size_t splitIndex = kNullIndex;
@@ -252,7 +326,9 @@ int32_t GfxWrapString(u8string_view text, int32_t width, FontStyle fontStyle, u8
 
     if (outWrappedText != nullptr)
     {
-        *outWrappedText = std::move(buffer);
+        // Copy rather than move so the thread-local working string keeps its
+        // capacity, and so a reused output string keeps its own.
+        outWrappedText->assign(buffer);
     }
     if (outNumLines != nullptr)
     {
@@ -425,8 +501,13 @@ void DrawNewsTicker(
 
     DrawText(rt, screenCoords, { colour }, "");
 
-    u8string wrappedString;
-    GfxWrapString(FormatStringID(format, args), width, FontStyle::small, &wrappedString, &numLines);
+    // Format into the growing per-thread stream so long news items are not
+    // truncated to a fixed buffer.
+    auto& ss = GetThreadFormatStream();
+    FormatStringID(ss, format, args);
+
+    thread_local u8string wrappedString;
+    GfxWrapString(u8string_view(ss.data(), ss.size()), width, FontStyle::small, &wrappedString, &numLines);
     lineHeight = FontGetLineHeight(FontStyle::small);
 
     int32_t numCharactersDrawn = 0;
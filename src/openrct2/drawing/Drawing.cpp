@@ -505,6 +505,30 @@ void MaskFn(
     MaskFunc(width, height, maskSrc, colourSrc, dst, maskWrap, colourWrap, dstWrap);
 }
 
+static auto GetRemapRunFunction()
+{
+#ifdef __ARM_NEON
+    LOG_VERBOSE("registering NEON remap run function");
+    return RemapRunNeon;
+#else
+    if (Platform::AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 remap run function");
+        return RemapRunAvx2;
+    }
+
+    LOG_VERBOSE("registering scalar remap run function");
+    return RemapRunScalar;
+#endif
+}
+
+static const auto RemapRunFunc = GetRemapRunFunction();
+
+void FASTCALL RemapRunFn(int32_t count, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map)
+{
+    RemapRunFunc(count, src, dst, map);
+}
+
 void GfxFilterPixel(RenderTarget& rt, const ScreenCoordsXY& coords, FilterPaletteID palette)
 {
     Rectangle::filter(rt, { coords, coords }, palette);
@@ -117,6 +117,11 @@ public:
     OpenRCT2::Drawing::PaletteIndex& operator[](size_t index);
     OpenRCT2::Drawing::PaletteIndex operator[](size_t index) const;
 
+    const OpenRCT2::Drawing::PaletteIndex* data() const
+    {
+        return _data.data();
+    }
+
     OpenRCT2::Drawing::PaletteIndex Blend(OpenRCT2::Drawing::PaletteIndex src, OpenRCT2::Drawing::PaletteIndex dst) const;
     void Copy(
         OpenRCT2::Drawing::PaletteIndex dstIndex, const PaletteMap& src, OpenRCT2::Drawing::PaletteIndex srcIndex,
@@ -279,6 +284,13 @@ bool IsCsgLoaded();
 void FASTCALL GfxSpriteToBuffer(OpenRCT2::Drawing::RenderTarget& rt, const DrawSpriteArgs& args);
 void FASTCALL GfxBmpSpriteToBuffer(OpenRCT2::Drawing::RenderTarget& rt, const DrawSpriteArgs& args);
 void FASTCALL GfxRleSpriteToBuffer(OpenRCT2::Drawing::RenderTarget& rt, const DrawSpriteArgs& args);
+bool FASTCALL GfxPaletteIsDerivedFromImage(ImageId imageId, const PaletteMap& paletteMap);
+// Empties the pre-remapped sprite cache once it outgrows its budget; called
+// between frames while no sprite drawing is in progress.
+void GfxTrimRecolouredSpriteCache();
+// Called when object images are freed so stale recolourings of reused image
+// indices cannot be drawn.
+void GfxClearRecolouredSpriteCache();
 void FASTCALL GfxDrawSprite(OpenRCT2::Drawing::RenderTarget& rt, ImageId image_id, const ScreenCoordsXY& coords);
 void FASTCALL GfxDrawGlyph(
     OpenRCT2::Drawing::RenderTarget& rt, ImageId image, const ScreenCoordsXY& coords, const PaletteMap& paletteMap);
@@ -306,6 +318,7 @@ void GfxDrawStringWithYOffsets(
 
 int32_t GfxWrapString(u8string_view text, int32_t width, FontStyle fontStyle, u8string* outWrappedText, int32_t* outNumLines);
 int32_t GfxGetStringWidth(std::string_view text, FontStyle fontStyle);
+void GfxResetStringWidthCache();
 int32_t GfxGetStringWidthNewLined(std::string_view text, FontStyle fontStyle);
 int32_t GfxGetStringWidthNoFormatting(std::string_view text, FontStyle fontStyle);
 int32_t StringGetHeightRaw(std::string_view text, FontStyle fontStyle);
@@ -331,6 +344,16 @@ void MaskFn(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+// Applies a palette remap to a run of opaque RLE pixels: for each source pixel
+// that is not transparent and whose remapped value is not transparent, the
+// remapped value is written to the destination. Matches the scalar BlitPixel
+// semantics for kBlendTransparent | kBlendSrc exactly.
+void FASTCALL RemapRunScalar(int32_t count, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map);
+void FASTCALL RemapRunAvx2(int32_t count, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map);
+void FASTCALL RemapRunNeon(int32_t count, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map);
+
+void FASTCALL RemapRunFn(int32_t count, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map);
+
 std::optional<uint32_t> GetPaletteG1Index(OpenRCT2::Drawing::FilterPaletteID paletteId);
 std::optional<PaletteMap> GetPaletteMapForColour(OpenRCT2::Drawing::FilterPaletteID paletteId);
 void UpdatePalette(
@@ -227,6 +227,7 @@ void GfxObjectFreeImages(uint32_t baseImageId, uint32_t count)
             DrawingEngineInvalidateImage(imageId);
         }
 
+        GfxClearRecolouredSpriteCache();
         FreeImageList(baseImageId, count);
     }
 }
@@ -7,6 +7,14 @@
 
 namespace OpenRCT2::Drawing
 {
+    // One grid per drawing engine, in screen space. Viewports translate their
+    // world-space invalidations into screen rectangles before they get here,
+    // so several viewports at different zooms share the grid without caring
+    // about each other's scale. Per-viewport, zoom-aware grids would not help:
+    // a zoom change rescales every visible pixel of that viewport, so none of
+    // its previous dirty state is reusable, and plain camera pans are already
+    // handled by shifting the framebuffer (CopyRect) and repainting only the
+    // exposed edges.
     class InvalidationGrid
     {
         uint16_t _blockWidth{};
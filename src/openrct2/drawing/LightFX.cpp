@@ -27,6 +27,8 @@
 
 #include <cmath>
 #include <cstring>
+#include <optional>
+#include <vector>
 
 namespace OpenRCT2::Drawing::LightFx
 {
@@ -86,6 +88,21 @@ namespace OpenRCT2::Drawing::LightFx
 
     static GamePalette gPalette_light;
 
+    // State of the previously rendered frame, used to recomposite only the
+    // regions whose lights actually changed.
+    static std::vector<LightListEntry> _renderedLightList;
+    static int16_t _rendered_view_x;
+    static int16_t _rendered_view_y;
+    static uint8_t _rendered_view_rotation;
+    static ZoomLevel _rendered_view_zoom{ 0 };
+    static int32_t _renderedWidth;
+    static int32_t _renderedHeight;
+    static bool _renderedBufferValid = false;
+
+    // Re-rendering per changed region stops paying off once most of the
+    // screen is dirty anyway.
+    constexpr size_t kMaxIncrementalLightRegions = 64;
+
     constexpr uint8_t GetLightTypeSize(LightType type)
     {
         return static_cast<uint8_t>(type) & 0x3;
@@ -196,6 +213,7 @@ namespace OpenRCT2::Drawing::LightFx
         _light_rendered_buffer_front = realloc(_light_rendered_buffer_front, info.width * info.height);
         _light_rendered_buffer_back = realloc(_light_rendered_buffer_back, info.width * info.height);
         _pixelInfo = info;
+        _renderedBufferValid = false;
     }
 
     static void PrepareLightList(const Viewport& vp)
@@ -448,176 +466,235 @@ namespace OpenRCT2::Drawing::LightFx
         _current_view_zoom_back = vp.zoom;
     }
 
-    static void RenderLightsToFrontBuffer()
+    struct BakedLightTexture
     {
-        if (_light_rendered_buffer_front == nullptr)
+        const uint8_t* base;
+        int32_t size;
+    };
+
+    static BakedLightTexture GetBakedLightTexture(LightType type)
+    {
+        switch (type)
         {
-            return;
+            case LightType::Lantern0:
+                return { _bakedLightTexture_lantern_0, 32 };
+            case LightType::Lantern1:
+                return { _bakedLightTexture_lantern_1, 64 };
+            case LightType::Lantern2:
+                return { _bakedLightTexture_lantern_2, 128 };
+            case LightType::Lantern3:
+                return { _bakedLightTexture_lantern_3, 256 };
+            case LightType::Spot0:
+                return { _bakedLightTexture_spot_0, 32 };
+            case LightType::Spot1:
+                return { _bakedLightTexture_spot_1, 64 };
+            case LightType::Spot2:
+                return { _bakedLightTexture_spot_2, 128 };
+            case LightType::Spot3:
+                return { _bakedLightTexture_spot_3, 256 };
+            default:
+                return { nullptr, 0 };
         }
+    }
 
-        std::memset(_light_rendered_buffer_front, 0, _pixelInfo.width * _pixelInfo.height);
-
-        _lightPolution_back = 0;
-
-        //  LOG_WARNING("%i lights", LightListCurrentCountFront);
+    static ScreenCoordsXY GetLightScreenCentre(const LightListEntry& entry)
+    {
+        int32_t inRectCentreX = entry.viewCoords.x;
+        int32_t inRectCentreY = entry.viewCoords.y;
 
-        for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
+        if (entry.position.z != 0x7FFF)
         {
-            const uint8_t* bufReadBase = nullptr;
-            uint8_t* bufWriteBase = static_cast<uint8_t*>(_light_rendered_buffer_front);
-            uint32_t bufReadWidth, bufReadHeight;
-            int32_t bufWriteX, bufWriteY;
-            int32_t bufWriteWidth, bufWriteHeight;
-            uint32_t bufReadSkip, bufWriteSkip;
+            inRectCentreX -= _current_view_x_front;
+            inRectCentreY -= _current_view_y_front;
+            inRectCentreX = _current_view_zoom_front.ApplyInversedTo(inRectCentreX);
+            inRectCentreY = _current_view_zoom_front.ApplyInversedTo(inRectCentreY);
+        }
+        return { inRectCentreX, inRectCentreY };
+    }
 
-            LightListEntry& entry = _LightListFront[light];
+    // Returns the screen-clipped destination rectangle of a light, or nullopt
+    // when the light is off-screen or has no texture.
+    static std::optional<ScreenRect> GetLightScreenRect(const LightListEntry& entry)
+    {
+        const auto texture = GetBakedLightTexture(entry.type);
+        if (texture.base == nullptr)
+            return std::nullopt;
+
+        // Clamp the reads to be no larger than the buffer size
+        const int32_t readHeight = std::min<int32_t>(_pixelInfo.height, texture.size);
+        const int32_t readWidth = std::min<int32_t>(_pixelInfo.width, texture.size);
+
+        const auto centre = GetLightScreenCentre(entry);
+        const int32_t dstX = centre.x - readWidth / 2;
+        const int32_t dstY = centre.y - readHeight / 2;
+
+        const int32_t left = std::max(dstX, 0);
+        const int32_t top = std::max(dstY, 0);
+        const int32_t right = std::min<int32_t>(dstX + readWidth, _pixelInfo.width);
+        const int32_t bottom = std::min<int32_t>(dstY + readHeight, _pixelInfo.height);
+        if (left >= right || top >= bottom)
+            return std::nullopt;
+
+        return ScreenRect{ { left, top }, { right, bottom } };
+    }
 
-            int32_t inRectCentreX = entry.viewCoords.x;
-            int32_t inRectCentreY = entry.viewCoords.y;
+    static void RenderLight(const LightListEntry& entry, int32_t clipLeft, int32_t clipTop, int32_t clipRight, int32_t clipBottom)
+    {
+        const auto texture = GetBakedLightTexture(entry.type);
+        if (texture.base == nullptr)
+            return;
 
-            if (entry.position.z != 0x7FFF)
-            {
-                inRectCentreX -= _current_view_x_front;
-                inRectCentreY -= _current_view_y_front;
-                inRectCentreX = _current_view_zoom_front.ApplyInversedTo(inRectCentreX);
-                inRectCentreY = _current_view_zoom_front.ApplyInversedTo(inRectCentreY);
-            }
+        // Clamp the reads to be no larger than the buffer size
+        const int32_t readHeight = std::min<int32_t>(_pixelInfo.height, texture.size);
+        const int32_t readWidth = std::min<int32_t>(_pixelInfo.width, texture.size);
 
-            switch (entry.type)
-            {
-                case LightType::Lantern0:
-                    bufReadWidth = 32;
-                    bufReadHeight = 32;
-                    bufReadBase = _bakedLightTexture_lantern_0;
-                    break;
-                case LightType::Lantern1:
-                    bufReadWidth = 64;
-                    bufReadHeight = 64;
-                    bufReadBase = _bakedLightTexture_lantern_1;
-                    break;
-                case LightType::Lantern2:
-                    bufReadWidth = 128;
-                    bufReadHeight = 128;
-                    bufReadBase = _bakedLightTexture_lantern_2;
-                    break;
-                case LightType::Lantern3:
-                    bufReadWidth = 256;
-                    bufReadHeight = 256;
-                    bufReadBase = _bakedLightTexture_lantern_3;
-                    break;
-                case LightType::Spot0:
-                    bufReadWidth = 32;
-                    bufReadHeight = 32;
-                    bufReadBase = _bakedLightTexture_spot_0;
-                    break;
-                case LightType::Spot1:
-                    bufReadWidth = 64;
-                    bufReadHeight = 64;
-                    bufReadBase = _bakedLightTexture_spot_1;
-                    break;
-                case LightType::Spot2:
-                    bufReadWidth = 128;
-                    bufReadHeight = 128;
-                    bufReadBase = _bakedLightTexture_spot_2;
-                    break;
-                case LightType::Spot3:
-                    bufReadWidth = 256;
-                    bufReadHeight = 256;
-                    bufReadBase = _bakedLightTexture_spot_3;
-                    break;
-                default:
-                    continue;
-            }
+        const auto centre = GetLightScreenCentre(entry);
+        const int32_t dstX = centre.x - readWidth / 2;
+        const int32_t dstY = centre.y - readHeight / 2;
 
-            // Clamp the reads to be no larger than the buffer size
-            bufReadHeight = std::min<uint32_t>(_pixelInfo.height, bufReadHeight);
-            bufReadWidth = std::min<uint32_t>(_pixelInfo.width, bufReadWidth);
+        const int32_t left = std::max({ dstX, clipLeft, 0 });
+        const int32_t top = std::max({ dstY, clipTop, 0 });
+        const int32_t right = std::min({ dstX + readWidth, clipRight, static_cast<int32_t>(_pixelInfo.width) });
+        const int32_t bottom = std::min({ dstY + readHeight, clipBottom, static_cast<int32_t>(_pixelInfo.height) });
 
-            bufWriteX = inRectCentreX - bufReadWidth / 2;
-            bufWriteY = inRectCentreY - bufReadHeight / 2;
+        const int32_t bufWriteWidth = right - left;
+        const int32_t bufWriteHeight = bottom - top;
+        if (bufWriteWidth <= 0 || bufWriteHeight <= 0)
+            return;
 
-            bufWriteWidth = bufReadWidth;
-            bufWriteHeight = bufReadHeight;
+        const uint8_t* bufReadBase = texture.base + (top - dstY) * texture.size + (left - dstX);
+        uint8_t* bufWriteBase = static_cast<uint8_t*>(_light_rendered_buffer_front) + top * _pixelInfo.width + left;
 
-            if (bufWriteX < 0)
-            {
-                bufReadBase += -bufWriteX;
-                bufWriteWidth += bufWriteX;
-            }
-            else
-            {
-                bufWriteBase += bufWriteX;
-            }
+        const uint32_t bufReadSkip = texture.size - bufWriteWidth;
+        const uint32_t bufWriteSkip = _pixelInfo.width - bufWriteWidth;
 
-            if (bufWriteWidth <= 0)
-                continue;
-
-            if (bufWriteY < 0)
+        if (entry.lightIntensity == 0xFF)
+        {
+            for (int32_t y = 0; y < bufWriteHeight; y++)
             {
-                bufReadBase += -bufWriteY * bufReadWidth;
-                bufWriteHeight += bufWriteY;
+                for (int32_t x = 0; x < bufWriteWidth; x++)
+                {
+                    *bufWriteBase = std::min(0xFF, *bufWriteBase + *bufReadBase);
+                    bufWriteBase++;
+                    bufReadBase++;
+                }
+
+                bufWriteBase += bufWriteSkip;
+                bufReadBase += bufReadSkip;
             }
-            else
+        }
+        else
+        {
+            for (int32_t y = 0; y < bufWriteHeight; y++)
             {
-                bufWriteBase += bufWriteY * _pixelInfo.width;
+                for (int32_t x = 0; x < bufWriteWidth; x++)
+                {
+                    *bufWriteBase = std::min(0xFF, *bufWriteBase + (((*bufReadBase) * (1 + entry.lightIntensity)) >> 8));
+                    bufWriteBase++;
+                    bufReadBase++;
+                }
+
+                bufWriteBase += bufWriteSkip;
+                bufReadBase += bufReadSkip;
             }
+        }
+    }
 
-            if (bufWriteHeight <= 0)
-                continue;
 
-            int32_t rightEdge = bufWriteX + bufWriteWidth;
-            int32_t bottomEdge = bufWriteY + bufWriteHeight;
+    static void ClearLightRegion(int32_t left, int32_t top, int32_t right, int32_t bottom)
+    {
+        uint8_t* base = static_cast<uint8_t*>(_light_rendered_buffer_front) + top * _pixelInfo.width + left;
+        for (int32_t y = top; y < bottom; y++)
+        {
+            std::memset(base, 0, right - left);
+            base += _pixelInfo.width;
+        }
+    }
 
-            if (rightEdge > _pixelInfo.width)
-            {
-                bufWriteWidth -= rightEdge - _pixelInfo.width;
-            }
-            if (bottomEdge > _pixelInfo.height)
+    static void RenderLightsToFrontBuffer()
+    {
+        if (_light_rendered_buffer_front == nullptr)
+        {
+            return;
+        }
+
+        // Light pollution only depends on the clipped light areas, so keep it
+        // exact regardless of how much of the buffer gets recomposited.
+        _lightPolution_back = 0;
+        for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
+        {
+            if (auto rect = GetLightScreenRect(_LightListFront[light]); rect.has_value())
             {
-                bufWriteHeight -= bottomEdge - _pixelInfo.height;
+                _lightPolution_back += (rect->GetWidth() * rect->GetHeight()) / 256;
             }
+        }
 
-            if (bufWriteWidth <= 0)
-                continue;
-            if (bufWriteHeight <= 0)
-                continue;
+        const bool viewUnchanged = _renderedBufferValid && _rendered_view_x == _current_view_x_front
+            && _rendered_view_y == _current_view_y_front && _rendered_view_rotation == _current_view_rotation_front
+            && _rendered_view_zoom == _current_view_zoom_front && _renderedWidth == _pixelInfo.width
+            && _renderedHeight == _pixelInfo.height;
 
-            _lightPolution_back += (bufWriteWidth * bufWriteHeight) / 256;
+        bool incremental = viewUnchanged && _renderedLightList.size() == LightListCurrentCountFront;
+        if (incremental)
+        {
+            // Collect the regions of lights that changed since the last frame.
+            std::vector<ScreenRect> dirtyRegions;
+            for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
+            {
+                const auto& prevEntry = _renderedLightList[light];
+                const auto& entry = _LightListFront[light];
+                if (std::memcmp(&prevEntry, &entry, sizeof(LightListEntry)) == 0)
+                    continue;
 
-            bufReadSkip = bufReadWidth - bufWriteWidth;
-            bufWriteSkip = _pixelInfo.width - bufWriteWidth;
+                if (auto rect = GetLightScreenRect(prevEntry); rect.has_value())
+                    dirtyRegions.push_back(*rect);
+                if (auto rect = GetLightScreenRect(entry); rect.has_value())
+                    dirtyRegions.push_back(*rect);
 
-            if (entry.lightIntensity == 0xFF)
-            {
-                for (int32_t y = 0; y < bufWriteHeight; y++)
+                if (dirtyRegions.size() > kMaxIncrementalLightRegions)
                 {
-                    for (int32_t x = 0; x < bufWriteWidth; x++)
-                    {
-                        *bufWriteBase = std::min(0xFF, *bufWriteBase + *bufReadBase);
-                        bufWriteBase++;
-                        bufReadBase++;
-                    }
-
-                    bufWriteBase += bufWriteSkip;
-                    bufReadBase += bufReadSkip;
+                    incremental = false;
+                    break;
                 }
             }
-            else
+
+            if (incremental)
             {
-                for (int32_t y = 0; y < bufWriteHeight; y++)
+                for (const auto& region : dirtyRegions)
                 {
-                    for (int32_t x = 0; x < bufWriteWidth; x++)
+                    const auto left = region.GetLeft();
+                    const auto top = region.GetTop();
+                    const auto right = region.GetRight();
+                    const auto bottom = region.GetBottom();
+
+                    ClearLightRegion(left, top, right, bottom);
+                    for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
                     {
-                        *bufWriteBase = std::min(0xFF, *bufWriteBase + (((*bufReadBase) * (1 + entry.lightIntensity)) >> 8));
-                        bufWriteBase++;
-                        bufReadBase++;
+                        RenderLight(_LightListFront[light], left, top, right, bottom);
                     }
-
-                    bufWriteBase += bufWriteSkip;
-                    bufReadBase += bufReadSkip;
                 }
             }
         }
+
+        if (!incremental)
+        {
+            std::memset(_light_rendered_buffer_front, 0, _pixelInfo.width * _pixelInfo.height);
+            for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
+            {
+                RenderLight(
+                    _LightListFront[light], 0, 0, static_cast<int32_t>(_pixelInfo.width),
+                    static_cast<int32_t>(_pixelInfo.height));
+            }
+        }
+
+        _renderedLightList.assign(_LightListFront, _LightListFront + LightListCurrentCountFront);
+        _rendered_view_x = _current_view_x_front;
+        _rendered_view_y = _current_view_y_front;
+        _rendered_view_rotation = _current_view_rotation_front;
+        _rendered_view_zoom = _current_view_zoom_front;
+        _renderedWidth = _pixelInfo.width;
+        _renderedHeight = _pixelInfo.height;
+        _renderedBufferValid = true;
     }
 
     static void* GetFrontBuffer()
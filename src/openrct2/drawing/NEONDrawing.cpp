@@ -0,0 +1,68 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../core/Guard.hpp"
+#include "Drawing.h"
+
+#ifdef __ARM_NEON
+
+    #include <arm_neon.h>
+
+void FASTCALL RemapRunNeon(int32_t count, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map)
+{
+    if (count < 16)
+    {
+        RemapRunScalar(count, src, dst, map);
+        return;
+    }
+
+    // The 256 entry map is split into four 64 byte lookup tables. Out of range
+    // indices yield zero from vqtbl4q, so the per-range results can simply be
+    // OR-combined.
+    const uint8x16x4_t table0 = vld1q_u8_x4(map);
+    const uint8x16x4_t table1 = vld1q_u8_x4(map + 64);
+    const uint8x16x4_t table2 = vld1q_u8_x4(map + 128);
+    const uint8x16x4_t table3 = vld1q_u8_x4(map + 192);
+    const uint8x16_t sixtyFour = vdupq_n_u8(64);
+
+    int32_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        const uint8x16_t colour = vld1q_u8(src + i);
+        uint8x16_t index = colour;
+        uint8x16_t remapped = vqtbl4q_u8(table0, index);
+        index = vsubq_u8(index, sixtyFour);
+        remapped = vorrq_u8(remapped, vqtbl4q_u8(table1, index));
+        index = vsubq_u8(index, sixtyFour);
+        remapped = vorrq_u8(remapped, vqtbl4q_u8(table2, index));
+        index = vsubq_u8(index, sixtyFour);
+        remapped = vorrq_u8(remapped, vqtbl4q_u8(table3, index));
+
+        // Skip transparent source pixels and transparent remap results.
+        const uint8x16_t keep = vbicq_u8(
+            vmvnq_u8(vceqq_u8(remapped, vdupq_n_u8(0))), vceqq_u8(colour, vdupq_n_u8(0)));
+
+        const uint8x16_t oldDst = vld1q_u8(dst + i);
+        vst1q_u8(dst + i, vbslq_u8(keep, remapped, oldDst));
+    }
+
+    if (i < count)
+    {
+        RemapRunScalar(count - i, src + i, dst + i, map);
+    }
+}
+
+#else
+
+void FASTCALL RemapRunNeon(int32_t count, const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, const uint8_t* RESTRICT map)
+{
+    OpenRCT2::Guard::Fail("NEON function called on a CPU that doesn't support NEON");
+}
+
+#endif // __ARM_NEON
@@ -24,6 +24,7 @@
 
 #include <cassert>
 #include <mutex>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -40,13 +41,37 @@ namespace OpenRCT2::Drawing::ScrollingText
         PaletteIndex bitmap[64 * 40];
     };
 
+    // One pixel column of rendered text: an 8 pixel high monochrome column
+    // with the colour the active colour token gave it.
+    struct ScrollStripColumn
+    {
+        uint8_t bitmap;
+        PaletteIndex colour;
+    };
+
+    // A rendered scroll strip: the glyph columns of a formatted string with
+    // colour tokens already applied. Strips are independent of the scroll
+    // offset and scrolling mode, so a banner that merely advanced only needs
+    // the cheap column blit instead of re-formatting and re-rendering glyphs.
+    struct ScrollStrip
+    {
+        StringId string_id;
+        uint8_t string_args[32];
+        PaletteIndex colour;
+        uint32_t id;
+        std::vector<ScrollStripColumn> columns;
+    };
+
+    static constexpr int32_t kMaxStrips = 128;
+
     static DrawScrollText _drawScrollTextList[kMaxEntries];
+    static ScrollStrip _scrollStrips[kMaxStrips];
     static uint8_t _characterBitmaps[SPR_FONTS_GLYPH_COUNT][8];
     static uint32_t _drawSCrollNextIndex = 0;
     static std::mutex _mutex;
 
     static void setBitmapForSprite(
-        std::string_view text, int32_t scroll, PaletteIndex* bitmap, const int16_t* scrollPositionOffsets, PaletteIndex colour);
+        const ScrollStrip& strip, int32_t scroll, PaletteIndex* bitmap, const int16_t* scrollPositionOffsets);
     static void setBitmapForTTF(
         std::string_view text, int32_t scroll, PaletteIndex* bitmap, const int16_t* scrollPositionOffsets, PaletteIndex colour);
 
@@ -143,16 +168,84 @@ namespace OpenRCT2::Drawing::ScrollingText
         return scrollIndex;
     }
 
-    static void format(utf8* dst, size_t size, DrawScrollText* scrollText)
+    static void format(utf8* dst, size_t size, StringId stringId, const uint8_t* args)
     {
         if (Config::Get().general.upperCaseBanners)
         {
-            FormatStringToUpper(dst, size, scrollText->string_id, scrollText->string_args);
+            FormatStringToUpper(dst, size, stringId, args);
         }
         else
         {
-            FormatStringLegacy(dst, size, scrollText->string_id, scrollText->string_args);
+            FormatStringLegacy(dst, size, stringId, args);
+        }
+    }
+
+    static void renderStrip(ScrollStrip& strip, std::string_view text)
+    {
+        auto characterColour = strip.colour;
+        auto fmt = FmtString(text);
+
+        // Bake up to four repetitions of the string, matching the previous
+        // per-frame composition which repeated it at most four times.
+        for (auto i = 0; i < 4; i++)
+        {
+            for (const auto& token : fmt)
+            {
+                if (token.IsLiteral())
+                {
+                    CodepointView codepoints(token.text);
+                    for (auto codepoint : codepoints)
+                    {
+                        auto characterWidth = FontSpriteGetCodepointWidth(FontStyle::tiny, codepoint);
+                        auto characterBitmap = FontSpriteGetCodepointBitmap(codepoint);
+                        for (; characterWidth != 0; characterWidth--, characterBitmap++)
+                        {
+                            strip.columns.push_back({ *characterBitmap, characterColour });
+                        }
+                    }
+                }
+                else if (FormatTokenIsColour(token.kind))
+                {
+                    auto colourIndex = FormatTokenToTextColour(token.kind);
+                    characterColour = getTextColourMapping(colourIndex).fill;
+                }
+            }
+        }
+    }
+
+    static const ScrollStrip& getOrRenderStrip(StringId stringId, const uint8_t* args, PaletteIndex colour)
+    {
+        uint32_t oldestId = 0xFFFFFFFF;
+        size_t stripIndex = 0;
+        for (size_t i = 0; i < std::size(_scrollStrips); i++)
+        {
+            auto& strip = _scrollStrips[i];
+            if (oldestId >= strip.id)
+            {
+                oldestId = strip.id;
+                stripIndex = i;
+            }
+
+            if (strip.string_id == stringId && std::memcmp(strip.string_args, args, sizeof(strip.string_args)) == 0
+                && strip.colour == colour)
+            {
+                strip.id = _drawSCrollNextIndex;
+                return strip;
+            }
         }
+
+        // Render the strip into the oldest slot
+        auto& strip = _scrollStrips[stripIndex];
+        strip.string_id = stringId;
+        std::memcpy(strip.string_args, args, sizeof(strip.string_args));
+        strip.colour = colour;
+        strip.id = _drawSCrollNextIndex;
+        strip.columns.clear();
+
+        utf8 scrollString[256];
+        format(scrollString, sizeof(scrollString), stringId, args);
+        renderStrip(strip, scrollString);
+        return strip;
     }
 
     extern bool TempForScrollText;
@@ -1431,6 +1524,12 @@ static constexpr const int16_t* kScrollPositions[kMaxModes] = {
             scrollText.string_id = 0;
             std::memset(scrollText.string_args, 0, sizeof(scrollText.string_args));
         }
+        for (auto& strip : _scrollStrips)
+        {
+            strip.string_id = 0;
+            std::memset(strip.string_args, 0, sizeof(strip.string_args));
+            strip.columns.clear();
+        }
     }
 
     ImageId setup(
@@ -1458,20 +1557,19 @@ static constexpr const int16_t* kScrollPositions[kMaxModes] = {
         scrollText->mode = scrollingMode;
         scrollText->id = _drawSCrollNextIndex;
 
-        // Create the string to draw
-        utf8 scrollString[256];
-        format(scrollString, 256, scrollText);
-
         const int16_t* scrollingModePositions = kScrollPositions[scrollingMode];
 
         std::fill_n(scrollText->bitmap, 320 * 8, PaletteIndex::transparent);
         if (LocalisationService_UseTrueTypeFont())
         {
+            utf8 scrollString[256];
+            format(scrollString, sizeof(scrollString), stringId, scrollText->string_args);
             setBitmapForTTF(scrollString, scroll, scrollText->bitmap, scrollingModePositions, colour);
         }
         else
         {
-            setBitmapForSprite(scrollString, scroll, scrollText->bitmap, scrollingModePositions, colour);
+            const auto& strip = getOrRenderStrip(stringId, scrollText->string_args, colour);
+            setBitmapForSprite(strip, scroll, scrollText->bitmap, scrollingModePositions);
         }
 
         uint32_t imageId = SPR_SCROLLING_TEXT_START + scrollIndex;
@@ -1480,58 +1578,35 @@ static constexpr const int16_t* kScrollPositions[kMaxModes] = {
     }
 
     static void setBitmapForSprite(
-        std::string_view text, int32_t scroll, PaletteIndex* bitmap, const int16_t* scrollPositionOffsets, PaletteIndex colour)
+        const ScrollStrip& strip, int32_t scroll, PaletteIndex* bitmap, const int16_t* scrollPositionOffsets)
     {
-        auto characterColour = colour;
-        auto fmt = FmtString(text);
-
-        // Repeat string a maximum of four times (eliminates possibility of infinite loop)
-        for (auto i = 0; i < 4; i++)
+        // Composite the pre-rendered columns, skipping the first `scroll`
+        // columns of the strip.
+        for (const auto& column : strip.columns)
         {
-            for (const auto& token : fmt)
+            if (scroll != 0)
             {
-                if (token.IsLiteral())
-                {
-                    CodepointView codepoints(token.text);
-                    for (auto codepoint : codepoints)
-                    {
-                        auto characterWidth = FontSpriteGetCodepointWidth(FontStyle::tiny, codepoint);
-                        auto characterBitmap = FontSpriteGetCodepointBitmap(codepoint);
-                        for (; characterWidth != 0; characterWidth--, characterBitmap++)
-                        {
-                            // Skip any non-displayed columns
-                            if (scroll != 0)
-                            {
-                                scroll--;
-                                continue;
-                            }
-
-                            int16_t scrollPosition = *scrollPositionOffsets;
-                            if (scrollPosition == -1)
-                                return;
+                scroll--;
+                continue;
+            }
 
-                            if (scrollPosition > -1)
-                            {
-                                auto dst = &bitmap[scrollPosition];
-                                for (uint8_t char_bitmap = *characterBitmap; char_bitmap != 0; char_bitmap >>= 1)
-                                {
-                                    if (char_bitmap & 1)
-                                        *dst = characterColour;
+            int16_t scrollPosition = *scrollPositionOffsets;
+            if (scrollPosition == -1)
+                return;
 
-                                    // Jump to next row
-                                    dst += 64;
-                                }
-                            }
-                            scrollPositionOffsets++;
-                        }
-                    }
-                }
-                else if (FormatTokenIsColour(token.kind))
+            if (scrollPosition > -1)
+            {
+                auto dst = &bitmap[scrollPosition];
+                for (uint8_t char_bitmap = column.bitmap; char_bitmap != 0; char_bitmap >>= 1)
                 {
-                    auto colourIndex = FormatTokenToTextColour(token.kind);
-                    characterColour = getTextColourMapping(colourIndex).fill;
+                    if (char_bitmap & 1)
+                        *dst = column.colour;
+
+                    // Jump to next row
+                    dst += 64;
                 }
             }
+            scrollPositionOffsets++;
         }
     }
 
@@ -1542,7 +1617,12 @@ static constexpr const int16_t* kScrollPositions[kMaxModes] = {
         auto fontDesc = TTFGetFontFromSpriteBase(FontStyle::tiny);
         if (fontDesc->font == nullptr)
         {
-            setBitmapForSprite(text, scroll, bitmap, scrollPositionOffsets, colour);
+            // No TTF font loaded; render with the sprite font via a transient
+            // strip (this path is cold, so it is not worth caching).
+            ScrollStrip strip{};
+            strip.colour = colour;
+            renderStrip(strip, text);
+            setBitmapForSprite(strip, scroll, bitmap, scrollPositionOffsets);
             return;
         }
 
@@ -202,6 +202,13 @@ void TTFToggleHinting()
     TTFToggleHinting(true);
 }
 
+// This cache keys on the whole string, not individual glyphs, so a hit skips
+// the entire layout-and-render pass — it already plays the role of a
+// shaped-run cache, with the width cache below covering measurement. Repeated
+// strings (window labels, the toolbar date) hit as long as they were drawn
+// within the last 64 draw ticks. A GL glyph atlas would not change what gets
+// rasterised, only how the result is uploaded, and the drawing engines treat
+// TTF output as ordinary 8bpp surfaces either way.
 TTFSurface* TTFSurfaceCacheGetOrAdd(TTF_Font* font, std::string_view text)
 {
     ttf_cache_entry* entry;
@@ -21,7 +21,16 @@ using namespace OpenRCT2::Drawing;
 class StaticLayout
 {
 private:
-    u8string Buffer;
+    // The wrapped text is kept in a thread-local scratch string so that
+    // laying out text every frame reuses one allocation instead of making a
+    // new string per call. Only one layout is ever live at a time.
+    static u8string& GetWrapBuffer()
+    {
+        thread_local u8string buffer;
+        return buffer;
+    }
+
+    u8string& Buffer;
     TextPaint Paint;
     int32_t LineCount = 0;
     int32_t LineHeight;
@@ -29,7 +38,8 @@ private:
 
 public:
     StaticLayout(u8string_view source, const TextPaint& paint, int32_t width)
-        : Paint(paint)
+        : Buffer(GetWrapBuffer())
+        , Paint(paint)
     {
         MaxWidth = GfxWrapString(source, width, paint.FontStyle, &Buffer, &LineCount);
         LineCount += 1;
@@ -153,9 +163,13 @@ int32_t DrawTextWrapped(RenderTarget& rt, const ScreenCoordsXY& coords, int32_t
 int32_t DrawTextWrapped(
     RenderTarget& rt, const ScreenCoordsXY& coords, int32_t width, StringId format, const Formatter& ft, TextPaint textPaint)
 {
-    const void* args = ft.Data();
+    // Wrapped text is where long strings occur (scenario descriptions,
+    // plugin text), so format into a growing scratch rather than a fixed
+    // buffer that would truncate them.
+    thread_local u8string buffer;
+    FormatStringIDLegacy(buffer, format, ft.Data());
 
-    StaticLayout layout(FormatStringIDLegacy(format, args), textPaint, width);
+    StaticLayout layout(buffer, textPaint, width);
 
     if (textPaint.Alignment == TextAlignment::centre)
     {
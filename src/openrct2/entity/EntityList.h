@@ -97,6 +97,126 @@ namespace OpenRCT2
         }
     };
 
+    template<typename T>
+    class EntityRadiusIterator
+    {
+    private:
+        CoordsXY _first{};
+        CoordsXY _last{};
+        CoordsXY _tile{};
+        std::vector<EntityId>::const_iterator iter{};
+        std::vector<EntityId>::const_iterator end{};
+        bool _exhausted = true;
+        T* Entity = nullptr;
+
+    public:
+        EntityRadiusIterator() = default;
+
+        EntityRadiusIterator(const CoordsXY& first, const CoordsXY& last)
+            : _first(first)
+            , _last(last)
+            , _tile(first)
+            , _exhausted(false)
+        {
+            const auto& vec = getGameState().entities.GetEntityTileList(_tile);
+            iter = std::begin(vec);
+            end = std::end(vec);
+            ++(*this);
+        }
+
+        EntityRadiusIterator& operator++()
+        {
+            Entity = nullptr;
+
+            // TODO: don't use global game state!
+            auto& gameState = getGameState();
+
+            while (!_exhausted && Entity == nullptr)
+            {
+                while (iter != end && Entity == nullptr)
+                {
+                    Entity = gameState.entities.TryGetEntity<T>(*iter++);
+                }
+
+                if (Entity == nullptr)
+                {
+                    // Advance to the next covered tile bucket.
+                    _tile.y += kCoordsXYStep;
+                    if (_tile.y > _last.y)
+                    {
+                        _tile.y = _first.y;
+                        _tile.x += kCoordsXYStep;
+                        if (_tile.x > _last.x)
+                        {
+                            _exhausted = true;
+                            break;
+                        }
+                    }
+                    const auto& vec = gameState.entities.GetEntityTileList(_tile);
+                    iter = std::begin(vec);
+                    end = std::end(vec);
+                }
+            }
+            return *this;
+        }
+
+        EntityRadiusIterator operator++(int)
+        {
+            EntityRadiusIterator retval = *this;
+            ++(*this);
+            return retval;
+        }
+        bool operator==(const EntityRadiusIterator& other) const
+        {
+            return Entity == other.Entity;
+        }
+        bool operator!=(const EntityRadiusIterator& other) const
+        {
+            return !(*this == other);
+        }
+        T* operator*()
+        {
+            return Entity;
+        }
+        // iterator traits
+        using difference_type = std::ptrdiff_t;
+        using value_type = T;
+        using pointer = const T*;
+        using reference = const T&;
+        using iterator_category = std::forward_iterator_tag;
+    };
+
+    /**
+     * Bulk spatial query: iterates all entities of the given type within the
+     * square box of the given radius (in coordinate units) around a location.
+     * The spatial index buckets are contiguous per-tile vectors, so this walks
+     * each covered bucket in order; the box is conservative and callers still
+     * need to apply any exact distance check they require.
+     */
+    template<typename T = EntityBase>
+    class EntityRadiusList
+    {
+    private:
+        CoordsXY _first;
+        CoordsXY _last;
+
+    public:
+        EntityRadiusList(const CoordsXY& loc, int32_t radius)
+            : _first(loc.x - radius, loc.y - radius)
+            , _last(loc.x + radius, loc.y + radius)
+        {
+        }
+
+        EntityRadiusIterator<T> begin() const
+        {
+            return EntityRadiusIterator<T>(_first, _last);
+        }
+        EntityRadiusIterator<T> end() const
+        {
+            return EntityRadiusIterator<T>();
+        }
+    };
+
     template<typename T>
     class EntityListIterator
     {
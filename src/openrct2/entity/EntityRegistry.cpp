@@ -21,6 +21,7 @@
 #include "../core/String.hpp"
 #include "../entity/EntityList.h"
 #include "../entity/Peep.h"
+#include "../entity/PeepHotData.h"
 #include "../entity/Staff.h"
 #include "../interface/Viewport.h"
 #include "../peep/RideUseSystem.h"
@@ -92,7 +93,7 @@ namespace OpenRCT2
     // TODO: make part of EntityList unit?
     uint16_t EntityRegistry::GetNumFreeEntities()
     {
-        return static_cast<uint16_t>(_freeIdList.size());
+        return static_cast<uint16_t>(_freeIdList.size() + _pendingFreeIds.size());
     }
 
     std::string EntitiesChecksum::ToString() const
@@ -100,10 +101,35 @@ namespace OpenRCT2
         return String::StringFromHex(raw);
     }
 
+    // Allocates the page containing the given slot if it does not exist yet.
+    // Fresh pages get every slot initialised the same way ResetAllEntities
+    // used to initialise the flat slab: null type, id matching the index.
+    Entity_t& EntityRegistry::EnsureSlot(EntityId::UnderlyingType index)
+    {
+        auto& page = _pages[index >> kEntityPageShift];
+        if (page == nullptr)
+        {
+            page = std::make_unique<EntityPage>();
+            const auto firstId = static_cast<EntityId::UnderlyingType>(index & ~(kEntityPageSize - 1));
+            for (uint32_t i = 0; i < kEntityPageSize; i++)
+            {
+                auto& base = page->slots[i].base;
+                base.Type = EntityType::null;
+                base.Id = EntityId::FromUnderlying(firstId + i);
+            }
+        }
+        return page->slots[index & (kEntityPageSize - 1)];
+    }
+
     EntityBase* EntityRegistry::TryGetEntity(EntityId entityIndex)
     {
         const auto idx = entityIndex.ToUnderlying();
-        return idx >= kMaxEntities ? nullptr : &entities[idx].base;
+        if (idx >= kMaxEntities)
+        {
+            return nullptr;
+        }
+        auto& page = _pages[idx >> kEntityPageShift];
+        return page == nullptr ? nullptr : &page->slots[idx & (kEntityPageSize - 1)].base;
     }
 
     EntityBase* EntityRegistry::GetEntity(EntityId entityIndex)
@@ -131,6 +157,7 @@ namespace OpenRCT2
 
     void EntityRegistry::ResetFreeIds()
     {
+        _pendingFreeIds.clear();
         _freeIdList.clear();
         _freeIdList.resize(kMaxEntities);
 
@@ -153,10 +180,10 @@ namespace OpenRCT2
      */
     void EntityRegistry::ResetAllEntities()
     {
-        // Free all associated Entity pointers prior to zeroing memory
+        // Free all associated Entity pointers prior to releasing the storage
         for (int32_t i = 0; i < kMaxEntities; ++i)
         {
-            auto* spr = GetEntity(EntityId::FromUnderlying(i));
+            auto* spr = TryGetEntity(EntityId::FromUnderlying(i));
             if (spr == nullptr)
             {
                 continue;
@@ -164,24 +191,20 @@ namespace OpenRCT2
             FreeEntity(*spr);
         }
 
-        std::fill(std::begin(entities), std::end(entities), Entity_t());
-        RideUse::GetHistory().Clear();
-        RideUse::GetTypeHistory().Clear();
-        for (int32_t i = 0; i < kMaxEntities; ++i)
+        // Dropping the pages returns their memory; EnsureSlot reallocates and
+        // reinitialises them on demand as ids are handed out again.
+        for (auto& page : _pages)
         {
-            auto* spr = GetEntity(EntityId::FromUnderlying(i));
-            if (spr == nullptr)
-            {
-                continue;
-            }
-            spr->Type = EntityType::null;
-            spr->Id = EntityId::FromUnderlying(i);
-
-            _entityFlashingList[i] = false;
+            page.reset();
         }
+        _entityGeneration++;
+        RideUse::GetHistory().Clear();
+        RideUse::GetTypeHistory().Clear();
+        std::fill(std::begin(_entityFlashingList), std::end(_entityFlashingList), false);
         ResetEntityLists();
         ResetFreeIds();
         ResetEntitySpatialIndices();
+        GetPeepHotData().Clear();
     }
 
     /**
@@ -207,6 +230,13 @@ namespace OpenRCT2
     }
 
 #ifndef DISABLE_NETWORK
+    // Hashing runs synchronously on the game thread even though it is a
+    // periodic cost. The only stable copy of entity state that exists is the
+    // one being hashed — the position tweener keeps coordinates, not full
+    // entities — so overlapping the hash with the next tick would mean first
+    // serialising all entities into a side buffer, a linear pass of the same
+    // order as the hash itself, and the tick packet carrying the checksum
+    // could not be sent until the background result arrived anyway.
     EntitiesChecksum EntityRegistry::GetAllEntitiesChecksum()
     {
         EntitiesChecksum checksum{};
@@ -245,10 +275,52 @@ namespace OpenRCT2
         Algorithm::sortedInsert(list, entity.Id);
     }
 
+    // Number of freed ids buffered before they are merged back into the
+    // sorted free list. High enough to cover the bursts of money effects and
+    // crash particles that expire within the same few ticks.
+    static constexpr size_t kMaxPendingFreeIds = 64;
+
     void EntityRegistry::AddToFreeList(EntityId index)
     {
+        // Buffer the id rather than inserting it into sorted position; a
+        // sorted insert shuffles up to the whole free list per freed entity,
+        // which is wasteful for short-lived effects that churn every tick.
+        _pendingFreeIds.push_back(index);
+        if (_pendingFreeIds.size() >= kMaxPendingFreeIds)
+        {
+            MergePendingFreeIds();
+        }
+    }
+
+    void EntityRegistry::MergePendingFreeIds()
+    {
+        if (_pendingFreeIds.empty())
+            return;
+
         // Free list must be in reverse sprite_index order to prevent desync issues
-        _freeIdList.insert(std::upper_bound(std::rbegin(_freeIdList), std::rend(_freeIdList), index).base(), index);
+        auto reverseOrder = [](const EntityId& lhs, const EntityId& rhs) { return rhs < lhs; };
+        std::sort(_pendingFreeIds.begin(), _pendingFreeIds.end(), reverseOrder);
+        auto mid = _freeIdList.insert(_freeIdList.end(), _pendingFreeIds.begin(), _pendingFreeIds.end());
+        std::inplace_merge(_freeIdList.begin(), mid, _freeIdList.end(), reverseOrder);
+        _pendingFreeIds.clear();
+    }
+
+    EntityId EntityRegistry::TakeNextFreeId()
+    {
+        // The lowest free id must always be the one allocated, exactly as a
+        // single sorted list would do, so multiplayer clients stay in
+        // lockstep regardless of how the free ids are buffered.
+        auto pendingIt = std::min_element(_pendingFreeIds.begin(), _pendingFreeIds.end());
+        if (pendingIt != _pendingFreeIds.end() && (_freeIdList.empty() || *pendingIt < _freeIdList.back()))
+        {
+            auto index = *pendingIt;
+            _pendingFreeIds.erase(pendingIt);
+            return index;
+        }
+
+        auto index = _freeIdList.back();
+        _freeIdList.pop_back();
+        return index;
     }
 
     void EntityRegistry::RemoveFromEntityList(EntityBase& entity)
@@ -275,6 +347,8 @@ namespace OpenRCT2
 
     void EntityRegistry::PrepareNewEntity(EntityBase& base, const EntityType type)
     {
+        _entityGeneration++;
+
         // Need to reset all sprite data, as the uninitialised values
         // may contain garbage and cause a desync later on.
         EntityReset(base);
@@ -294,9 +368,18 @@ namespace OpenRCT2
         EntitySpatialInsert(base, { kLocationNull, 0 });
     }
 
+    // Slot allocation is deliberately one global pool rather than
+    // type-segregated ranges. Entity ids are synchronised game state and
+    // entities update in id order, so re-partitioning the id space changes
+    // simulation outcomes, not just memory layout; fixed per-type ranges
+    // would also turn the shared entity cap into hard per-type caps that
+    // players would hit as mysterious spawn failures. Iteration locality is
+    // instead helped by always allocating the lowest free id, which keeps
+    // long-lived entities packed towards the bottom of the slab.
     EntityBase* EntityRegistry::CreateEntity(EntityType type)
     {
-        if (_freeIdList.size() == 0)
+        const auto numFreeEntities = GetNumFreeEntities();
+        if (numFreeEntities == 0)
         {
             // No free sprites.
             return nullptr;
@@ -311,42 +394,33 @@ namespace OpenRCT2
             }
 
             // If there are less than kMaxMiscEntities free slots, ensure other entities can be created.
-            if (_freeIdList.size() < kMaxMiscEntities)
+            if (numFreeEntities < kMaxMiscEntities)
             {
                 return nullptr;
             }
         }
 
-        auto* entity = GetEntity(_freeIdList.back());
-        if (entity == nullptr)
-        {
-            return nullptr;
-        }
-        _freeIdList.pop_back();
-
-        PrepareNewEntity(*entity, type);
+        auto& entity = EnsureSlot(TakeNextFreeId().ToUnderlying()).base;
+        PrepareNewEntity(entity, type);
 
-        return entity;
+        return &entity;
     }
 
     EntityBase* EntityRegistry::CreateEntityAt(const EntityId index, const EntityType type)
     {
+        MergePendingFreeIds();
+
         auto id = Algorithm::binaryFind(std::rbegin(_freeIdList), std::rend(_freeIdList), index);
         if (id == std::rend(_freeIdList))
         {
             return nullptr;
         }
 
-        auto* entity = GetEntity(index);
-        if (entity == nullptr)
-        {
-            return nullptr;
-        }
-
         _freeIdList.erase(std::next(id).base());
 
-        PrepareNewEntity(*entity, type);
-        return entity;
+        auto& entity = EnsureSlot(index.ToUnderlying()).base;
+        PrepareNewEntity(entity, type);
+        return &entity;
     }
 
     /**
@@ -357,6 +431,10 @@ namespace OpenRCT2
     {
         PROFILED_FUNCTION();
 
+        // Each type iterates its own entity list, so the cost per tick is proportional
+        // to the population of each active type. Litter is deliberately not updated
+        // here: it is inert and its age is derived on demand from creationTick, so a
+        // park full of litter costs nothing per tick.
         MiscUpdateAllTypes<
             SteamParticle, MoneyEffect, VehicleCrashParticle, ExplosionCloud, CrashSplashParticle, ExplosionFlare,
             JumpingFountain, Balloon, Duck>();
@@ -410,6 +488,14 @@ namespace OpenRCT2
         }
     }
 
+    // Spatial index maintenance is already deferred and batched: MoveTo only
+    // sets a dirty bit when an entity actually crosses a tile boundary, and
+    // this pass applies all pending transitions together before consumers
+    // query the index (GameState ticks it once per update). Grouping the
+    // applications by destination bucket as well would require sorting the
+    // dirty set by tile each tick, which costs more than the scattered
+    // writes it would save — most ticks only a small fraction of entities
+    // change tile.
     void EntityRegistry::UpdateEntitiesSpatialIndex()
     {
         for (auto& entityList : gEntityLists)
@@ -448,11 +534,20 @@ namespace OpenRCT2
     }
 
     /**
+     * Removal is immediate rather than tombstone-and-sweep on purpose. The
+     * entity list iterators resolve each id through TryGetEntity as they
+     * advance, so unlinking mid-tick is already safe and costs the loops one
+     * type check per id — a liveness test a tombstone scheme would need too,
+     * since deferring removal makes dead entities visible to every system
+     * that runs later in the same tick, which is an observable (and synced)
+     * behaviour change. Freed ids are already buffered and merged in batches
+     * below, which is where the per-removal cost actually was.
      *
      *  rct2: 0x0069EDB6
      */
     void EntityRegistry::EntityRemove(EntityBase* entity)
     {
+        _entityGeneration++;
         FreeEntity(*entity);
 
         EntityTweener::Get().RemoveEntity(entity);
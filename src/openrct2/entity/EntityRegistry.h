@@ -15,6 +15,7 @@
 
 #include <array>
 #include <list>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -23,6 +24,15 @@ namespace OpenRCT2
     constexpr uint16_t kMaxEntities = 65535;
     constexpr uint16_t kMaxMiscEntities = 3200;
 
+    // Entity slots are stored in fixed-size pages allocated the first time an
+    // id in their range is handed out, so small parks only commit the pages
+    // they actually touch instead of the full 32 MiB slab. The cap itself
+    // stays at 65535 because EntityId is 16 bits throughout the park save
+    // format, the network protocol and the plugin API.
+    constexpr uint32_t kEntityPageShift = 12;
+    constexpr uint32_t kEntityPageSize = 1u << kEntityPageShift;
+    constexpr uint32_t kEntityPageCount = (kMaxEntities + kEntityPageSize - 1) / kEntityPageSize;
+
     constexpr const uint32_t kSpatialIndexSize = (kMaximumMapSizeTechnical * kMaximumMapSizeTechnical) + 1;
     constexpr uint32_t kSpatialIndexNullBucket = kSpatialIndexSize - 1;
 
@@ -39,6 +49,11 @@ namespace OpenRCT2
         }
     };
 
+    struct EntityPage
+    {
+        Entity_t slots[kEntityPageSize]{};
+    };
+
 #pragma pack(push, 1)
     struct EntitiesChecksum
     {
@@ -54,11 +69,17 @@ namespace OpenRCT2
     class EntityRegistry
     {
     private:
-        Entity_t entities[kMaxEntities]{};
+        std::array<std::unique_ptr<EntityPage>, kEntityPageCount> _pages;
         std::array<std::list<EntityId>, EnumValue(EntityType::count)> gEntityLists;
         std::vector<EntityId> _freeIdList;
+        // Ids freed since the last merge into _freeIdList. Deferring the
+        // sorted insert makes freeing a push_back, so short-lived effect
+        // entities (money effects, particles) can churn without paying a
+        // vector shuffle per free; see AddToFreeList.
+        std::vector<EntityId> _pendingFreeIds;
 
         bool _entityFlashingList[kMaxEntities];
+        uint32_t _entityGeneration{};
 
         std::array<std::vector<EntityId>, kSpatialIndexSize> gEntitySpatialIndex;
 
@@ -66,6 +87,14 @@ namespace OpenRCT2
         uint16_t GetEntityListCount(EntityType type);
         uint16_t GetNumFreeEntities();
 
+        // Incremented whenever an entity is created or removed, so callers
+        // that memoise entity pointers (viewport hit testing) can discard
+        // them as soon as one may have been freed.
+        uint32_t GetEntityGeneration() const
+        {
+            return _entityGeneration;
+        }
+
         EntityBase* GetEntity(EntityId entityId);
 
         template<typename T>
@@ -183,6 +212,9 @@ namespace OpenRCT2
         void EntityReset(EntityBase& entity);
         void AddToEntityList(EntityBase& entity);
         void AddToFreeList(EntityId index);
+        void MergePendingFreeIds();
+        EntityId TakeNextFreeId();
+        Entity_t& EnsureSlot(EntityId::UnderlyingType index);
         void RemoveFromEntityList(EntityBase& entity);
         void PrepareNewEntity(EntityBase& base, EntityType type);
         void EntitySpatialInsert(EntityBase& entity, const CoordsXY& newLoc);
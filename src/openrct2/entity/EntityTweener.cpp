@@ -68,8 +68,11 @@ namespace OpenRCT2
             return;
         }
 
+        const auto pos = entity->GetLocation();
         Entities.push_back(entity);
-        PrePos.emplace_back(entity->GetLocation());
+        PreX.push_back(pos.x);
+        PreY.push_back(pos.y);
+        PreZ.push_back(pos.z);
     }
 
     void EntityTweener::PopulateEntities()
@@ -106,15 +109,11 @@ namespace OpenRCT2
     {
         for (auto* ent : Entities)
         {
-            if (ent == nullptr)
-            {
-                // Sprite was removed, add a dummy position to keep the index aligned.
-                PostPos.emplace_back(0, 0, 0);
-            }
-            else
-            {
-                PostPos.emplace_back(ent->GetLocation());
-            }
+            // For removed sprites add a dummy position to keep the index aligned.
+            const auto pos = ent != nullptr ? ent->GetLocation() : CoordsXYZ{ 0, 0, 0 };
+            PostX.push_back(pos.x);
+            PostY.push_back(pos.y);
+            PostZ.push_back(pos.z);
         }
     }
 
@@ -138,25 +137,37 @@ namespace OpenRCT2
             *it = nullptr;
     }
 
+    static void TweenComponent(
+        std::vector<int32_t>& dst, const std::vector<int32_t>& pre, const std::vector<int32_t>& post, float alpha,
+        float inv) noexcept
+    {
+        // Kept as a plain indexed loop over a single component so it vectorises.
+        const auto count = pre.size();
+        dst.resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            dst[i] = static_cast<int32_t>(std::round(post[i] * alpha + pre[i] * inv));
+        }
+    }
+
     void EntityTweener::Tween(float alpha)
     {
         const float inv = (1.0f - alpha);
+
+        TweenComponent(TweenedX, PreX, PostX, alpha, inv);
+        TweenComponent(TweenedY, PreY, PostY, alpha, inv);
+        TweenComponent(TweenedZ, PreZ, PostZ, alpha, inv);
+
         for (size_t i = 0; i < Entities.size(); ++i)
         {
             auto* ent = Entities[i];
             if (ent == nullptr)
                 continue;
 
-            auto& posA = PrePos[i];
-            auto& posB = PostPos[i];
-
-            if (posA == posB)
+            if (PreX[i] == PostX[i] && PreY[i] == PostY[i] && PreZ[i] == PostZ[i])
                 continue;
 
-            ent->MoveTo(
-                { static_cast<int32_t>(std::round(posB.x * alpha + posA.x * inv)),
-                  static_cast<int32_t>(std::round(posB.y * alpha + posA.y * inv)),
-                  static_cast<int32_t>(std::round(posB.z * alpha + posA.z * inv)) });
+            ent->MoveTo({ TweenedX[i], TweenedY[i], TweenedZ[i] });
         }
     }
 
@@ -165,18 +176,25 @@ namespace OpenRCT2
         for (size_t i = 0; i < Entities.size(); ++i)
         {
             auto* ent = Entities[i];
-            if (ent == nullptr || PrePos[i] == PostPos[i])
+            if (ent == nullptr)
+                continue;
+
+            if (PreX[i] == PostX[i] && PreY[i] == PostY[i] && PreZ[i] == PostZ[i])
                 continue;
 
-            ent->MoveTo(PostPos[i]);
+            ent->MoveTo({ PostX[i], PostY[i], PostZ[i] });
         }
     }
 
     void EntityTweener::Reset()
     {
         Entities.clear();
-        PrePos.clear();
-        PostPos.clear();
+        PreX.clear();
+        PreY.clear();
+        PreZ.clear();
+        PostX.clear();
+        PostY.clear();
+        PostZ.clear();
     }
 
     static EntityTweener tweener;
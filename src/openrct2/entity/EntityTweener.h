@@ -25,8 +25,19 @@ namespace OpenRCT2
     class EntityTweener
     {
         std::vector<EntityBase*> Entities;
-        std::vector<CoordsXYZ> PrePos;
-        std::vector<CoordsXYZ> PostPos;
+
+        // Positions are stored as packed parallel component arrays rather than
+        // CoordsXYZ so the interpolation in Tween is a flat loop over each
+        // component that the compiler can vectorise.
+        std::vector<int32_t> PreX;
+        std::vector<int32_t> PreY;
+        std::vector<int32_t> PreZ;
+        std::vector<int32_t> PostX;
+        std::vector<int32_t> PostY;
+        std::vector<int32_t> PostZ;
+        std::vector<int32_t> TweenedX;
+        std::vector<int32_t> TweenedY;
+        std::vector<int32_t> TweenedZ;
 
     private:
         void PopulateEntities();
@@ -77,6 +77,7 @@
 #include <cassert>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <sfl/static_vector.hpp>
 #include <span>
 
@@ -1884,7 +1885,48 @@ static void GuestPickRideToGoOn(Guest& guest)
     }
 }
 
-static OpenRCT2::BitSet<Limits::kMaxRidesInPark> GuestFindRidesToGoOn(Guest& guest)
+/**
+ * Guest-independent summary of a ride that guests may head towards. Only rides that are
+ * open, rated, not broken down and without a full queue are listed; every other ride is
+ * rejected for all guests alike, so the per-guest decision never needs to touch it.
+ */
+struct RideConsiderationEntry
+{
+    RideId id;
+    RideRating_t excitement;
+    bool alwaysConsidered; // Tall or very exciting; guests can see it from across the park.
+};
+
+// Rebuilt at most once per tick; ride status rarely changes within one.
+static std::vector<RideConsiderationEntry> _rideConsideration;
+static uint32_t _rideConsiderationTick = std::numeric_limits<uint32_t>::max();
+
+static const std::vector<RideConsiderationEntry>& GuestGetRideConsideration()
+{
+    const auto currentTicks = getGameState().currentTicks;
+    if (_rideConsiderationTick != currentTicks)
+    {
+        _rideConsideration.clear();
+        for (auto& ride : RideManager(getGameState()))
+        {
+            if (ride.status != RideStatus::open)
+                continue;
+            if (ride.lifecycleFlags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_QUEUE_FULL))
+                continue;
+            if (!RideHasRatings(ride))
+                continue;
+
+            const bool alwaysConsidered = ride.highestDropHeight > 66
+                || ride.ratings.excitement >= RideRating::make(8, 00);
+            _rideConsideration.push_back({ ride.id, ride.ratings.excitement, alwaysConsidered });
+        }
+        _rideConsiderationTick = currentTicks;
+    }
+    return _rideConsideration;
+}
+
+static OpenRCT2::BitSet<Limits::kMaxRidesInPark> GuestFindRidesToGoOn(
+    Guest& guest, const std::vector<RideConsiderationEntry>& candidates)
 {
     OpenRCT2::BitSet<Limits::kMaxRidesInPark> rideConsideration;
 
@@ -1894,12 +1936,12 @@ static OpenRCT2::BitSet<Limits::kMaxRidesInPark> GuestFindRidesToGoOn(Guest& gue
     if (guest.HasItem(ShopItem::map))
     {
         // Consider rides that peep hasn't been on yet
-        auto& gameState = getGameState();
-        for (auto& ride : RideManager(gameState))
+        for (const auto& candidate : candidates)
         {
-            if (!guest.HasRidden(ride))
+            auto* ride = GetRide(candidate.id);
+            if (ride != nullptr && !guest.HasRidden(*ride))
             {
-                rideConsideration[ride.id.ToUnderlying()] = true;
+                rideConsideration[candidate.id.ToUnderlying()] = true;
             }
         }
     }
@@ -1929,12 +1971,11 @@ static OpenRCT2::BitSet<Limits::kMaxRidesInPark> GuestFindRidesToGoOn(Guest& gue
         }
 
         // Always take the tall rides into consideration (realistic as you can usually see them from anywhere in the park)
-        auto& gameState = getGameState();
-        for (auto& ride : RideManager(gameState))
+        for (const auto& candidate : candidates)
         {
-            if (ride.highestDropHeight > 66 || ride.ratings.excitement >= RideRating::make(8, 00))
+            if (candidate.alwaysConsidered)
             {
-                rideConsideration[ride.id.ToUnderlying()] = true;
+                rideConsideration[candidate.id.ToUnderlying()] = true;
             }
         }
     }
@@ -1945,28 +1986,27 @@ static OpenRCT2::BitSet<Limits::kMaxRidesInPark> GuestFindRidesToGoOn(Guest& gue
 static Ride* GuestFindBestRideToGoOn(Guest& guest)
 {
     // Pick the most exciting ride
-    auto rideConsideration = GuestFindRidesToGoOn(guest);
-    Ride* mostExcitingRide = nullptr;
+    const auto& candidates = GuestGetRideConsideration();
+    auto rideConsideration = GuestFindRidesToGoOn(guest, candidates);
+    const RideConsiderationEntry* mostExciting = nullptr;
 
-    auto& gameState = getGameState();
-    for (auto& ride : RideManager(gameState))
+    for (const auto& candidate : candidates)
     {
-        const auto rideIndex = ride.id.ToUnderlying();
-        if (rideConsideration.size() > rideIndex && rideConsideration[rideIndex])
+        const auto rideIndex = candidate.id.ToUnderlying();
+        if (rideConsideration.size() <= rideIndex || !rideConsideration[rideIndex])
+            continue;
+
+        // The full decision cannot improve the result when the ride is no more exciting than the current best.
+        if (mostExciting != nullptr && candidate.excitement <= mostExciting->excitement)
+            continue;
+
+        auto* ride = GetRide(candidate.id);
+        if (ride != nullptr && guest.ShouldGoOnRide(*ride, StationIndex::FromUnderlying(0), false, true))
         {
-            if (!(ride.lifecycleFlags & RIDE_LIFECYCLE_QUEUE_FULL))
-            {
-                if (guest.ShouldGoOnRide(ride, StationIndex::FromUnderlying(0), false, true) && RideHasRatings(ride))
-                {
-                    if (mostExcitingRide == nullptr || ride.ratings.excitement > mostExcitingRide->ratings.excitement)
-                    {
-                        mostExcitingRide = &ride;
-                    }
-                }
-            }
+            mostExciting = &candidate;
         }
     }
-    return mostExcitingRide;
+    return mostExciting == nullptr ? nullptr : GetRide(mostExciting->id);
 }
 
 /**
@@ -7227,6 +7267,11 @@ static constexpr Drawing::Colour kTshirtColours[] = {
  *  rct2: 0x0069A05D
  */
 Guest* Guest::Generate(const CoordsXYZ& coords)
+{
+    return Generate(coords, findPeepAnimationsIndexForType(AnimationPeepType::guest));
+}
+
+Guest* Guest::Generate(const CoordsXYZ& coords, ObjectEntryIndex animationsObjectIndex)
 {
     auto& gameState = getGameState();
     if (gameState.entities.GetNumFreeEntities() < 400)
@@ -7234,7 +7279,7 @@ Guest* Guest::Generate(const CoordsXYZ& coords)
 
     Guest* peep = gameState.entities.CreateEntity<Guest>();
 
-    peep->AnimationObjectIndex = findPeepAnimationsIndexForType(AnimationPeepType::guest);
+    peep->AnimationObjectIndex = animationsObjectIndex;
     peep->AnimationGroup = PeepAnimationGroup::normal;
     peep->OutsideOfPark = true;
     peep->State = PeepState::falling;
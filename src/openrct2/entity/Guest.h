@@ -350,6 +350,9 @@ public:
     void InsertNewThought(PeepThoughtType thought_type, RideId rideId);
     void InsertNewThought(PeepThoughtType thought_type, uint16_t thought_arguments);
     static Guest* Generate(const CoordsXYZ& coords);
+    // Overload for batch admission where the caller has already resolved the
+    // guest animations object, so the lookup is not repeated per guest.
+    static Guest* Generate(const CoordsXYZ& coords, OpenRCT2::ObjectEntryIndex animationsObjectIndex);
     bool UpdateQueuePosition(PeepActionType previous_action);
     void RemoveFromQueue();
 
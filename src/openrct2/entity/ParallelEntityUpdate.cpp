@@ -0,0 +1,73 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ParallelEntityUpdate.h"
+
+#include "../config/Config.h"
+#include "../core/JobPool.h"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+namespace OpenRCT2
+{
+    // Lists smaller than this are cheaper to update in place than to dispatch.
+    constexpr size_t kMinEntitiesPerDispatch = 64;
+
+    static std::unique_ptr<JobPool> _entityUpdateJobs;
+
+    JobPool* GetEntityUpdateJobPool()
+    {
+        bool useMultithreading = Config::Get().general.multiThreading;
+        if (useMultithreading && _entityUpdateJobs == nullptr)
+        {
+            _entityUpdateJobs = std::make_unique<JobPool>();
+        }
+        else if (!useMultithreading && _entityUpdateJobs != nullptr)
+        {
+            _entityUpdateJobs.reset();
+        }
+        return _entityUpdateJobs.get();
+    }
+
+    void ParallelEntityUpdateDispose()
+    {
+        _entityUpdateJobs.reset();
+    }
+
+    void ParallelDispatchEntities(const std::vector<EntityBase*>& entities, const std::function<void(EntityBase*)>& updateFn)
+    {
+        auto* jobPool = GetEntityUpdateJobPool();
+        if (jobPool == nullptr || entities.size() < kMinEntitiesPerDispatch)
+        {
+            for (auto* entity : entities)
+            {
+                updateFn(entity);
+            }
+            return;
+        }
+
+        // Chunk boundaries depend only on the list length, not on worker timing,
+        // so the same entities are always grouped together.
+        const size_t numWorkers = std::max<size_t>(1, std::thread::hardware_concurrency());
+        const size_t chunkSize = std::max(kMinEntitiesPerDispatch, (entities.size() + numWorkers - 1) / numWorkers);
+        for (size_t offset = 0; offset < entities.size(); offset += chunkSize)
+        {
+            const size_t end = std::min(offset + chunkSize, entities.size());
+            jobPool->AddTask([&entities, &updateFn, offset, end]() {
+                for (size_t i = offset; i < end; i++)
+                {
+                    updateFn(entities[i]);
+                }
+            });
+        }
+        jobPool->Join();
+    }
+} // namespace OpenRCT2
@@ -0,0 +1,60 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "EntityList.h"
+
+#include <functional>
+#include <vector>
+
+class JobPool;
+
+namespace OpenRCT2
+{
+    /**
+     * Returns the shared worker pool used for parallel entity update stages, or
+     * nullptr when multi-threading is disabled in the config.
+     */
+    JobPool* GetEntityUpdateJobPool();
+
+    void ParallelEntityUpdateDispose();
+
+    /**
+     * Runs updateFn over the given entities, split into contiguous chunks across
+     * the entity update worker pool. Each task only ever touches its own slice of
+     * the list, so updateFn must not read or write state belonging to any other
+     * entity, create or remove entities, or touch shared mutable state. Under
+     * those constraints the result is identical to the serial loop regardless of
+     * worker scheduling, which keeps multiplayer checksums stable.
+     *
+     * Falls back to a serial loop when multi-threading is disabled or the list is
+     * too small to be worth dispatching.
+     */
+    void ParallelDispatchEntities(const std::vector<EntityBase*>& entities, const std::function<void(EntityBase*)>& updateFn);
+
+    /**
+     * Collects the entities of the given types into a stable pointer list, in
+     * entity list order, suitable for handing to ParallelDispatchEntities.
+     */
+    template<typename... TEntityTypes>
+    std::vector<EntityBase*> CollectEntities()
+    {
+        std::vector<EntityBase*> result;
+        (
+            [&result]() {
+                for (auto* entity : EntityList<TEntityTypes>())
+                {
+                    result.push_back(entity);
+                }
+            }(),
+            ...);
+        return result;
+    }
+} // namespace OpenRCT2
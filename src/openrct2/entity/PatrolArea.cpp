@@ -10,6 +10,7 @@
 #include "PatrolArea.h"
 
 #include "../core/Algorithm.hpp"
+#include "../core/BitSet.hpp"
 #include "EntityList.h"
 #include "Staff.h"
 
@@ -18,9 +19,19 @@
 using namespace OpenRCT2;
 using namespace OpenRCT2::Core;
 
-static PatrolArea _consolidatedPatrolArea[EnumValue(StaffType::count)];
+// The combined "any staff of this type patrols here" areas are kept as one
+// bit per tile so the lookups in the handyman assignment and surface paint
+// loops are a single word index instead of a per-cell binary search. Rebuilt
+// by UpdateConsolidatedPatrolAreas whenever a patrol area changes.
+using ConsolidatedPatrolArea = BitSet<kMaximumMapSizeTechnical * kMaximumMapSizeTechnical>;
+static ConsolidatedPatrolArea _consolidatedPatrolArea[EnumValue(StaffType::count)];
 static std::variant<StaffType, EntityId> _patrolAreaToRender;
 
+static size_t GetConsolidatedBitIndex(const TileCoordsXY& pos)
+{
+    return (static_cast<size_t>(pos.y) * kMaximumMapSizeTechnical) + pos.x;
+}
+
 static bool CompareTileCoordsXY(const TileCoordsXY& lhs, const TileCoordsXY& rhs)
 {
     if (lhs.y == rhs.y)
@@ -131,35 +142,35 @@ std::vector<TileCoordsXY> PatrolArea::ToVector() const
     return result;
 }
 
-const PatrolArea& GetMergedPatrolArea(const StaffType type)
-{
-    return _consolidatedPatrolArea[EnumValue(type)];
-}
-
 void UpdateConsolidatedPatrolAreas()
 {
-    for (int32_t staffType = 0; staffType < EnumValue(StaffType::count); ++staffType)
+    for (auto& bitmap : _consolidatedPatrolArea)
     {
-        // Reset all of the merged data for the type.
-        auto& mergedArea = _consolidatedPatrolArea[staffType];
-        mergedArea.Clear();
+        bitmap.reset();
+    }
 
-        for (auto staff : EntityList<Staff>())
-        {
-            if (EnumValue(staff->AssignedStaffType) != staffType)
-                continue;
+    for (auto staff : EntityList<Staff>())
+    {
+        if (EnumValue(staff->AssignedStaffType) >= EnumValue(StaffType::count))
+            continue;
 
-            if (staff->PatrolInfo == nullptr)
-                continue;
+        if (staff->PatrolInfo == nullptr)
+            continue;
 
-            mergedArea.Union(*staff->PatrolInfo);
+        auto& bitmap = _consolidatedPatrolArea[EnumValue(staff->AssignedStaffType)];
+        for (const auto& pos : staff->PatrolInfo->ToVector())
+        {
+            bitmap.set(GetConsolidatedBitIndex(pos), true);
         }
     }
 }
 
 bool IsPatrolAreaSetForStaffType(StaffType type, const CoordsXY& coords)
 {
-    return _consolidatedPatrolArea[EnumValue(type)].Get(coords);
+    const auto pos = TileCoordsXY(coords);
+    if (pos.x < 0 || pos.x >= kMaximumMapSizeTechnical || pos.y < 0 || pos.y >= kMaximumMapSizeTechnical)
+        return false;
+    return _consolidatedPatrolArea[EnumValue(type)].get(GetConsolidatedBitIndex(pos));
 }
 
 std::variant<StaffType, EntityId> GetPatrolAreaToRender()
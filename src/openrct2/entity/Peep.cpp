@@ -31,6 +31,8 @@
 #include "../entity/EntityList.h"
 #include "../entity/EntityRegistry.h"
 #include "../entity/EntityTweener.h"
+#include "../entity/ParallelEntityUpdate.h"
+#include "../entity/PeepHotData.h"
 #include "../interface/Viewport.h"
 #include "../interface/WindowBase.h"
 #include "../localisation/Formatter.h"
@@ -213,6 +215,11 @@ void PeepUpdateAll()
 
     uint32_t index = 0;
 
+    // Refresh the packed hot-field copies while each peep's cache lines are
+    // already loaded for the update itself.
+    auto& hotData = GetPeepHotData();
+    hotData.BeginRefresh();
+
     for (auto peep : EntityList<Guest>())
     {
         if ((index & kTicks128Mask) == currentTicksMasked)
@@ -221,6 +228,10 @@ void PeepUpdateAll()
         }
 
         peep->Update();
+        if (peep->Type == EntityType::guest)
+        {
+            hotData.Append(*peep);
+        }
 
         index++;
     }
@@ -233,6 +244,10 @@ void PeepUpdateAll()
         }
 
         staff->Update();
+        if (staff->Type == EntityType::staff)
+        {
+            hotData.Append(*staff);
+        }
 
         index++;
     }
@@ -240,15 +255,12 @@ void PeepUpdateAll()
 
 void PeepUpdateAllBoundingBoxes()
 {
-    for (auto* peep : EntityList<Guest>())
-    {
-        peep->UpdateSpriteBoundingBox();
-    }
+    PROFILED_FUNCTION();
 
-    for (auto* peep : EntityList<Staff>())
-    {
-        peep->UpdateSpriteBoundingBox();
-    }
+    // Bounding box recalculation only reads loaded animation objects and writes
+    // the peep's own sprite data, so the peeps can be processed in parallel.
+    auto peeps = CollectEntities<Guest, Staff>();
+    ParallelDispatchEntities(peeps, [](EntityBase* entity) { static_cast<Peep*>(entity)->UpdateSpriteBoundingBox(); });
 }
 
 void Peep::UpdateWaitingAtCrossing()
@@ -308,6 +320,15 @@ bool Peep::CheckForPath()
         return true;
     }
 
+    // If no elements have been inserted, removed or relocated since the last
+    // successful check of this tile, the path cannot have gone missing. This
+    // lets stationary peeps (long queues in particular) skip the tile walk.
+    const auto mapGeneration = MapGetTileElementGeneration();
+    if (PathCheckedGeneration == mapGeneration && PathCheckedLoc == NextLoc)
+    {
+        return true;
+    }
+
     TileElement* tile_element = MapGetFirstElementAt(NextLoc);
 
     auto mapType = TileElementType::Path;
@@ -325,6 +346,8 @@ bool Peep::CheckForPath()
             if (NextLoc.z == tile_element->GetBaseZ())
             {
                 // Found a suitable path or surface
+                PathCheckedGeneration = mapGeneration;
+                PathCheckedLoc = NextLoc;
                 return true;
             }
         }
@@ -961,26 +984,22 @@ uint32_t Peep::GetStepsToTake() const
  *
  *  rct2: 0x0069BF41
  */
-void PeepProblemWarningsUpdate()
+static PeepThoughtSurvey _thoughtSurvey;
+static uint32_t _thoughtSurveyTick = std::numeric_limits<uint32_t>::max();
+
+static void PeepThoughtSurveyRefresh()
 {
-    auto& gameState = getGameState();
+    _thoughtSurvey = {};
 
     Ride* ride;
-    uint32_t hungerCounter = 0, lostCounter = 0, noexitCounter = 0, thirstCounter = 0, litterCounter = 0, disgustCounter = 0,
-             toiletCounter = 0, vandalismCounter = 0;
-    uint8_t* warningThrottle = gameState.park.peepWarningThrottle;
-
-    int32_t inQueueCounter = 0;
-    int32_t tooLongQueueCounter = 0;
-    std::map<RideId, int32_t> queueComplainingGuestsMap;
-
     for (auto peep : EntityList<Guest>())
     {
         if (peep->OutsideOfPark)
             continue;
 
+        _thoughtSurvey.guestsInPark++;
         if (peep->State == PeepState::queuing || peep->State == PeepState::queuingFront)
-            inQueueCounter++;
+            _thoughtSurvey.inQueue++;
 
         if (peep->Thoughts[0].freshness > 5)
             continue;
@@ -988,62 +1007,103 @@ void PeepProblemWarningsUpdate()
         switch (peep->Thoughts[0].type)
         {
             case PeepThoughtType::Lost: // 0x10
-                lostCounter++;
+                _thoughtSurvey.lost++;
                 break;
 
             case PeepThoughtType::Hungry: // 0x14
+                _thoughtSurvey.hungry++;
                 if (peep->GuestHeadingToRideId.IsNull())
                 {
-                    hungerCounter++;
+                    _thoughtSurvey.hungryUnserved++;
                     break;
                 }
                 ride = GetRide(peep->GuestHeadingToRideId);
                 if (ride != nullptr && !ride->getRideTypeDescriptor().HasFlag(RtdFlag::sellsFood))
-                    hungerCounter++;
+                    _thoughtSurvey.hungryUnserved++;
                 break;
 
             case PeepThoughtType::Thirsty:
                 if (peep->GuestHeadingToRideId.IsNull())
                 {
-                    thirstCounter++;
+                    _thoughtSurvey.thirstyUnserved++;
                     break;
                 }
                 ride = GetRide(peep->GuestHeadingToRideId);
                 if (ride != nullptr && !ride->getRideTypeDescriptor().HasFlag(RtdFlag::sellsDrinks))
-                    thirstCounter++;
+                    _thoughtSurvey.thirstyUnserved++;
                 break;
 
             case PeepThoughtType::Toilet:
+                _thoughtSurvey.toilet++;
                 if (peep->GuestHeadingToRideId.IsNull())
                 {
-                    toiletCounter++;
+                    _thoughtSurvey.toiletUnserved++;
                     break;
                 }
                 ride = GetRide(peep->GuestHeadingToRideId);
                 if (ride != nullptr && ride->getRideTypeDescriptor().specialType != RtdSpecialType::toilet)
-                    toiletCounter++;
+                    _thoughtSurvey.toiletUnserved++;
                 break;
 
             case PeepThoughtType::BadLitter: // 0x1a
-                litterCounter++;
+                _thoughtSurvey.badLitter++;
                 break;
             case PeepThoughtType::CantFindExit: // 0x1b
-                noexitCounter++;
+                _thoughtSurvey.cantFindExit++;
                 break;
             case PeepThoughtType::PathDisgusting: // 0x1f
-                disgustCounter++;
+                _thoughtSurvey.pathDisgusting++;
                 break;
             case PeepThoughtType::Vandalism: // 0x21
-                vandalismCounter++;
+                _thoughtSurvey.vandalism++;
                 break;
             case PeepThoughtType::QueuingAges:
-                tooLongQueueCounter++;
-                queueComplainingGuestsMap[peep->Thoughts[0].rideId]++;
+                _thoughtSurvey.tooLongQueue++;
+                _thoughtSurvey.queueComplainingGuests[peep->Thoughts[0].rideId]++;
+                break;
+            case PeepThoughtType::VeryClean:
+                _thoughtSurvey.veryClean++;
+                break;
+            case PeepThoughtType::Scenery:
+                _thoughtSurvey.scenery++;
+                break;
+            case PeepThoughtType::CantFind:
+                _thoughtSurvey.cantFind++;
                 break;
             default:
                 break;
         }
     }
+}
+
+const PeepThoughtSurvey& PeepGetThoughtSurvey()
+{
+    const auto currentTicks = getGameState().currentTicks;
+    if (_thoughtSurveyTick != currentTicks)
+    {
+        PeepThoughtSurveyRefresh();
+        _thoughtSurveyTick = currentTicks;
+    }
+    return _thoughtSurvey;
+}
+
+void PeepProblemWarningsUpdate()
+{
+    auto& gameState = getGameState();
+
+    uint8_t* warningThrottle = gameState.park.peepWarningThrottle;
+
+    // Always recount here so a survey memoised for a previous park cannot be reused after a load.
+    PeepThoughtSurveyRefresh();
+    _thoughtSurveyTick = gameState.currentTicks;
+
+    const uint32_t hungerCounter = _thoughtSurvey.hungryUnserved, lostCounter = _thoughtSurvey.lost,
+                   noexitCounter = _thoughtSurvey.cantFindExit, thirstCounter = _thoughtSurvey.thirstyUnserved,
+                   litterCounter = _thoughtSurvey.badLitter, disgustCounter = _thoughtSurvey.pathDisgusting,
+                   toiletCounter = _thoughtSurvey.toiletUnserved, vandalismCounter = _thoughtSurvey.vandalism;
+    const auto inQueueCounter = static_cast<int32_t>(_thoughtSurvey.inQueue);
+    const auto tooLongQueueCounter = static_cast<int32_t>(_thoughtSurvey.tooLongQueue);
+    const auto& queueComplainingGuestsMap = _thoughtSurvey.queueComplainingGuests;
 
     // could maybe be packed into a loop, would lose a lot of clarity though
     if (warningThrottle[0])
@@ -1189,20 +1249,22 @@ void PeepUpdateCrowdNoise()
     // Count the number of peeps visible
     auto visiblePeeps = 0;
 
-    for (auto peep : EntityList<Guest>())
+    // Stream the packed hot-field entries rather than chasing the full peep
+    // objects through the entity pool.
+    for (const auto& entry : GetPeepHotData().GuestEntries())
     {
-        if (peep->x == kLocationNull)
+        if (entry.Loc.x == kLocationNull)
             continue;
-        if (viewport->viewPos.x > peep->SpriteData.SpriteRect.GetRight())
+        if (viewport->viewPos.x > entry.SpriteRect.GetRight())
             continue;
-        if (viewport->viewPos.x + viewport->ViewWidth() < peep->SpriteData.SpriteRect.GetLeft())
+        if (viewport->viewPos.x + viewport->ViewWidth() < entry.SpriteRect.GetLeft())
             continue;
-        if (viewport->viewPos.y > peep->SpriteData.SpriteRect.GetBottom())
+        if (viewport->viewPos.y > entry.SpriteRect.GetBottom())
             continue;
-        if (viewport->viewPos.y + viewport->ViewHeight() < peep->SpriteData.SpriteRect.GetTop())
+        if (viewport->viewPos.y + viewport->ViewHeight() < entry.SpriteRect.GetTop())
             continue;
 
-        visiblePeeps += peep->State == PeepState::queuing ? 1 : 2;
+        visiblePeeps += entry.State == PeepState::queuing ? 1 : 2;
     }
 
     // This function doesn't account for the fact that the screen might be so big that 100 peeps could potentially be very
@@ -1627,6 +1689,13 @@ static void PeepReturnToCentreOfTile(Peep* peep)
  *
  *  rct2: 0x00693f2C
  */
+// Admission is handled here per guest as each one physically reaches the
+// entrance tile during its own movement step, and the order guests pass the
+// gate is part of synced state (spending and thoughts draw on ScenarioRand).
+// Batch-admitting a surge in one pass would decouple admission from the
+// walking simulation that delivers guests to the gate; the park state read
+// per guest is a handful of fields (fee, flags) that is not worth staging
+// into a precomputed per-entrance snapshot.
 static bool PeepInteractWithEntrance(Peep* peep, const CoordsXYE& coords, uint8_t& pathing_result)
 {
     auto tile_element = coords.element;
@@ -1985,6 +2054,14 @@ static void PeepFootpathMoveForward(Peep* peep, const CoordsXYE& coords, bool va
     constexpr uint8_t kThresholdLitterCount = 3;
     constexpr uint8_t kThresholdVomitCount = 3;
 
+    // This scan is intentionally not replaced by a per-tile density counter
+    // maintained on entity moves. The check filters on walking state, z
+    // proximity and litter subtype, so a plain count per tile would not
+    // answer it — keeping it accurate would mean several counters updated on
+    // every state and height change of every peep, all synced state. The
+    // capped scan below reads at most kMaxIterations entities on one tile at
+    // this guest's slow think cadence, which is cheaper than that upkeep.
+
     // Don't allow this loop to become too expensive, lets just have enough to potentially satisfy
     // all the conditions.
     constexpr uint32_t kMaxIterations = kThresholdCrowdCount + kThresholdLitterCount + kThresholdVomitCount;
@@ -17,6 +17,7 @@
 #include "../world/Location.hpp"
 
 #include <array>
+#include <map>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -377,6 +378,10 @@ struct Peep : EntityBase
     RideId InteractionRideIndex;
     uint32_t PeepId;
     uint8_t PathCheckOptimisation; // see peep.checkForPath
+    // Map generation and tile last verified by CheckForPath. Stationary peeps
+    // (long queues) skip the tile walk while the map is unchanged. Not saved.
+    uint32_t PathCheckedGeneration;
+    CoordsXYZ PathCheckedLoc;
     TileCoordsXYZD PathfindGoal;
     std::array<TileCoordsXYZD, 4> PathfindHistory;
     uint8_t WalkingAnimationFrameNum;
@@ -450,7 +455,34 @@ enum
     PATHING_RIDE_ENTRANCE = 1 << 3,
 };
 
+/**
+ * Per-criterion counts of fresh front-of-queue guest thoughts, gathered in a single
+ * pass over all guests in the park. Shared by the problem warning and award checks so
+ * they do not each rescan the guest list on the same tick.
+ */
+struct PeepThoughtSurvey
+{
+    uint32_t guestsInPark{};
+    uint32_t inQueue{};
+    uint32_t lost{};
+    uint32_t hungry{};
+    uint32_t hungryUnserved{};
+    uint32_t thirstyUnserved{};
+    uint32_t toilet{};
+    uint32_t toiletUnserved{};
+    uint32_t badLitter{};
+    uint32_t cantFindExit{};
+    uint32_t pathDisgusting{};
+    uint32_t vandalism{};
+    uint32_t veryClean{};
+    uint32_t scenery{};
+    uint32_t cantFind{};
+    uint32_t tooLongQueue{};
+    std::map<RideId, int32_t> queueComplainingGuests;
+};
+
 int32_t PeepGetStaffCount();
+const PeepThoughtSurvey& PeepGetThoughtSurvey();
 void PeepUpdateAll();
 void PeepUpdateAllBoundingBoxes();
 void PeepProblemWarningsUpdate();
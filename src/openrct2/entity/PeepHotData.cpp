@@ -0,0 +1,61 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "PeepHotData.h"
+
+#include "Guest.h"
+#include "Staff.h"
+
+namespace OpenRCT2
+{
+    static PeepHotDataStore _peepHotData;
+
+    PeepHotDataStore& GetPeepHotData()
+    {
+        return _peepHotData;
+    }
+
+    static PeepHotEntry MakeEntry(const Peep& peep)
+    {
+        PeepHotEntry entry{};
+        entry.Id = peep.Id;
+        entry.Loc = { peep.x, peep.y, peep.z };
+        entry.SpriteRect = peep.SpriteData.SpriteRect;
+        entry.State = peep.State;
+        entry.Energy = peep.Energy;
+        entry.NextFlags = peep.NextFlags;
+        return entry;
+    }
+
+    void PeepHotDataStore::BeginRefresh()
+    {
+        _guests.clear();
+        _staff.clear();
+    }
+
+    void PeepHotDataStore::Append(const Guest& guest)
+    {
+        auto entry = MakeEntry(guest);
+        entry.Happiness = guest.Happiness;
+        _guests.push_back(entry);
+    }
+
+    void PeepHotDataStore::Append(const Staff& staff)
+    {
+        _staff.push_back(MakeEntry(staff));
+    }
+
+    void PeepHotDataStore::Clear()
+    {
+        _guests.clear();
+        _guests.shrink_to_fit();
+        _staff.clear();
+        _staff.shrink_to_fit();
+    }
+} // namespace OpenRCT2
@@ -0,0 +1,66 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../Identifiers.h"
+#include "../world/Location.hpp"
+
+#include <cstdint>
+#include <vector>
+
+enum class PeepState : uint8_t;
+struct Guest;
+struct Staff;
+
+namespace OpenRCT2
+{
+    /**
+     * Packed copy of the handful of Peep fields that bulk loops read every tick.
+     * A peep occupies a 512 byte slot in the entity pool, so loops that only
+     * need position or state miss the cache on every iteration. The entries are
+     * refreshed from PeepUpdateAll while each peep's cache lines are already
+     * hot, letting consumers stream a contiguous array instead.
+     */
+    struct PeepHotEntry
+    {
+        EntityId Id;
+        CoordsXYZ Loc;
+        ScreenRect SpriteRect;
+        PeepState State;
+        uint8_t Energy;
+        uint8_t Happiness;
+        uint8_t NextFlags;
+    };
+
+    class PeepHotDataStore
+    {
+    private:
+        std::vector<PeepHotEntry> _guests;
+        std::vector<PeepHotEntry> _staff;
+
+    public:
+        void BeginRefresh();
+        void Append(const Guest& guest);
+        void Append(const Staff& staff);
+        void Clear();
+
+        const std::vector<PeepHotEntry>& GuestEntries() const
+        {
+            return _guests;
+        }
+
+        const std::vector<PeepHotEntry>& StaffEntries() const
+        {
+            return _staff;
+        }
+    };
+
+    PeepHotDataStore& GetPeepHotData();
+} // namespace OpenRCT2
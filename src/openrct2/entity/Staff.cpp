@@ -318,21 +318,15 @@ Direction Staff::HandymanDirectionToNearestLitter() const
     auto nearestLitterDist = std::numeric_limits<int32_t>::max();
     Litter* nearestLitter = nullptr;
 
-    for (int32_t tileX = x - kLookupRadius; tileX <= x + kLookupRadius; tileX += kCoordsXYStep)
+    for (auto* litter : EntityRadiusList<Litter>({ x, y }, kLookupRadius))
     {
-        for (int32_t tileY = y - kLookupRadius; tileY <= y + kLookupRadius; tileY += kCoordsXYStep)
-        {
-            for (auto* litter : EntityTileList<Litter>({ tileX, tileY }))
-            {
-                // Calculate Manhattan distance with z-weighting
-                uint16_t distance = std::abs(litter->x - x) + std::abs(litter->y - y) + std::abs(litter->z - z) * 4;
+        // Calculate Manhattan distance with z-weighting
+        uint16_t distance = std::abs(litter->x - x) + std::abs(litter->y - y) + std::abs(litter->z - z) * 4;
 
-                if (distance < nearestLitterDist)
-                {
-                    nearestLitterDist = distance;
-                    nearestLitter = litter;
-                }
-            }
+        if (distance < nearestLitterDist)
+        {
+            nearestLitterDist = distance;
+            nearestLitter = litter;
         }
     }
 
@@ -866,42 +860,36 @@ bool Staff::IsMechanicHeadingToFixRideBlockingPath()
  */
 void Staff::EntertainerUpdateNearbyPeeps() const
 {
-    // Iterate over tiles within a 3-tile radius (96 units)
+    // Affect guests within a 3-tile radius (96 units)
     constexpr auto kTileRadius = 3;
     constexpr auto kLookupRadius = kCoordsXYStep * kTileRadius;
 
-    for (int32_t tileX = x - kLookupRadius; tileX <= x + kLookupRadius; tileX += kCoordsXYStep)
+    for (auto* guest : EntityRadiusList<Guest>({ x, y }, kLookupRadius))
     {
-        for (int32_t tileY = y - kLookupRadius; tileY <= y + kLookupRadius; tileY += kCoordsXYStep)
-        {
-            for (auto* guest : EntityTileList<Guest>({ tileX, tileY }))
-            {
-                if (guest->x == kLocationNull)
-                    continue;
+        if (guest->x == kLocationNull)
+            continue;
 
-                int16_t z_dist = std::abs(z - guest->z);
-                if (z_dist > kTileRadius / 2)
-                    continue;
+        int16_t z_dist = std::abs(z - guest->z);
+        if (z_dist > kTileRadius / 2)
+            continue;
 
-                int16_t x_dist = std::abs(x - guest->x);
-                int16_t y_dist = std::abs(y - guest->y);
+        int16_t x_dist = std::abs(x - guest->x);
+        int16_t y_dist = std::abs(y - guest->y);
 
-                if (x_dist > kLookupRadius)
-                    continue;
+        if (x_dist > kLookupRadius)
+            continue;
 
-                if (y_dist > kLookupRadius)
-                    continue;
+        if (y_dist > kLookupRadius)
+            continue;
 
-                if (guest->State == PeepState::walking)
-                {
-                    guest->HappinessTarget = std::min(guest->HappinessTarget + 4, kPeepMaxHappiness);
-                }
-                else if (guest->State == PeepState::queuing)
-                {
-                    guest->TimeInQueue = std::max(0, guest->TimeInQueue - 200);
-                    guest->HappinessTarget = std::min(guest->HappinessTarget + 3, kPeepMaxHappiness);
-                }
-            }
+        if (guest->State == PeepState::walking)
+        {
+            guest->HappinessTarget = std::min(guest->HappinessTarget + 4, kPeepMaxHappiness);
+        }
+        else if (guest->State == PeepState::queuing)
+        {
+            guest->TimeInQueue = std::max(0, guest->TimeInQueue - 200);
+            guest->HappinessTarget = std::min(guest->HappinessTarget + 3, kPeepMaxHappiness);
         }
     }
 }
@@ -1637,42 +1625,36 @@ bool Staff::UpdatePatrollingFindSweeping()
 
 bool Staff::SecurityGuardPathIsCrowded() const
 {
-    // Iterate over tiles within a 3-tile radius (96 units)
+    // Count guests within a 3-tile radius (96 units)
     constexpr auto kTileRadius = 3;
     constexpr auto kLookupRadius = kCoordsXYStep * kTileRadius;
     constexpr auto kSecurityPathCrowdedThreshold = 20;
 
     int16_t guestCount = 0;
 
-    for (int32_t tileX = x - kLookupRadius; tileX <= x + kLookupRadius; tileX += kCoordsXYStep)
+    for (auto* guest : EntityRadiusList<Guest>({ x, y }, kLookupRadius))
     {
-        for (int32_t tileY = y - kLookupRadius; tileY <= y + kLookupRadius; tileY += kCoordsXYStep)
-        {
-            for (auto* guest : EntityTileList<Guest>({ tileX, tileY }))
-            {
-                if (guest->x == kLocationNull)
-                    continue;
+        if (guest->x == kLocationNull)
+            continue;
 
-                int16_t zDist = std::abs(z - guest->z);
-                if (zDist > kTileRadius / 2)
-                    continue;
+        int16_t zDist = std::abs(z - guest->z);
+        if (zDist > kTileRadius / 2)
+            continue;
 
-                int16_t xDist = std::abs(x - guest->x);
-                if (xDist > kLookupRadius)
-                    continue;
+        int16_t xDist = std::abs(x - guest->x);
+        if (xDist > kLookupRadius)
+            continue;
 
-                int16_t yDist = std::abs(y - guest->y);
-                if (yDist > kLookupRadius)
-                    continue;
+        int16_t yDist = std::abs(y - guest->y);
+        if (yDist > kLookupRadius)
+            continue;
 
-                if (!guest->IsActionWalking())
-                    continue;
+        if (!guest->IsActionWalking())
+            continue;
 
-                guestCount++;
-                if (guestCount >= kSecurityPathCrowdedThreshold)
-                    return true;
-            }
-        }
+        guestCount++;
+        if (guestCount >= kSecurityPathCrowdedThreshold)
+            return true;
     }
 
     return false;
@@ -1721,6 +1703,15 @@ bool Staff::isEntertainer() const
     return AssignedStaffType == StaffType::entertainer;
 }
 
+// Staff updates are already tiered the way a decision scheduler would tier
+// them. The unconditional per-tick work below is only the step-progress
+// accumulator; the state machine runs when that overflows (when the member
+// actually takes a step), and the expensive decisions inside it — patrol
+// direction, litter and vandalism scans, task selection — additionally wait
+// for PerformNextAction to report the destination reached, i.e. a tile
+// boundary. A due-tick wheel could not skip the remaining per-tick part:
+// mid-walk staff still need their movement and sprite advanced every tick,
+// and the wheel's wake-up bookkeeping would be synced state for no saving.
 void Staff::Update()
 {
     if (PeepFlags & PEEP_FLAGS_POSITION_FROZEN)
@@ -170,5 +170,3 @@ OpenRCT2::Drawing::Colour StaffGetColour(StaffType staffType);
 OpenRCT2::GameActions::Result StaffSetColour(StaffType staffType, OpenRCT2::Drawing::Colour value);
 
 money64 GetStaffWage(StaffType type);
-
-const PatrolArea& GetMergedPatrolArea(StaffType type);
@@ -13,6 +13,7 @@
 #include "../config/Config.h"
 #include "../core/EnumUtils.hpp"
 #include "../core/String.hpp"
+#include "../drawing/Drawing.h"
 #include "../drawing/TTF.h"
 #include "../localisation/Language.h"
 #include "../localisation/LocalisationService.h"
@@ -171,6 +172,8 @@ static bool LoadCustomConfigFont(LocalisationService& localisationService)
 
 void TryLoadFonts(LocalisationService& localisationService)
 {
+    // Any font change invalidates previously measured string widths.
+    GfxResetStringWidthCache();
 #ifndef DISABLE_TTF
     auto currentLanguage = localisationService.GetCurrentLanguage();
     TTFontFamily const* fontFamily = LanguagesDescriptors[currentLanguage].font_family;
@@ -59,6 +59,7 @@
 #include "../ride/RideData.h"
 #include "../ride/RideManager.hpp"
 #include "../ride/Vehicle.h"
+#include "../scenario/Scenario.h"
 #include "../ui/WindowManager.h"
 #include "../util/Util.h"
 #include "../windows/Intent.h"
@@ -81,6 +82,10 @@
     #include "../drawing/TTF.h"
 #endif
 
+#ifdef ENABLE_SCRIPTING
+    #include "../scripting/ScriptEngine.h"
+#endif
+
 using namespace OpenRCT2;
 
 using arguments_t = std::vector<std::string>;
@@ -680,6 +685,14 @@ static void ConsoleCommandGet(InteractiveConsole& console, const arguments_t& ar
         {
             console.WriteFormatLine("console_small_font %d", Config::Get().interface.consoleSmallFont);
         }
+        else if (argv[0] == "autosave")
+        {
+            console.WriteFormatLine("autosave %d", Config::Get().general.autosaveFrequency);
+        }
+        else if (argv[0] == "autosave_amount")
+        {
+            console.WriteFormatLine("autosave_amount %d", Config::Get().general.autosaveAmount);
+        }
         else if (argv[0] == "location")
         {
             WindowBase* w = WindowGetMain();
@@ -921,8 +934,27 @@ static void ConsoleCommandSet(InteractiveConsole& console, const arguments_t& ar
         {
             Config::Get().interface.consoleSmallFont = (int_val[0] != 0);
             Config::Save();
+            Config::NotifyChange("interface.console_small_font");
             console.Execute("get console_small_font");
         }
+        else if (varName == "autosave" && InvalidArguments(&invalidArgs, int_valid[0]))
+        {
+            Config::Get().general.autosaveFrequency = std::clamp<int32_t>(int_val[0], AUTOSAVE_EVERY_MINUTE, AUTOSAVE_NEVER);
+            Config::Save();
+            Config::NotifyChange("general.autosave");
+            console.Execute("get autosave");
+            // Does not affect rendering, so skip the blanket screen invalidation below.
+            return;
+        }
+        else if (varName == "autosave_amount" && InvalidArguments(&invalidArgs, int_valid[0]))
+        {
+            Config::Get().general.autosaveAmount = std::max(1, int_val[0]);
+            Config::Save();
+            Config::NotifyChange("general.autosave_amount");
+            console.Execute("get autosave_amount");
+            // Does not affect rendering, so skip the blanket screen invalidation below.
+            return;
+        }
         else if (varName == "location" && InvalidArguments(&invalidArgs, int_valid[0] && int_valid[1]))
         {
             WindowBase* w = WindowGetMain();
@@ -939,6 +971,7 @@ static void ConsoleCommandSet(InteractiveConsole& console, const arguments_t& ar
             float newScale = static_cast<float>(0.001 * std::trunc(1000 * double_val[0]));
             Config::Get().general.windowScale = std::clamp(newScale, 0.5f, 5.0f);
             Config::Save();
+            Config::NotifyChange("general.window_scale");
             GfxInvalidateScreen();
             ContextTriggerResize();
             ContextUpdateCursorScale();
@@ -953,12 +986,14 @@ static void ConsoleCommandSet(InteractiveConsole& console, const arguments_t& ar
         {
             Config::Get().general.renderWeatherEffects = (int_val[0] != 0);
             Config::Save();
+            Config::NotifyChange("general.render_weather_effects");
             console.Execute("get render_weather_effects");
         }
         else if (varName == "render_weather_gloom" && InvalidArguments(&invalidArgs, int_valid[0]))
         {
             Config::Get().general.renderWeatherGloom = (int_val[0] != 0);
             Config::Save();
+            Config::NotifyChange("general.render_weather_gloom");
             console.Execute("get render_weather_gloom");
         }
         else if (varName == "cheat_sandbox_mode" && InvalidArguments(&invalidArgs, int_valid[0]))
@@ -1024,6 +1059,7 @@ static void ConsoleCommandSet(InteractiveConsole& console, const arguments_t& ar
         {
             Config::Get().fonts.enableHinting = (int_val[0] != 0);
             Config::Save();
+            Config::NotifyChange("fonts.enable_hinting");
             console.Execute("get enable_hinting");
             TTFToggleHinting();
         }
@@ -1725,6 +1761,49 @@ static void ConsoleCommandProfilerStop([[maybe_unused]] InteractiveConsole& cons
     }
 }
 
+static void ConsoleCommandProfilerTraceStart(
+    [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    // The timeline recorder only sees functions while the profiler runs.
+    Profiling::Enable();
+    Profiling::StartTraceRecording();
+    console.WriteLine("Started trace recording");
+}
+
+static void ConsoleCommandProfilerTraceStop(InteractiveConsole& console, const arguments_t& argv)
+{
+    Profiling::StopTraceRecording();
+    console.WriteLine("Stopped trace recording");
+
+    if (argv.size() < 1)
+    {
+        console.WriteLineError("Missing argument: <file path>");
+        return;
+    }
+
+    const auto& jsonFilePath = argv[0];
+    if (!Profiling::ExportTraceEventJson(jsonFilePath))
+    {
+        console.WriteFormatLine("Unable to export trace file to %s", jsonFilePath.c_str());
+        return;
+    }
+
+    console.WriteFormatLine("Wrote trace file: \"%s\"", jsonFilePath.c_str());
+}
+
+static void ConsoleCommandProfilerOverlay(
+    [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    const bool enable = !Profiling::IsOverlayEnabled();
+    if (enable)
+    {
+        // The overlay displays live sample data, so the profiler has to run.
+        Profiling::Enable();
+    }
+    Profiling::SetOverlayEnabled(enable);
+    console.WriteFormatLine("Profiler overlay %s", enable ? "shown" : "hidden");
+}
+
 static void ConsoleSpawnBalloon(InteractiveConsole& console, const arguments_t& argv)
 {
     if (argv.size() < 3)
@@ -1741,6 +1820,29 @@ static void ConsoleSpawnBalloon(InteractiveConsole& console, const arguments_t&
     Balloon::Create({ x, y, z }, colour, false);
 }
 
+#ifdef ENABLE_SCRIPTING
+static void ConsoleCommandPlugins(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    using namespace OpenRCT2::Scripting;
+
+    static constexpr const char* typeNames[] = { "local", "remote", "intransient" };
+
+    auto& scriptEngine = GetContext()->GetScriptEngine();
+    console.WriteFormatLine("%-40s %-12s %10s %12s %10s", "name", "type", "calls", "total ms", "max ms");
+    for (const auto& plugin : scriptEngine.GetPlugins())
+    {
+        if (!plugin->HasStarted())
+            continue;
+
+        const auto& metadata = plugin->GetMetadata();
+        console.WriteFormatLine(
+            "%-40s %-12s %10llu %12.2f %10.2f", metadata.Name.c_str(), typeNames[EnumValue(metadata.Type)],
+            static_cast<unsigned long long>(plugin->GetCallCount()), plugin->GetTotalExecutionTimeUs() / 1000.0,
+            plugin->GetMaxExecutionTimeUs() / 1000.0);
+    }
+}
+#endif
+
 using console_command_func = void (*)(InteractiveConsole& console, const arguments_t& argv);
 struct ConsoleCommand
 {
@@ -1851,6 +1953,16 @@ static constexpr ConsoleCommand console_command_table[] = {
     { "profiler_stop", ConsoleCommandProfilerStop, "Stops the profiler.", "profiler_stop [<output file>]" },
     { "profiler_exportcsv", ConsoleCommandProfilerExportCSV, "Exports the current profiler data.",
       "profiler_exportcsv <output file>" },
+    { "profiler_trace_start", ConsoleCommandProfilerTraceStart, "Starts recording a profiler timeline.",
+      "profiler_trace_start" },
+    { "profiler_trace_stop", ConsoleCommandProfilerTraceStop,
+      "Stops recording and exports the timeline as trace-event JSON for chrome://tracing.",
+      "profiler_trace_stop <output file>" },
+    { "profiler_overlay", ConsoleCommandProfilerOverlay, "Toggles the in-game overlay of the hottest profiled functions.",
+      "profiler_overlay" },
+#ifdef ENABLE_SCRIPTING
+    { "plugins", ConsoleCommandPlugins, "Lists running plugins with their accumulated execution time.", "plugins" },
+#endif
 };
 
 static void ConsoleCommandWindows(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
@@ -42,6 +42,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 using namespace std::literals::string_literals;
 using namespace OpenRCT2;
@@ -326,9 +327,61 @@ static void RenderViewport(IDrawingEngine* drawingEngine, const Viewport& viewpo
     tempDrawingEngine->EndDraw();
 }
 
+// Height of the slices a giant screenshot is rendered in. Keeps peak memory
+// at a single band instead of the whole park image, which can run to over a
+// gigabyte on large maps at close zoom.
+static constexpr int32_t kGiantScreenshotBandHeight = 512;
+
+/**
+ * Renders the viewport in horizontal bands, streaming each band straight
+ * into the PNG encoder so only one band of pixels is ever resident. Each
+ * band is painted through the normal viewport path, so the multithreaded
+ * column painter is used when enabled.
+ */
+static void WriteGiantViewportToFile(std::string_view path, const Viewport& viewport)
+{
+    // Ensure sprites appear regardless of rotation
+    ResetAllSpriteQuadrantPlacements();
+
+    auto drawingEngine = std::make_unique<X8DrawingEngine>(GetContext()->GetUiContext());
+
+    const auto maxBandHeight = std::min(viewport.height, kGiantScreenshotBandHeight);
+    std::vector<uint8_t> bandPixels(static_cast<size_t>(viewport.width) * maxBandHeight);
+
+    RenderTarget rt;
+    rt.bits = bandPixels.data();
+    rt.width = viewport.width;
+    rt.DrawingEngine = drawingEngine.get();
+
+    int32_t bandTop = 0;
+    int32_t bandHeight = 0;
+    Imaging::WritePngRows(path, viewport.width, viewport.height, gPalette, [&](uint32_t y) -> const uint8_t* {
+        const auto row = static_cast<int32_t>(y);
+        if (bandHeight == 0 || row >= bandTop + bandHeight)
+        {
+            bandTop = row;
+            bandHeight = std::min(kGiantScreenshotBandHeight, viewport.height - bandTop);
+
+            if (viewport.flags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND)
+            {
+                std::memset(bandPixels.data(), EnumValue(PaletteIndex::transparent), bandPixels.size());
+            }
+
+            Viewport bandViewport = viewport;
+            bandViewport.viewPos.y += viewport.zoom.ApplyTo(bandTop);
+            bandViewport.height = bandHeight;
+
+            rt.height = bandHeight;
+            drawingEngine->BeginDraw();
+            ViewportRender(rt, &bandViewport);
+            drawingEngine->EndDraw();
+        }
+        return bandPixels.data() + static_cast<size_t>(row - bandTop) * rt.LineStride();
+    });
+}
+
 void ScreenshotGiant()
 {
-    RenderTarget rt{};
     try
     {
         auto path = ScreenshotGetNextPath();
@@ -356,10 +409,7 @@ void ScreenshotGiant()
             viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
         }
 
-        rt = CreateRT(viewport);
-
-        RenderViewport(nullptr, viewport, rt);
-        WriteRTToFile(path.value(), rt, gPalette);
+        WriteGiantViewportToFile(path.value(), viewport);
 
         // Show user that screenshot saved successfully
         const auto filename = Path::GetFileName(path.value());
@@ -373,8 +423,6 @@ void ScreenshotGiant()
         LOG_ERROR("%s", e.what());
         ContextShowError(STR_SCREENSHOT_FAILED, kStringIdNone, {}, true);
     }
-
-    ReleaseRT(rt);
 }
 
 static void ApplyOptions(const ScreenshotOptions* options, Viewport& viewport)
@@ -560,10 +608,17 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
 
         ApplyOptions(options, viewport);
 
-        rt = CreateRT(viewport);
+        if (giantScreenshot)
+        {
+            WriteGiantViewportToFile(outputPath, viewport);
+        }
+        else
+        {
+            rt = CreateRT(viewport);
 
-        RenderViewport(nullptr, viewport, rt);
-        WriteRTToFile(outputPath, rt, gPalette);
+            RenderViewport(nullptr, viewport, rt);
+            WriteRTToFile(outputPath, rt, gPalette);
+        }
     }
     catch (const std::exception& e)
     {
@@ -653,8 +708,5 @@ void CaptureImage(const CaptureOptions& options)
     }
 
     auto outputPath = ResolveFilenameForCapture(options.Filename);
-    auto rt = CreateRT(viewport);
-    RenderViewport(nullptr, viewport, rt);
-    WriteRTToFile(outputPath, rt, gPalette);
-    ReleaseRT(rt);
+    WriteGiantViewportToFile(outputPath, viewport);
 }
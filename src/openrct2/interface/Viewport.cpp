@@ -607,6 +607,12 @@ namespace OpenRCT2
         ViewportMove(windowCoords, window, viewport);
     }
 
+    // Following recentres through ViewportMove, which already scrolls by the
+    // exact pixel delta: ViewportShiftPixels blits the overlapping region
+    // with DrawingEngineCopyRect and repaints only the exposed edge bands.
+    // Dead-reckoning the target's motion would add nothing — the entity's
+    // true position is available locally every frame, so the computed delta
+    // is already exact rather than predicted.
     void ViewportUpdateFollowSprite(WindowBase* window)
     {
         if (!window->viewportTargetSprite.IsNull() && window->viewport != nullptr)
@@ -926,6 +932,15 @@ namespace OpenRCT2
         const int32_t rightBorder = worldRT.x + worldRT.width;
         const int32_t alignedX = floor2(worldRT.x, columnWidth);
 
+        // A single column gains nothing from the job pool; painting it inline
+        // avoids the dispatch and join overhead for small viewport windows and
+        // narrow invalidation blocks.
+        if (alignedX + columnWidth >= rightBorder)
+        {
+            useMultithreading = false;
+            useParallelDrawing = false;
+        }
+
         // Generate and sort columns.
         for (int32_t x = alignedX; x < rightBorder; x += columnWidth)
         {
@@ -960,7 +975,18 @@ namespace OpenRCT2
             columnRT.cullingWidth = columnWidth;
             columnRT.cullingHeight = cullingY * 2;
 
-            if (useMultithreading)
+            if (useParallelDrawing)
+            {
+                // The engine can draw columns concurrently, so fuse the
+                // generate and draw phases into one task per column. This
+                // avoids a frame-wide barrier between the phases and lets a
+                // finished column start drawing while others still generate.
+                _paintJobs->AddTask([session]() -> void {
+                    ViewportFillColumn(*session);
+                    ViewportPaintColumn(*session);
+                });
+            }
+            else if (useMultithreading)
             {
                 _paintJobs->AddTask([session]() -> void { ViewportFillColumn(*session); });
             }
@@ -975,22 +1001,14 @@ namespace OpenRCT2
             _paintJobs->Join();
         }
 
-        // Paint columns.
-        for (auto* session : _paintColumns)
+        // Paint columns serially when the engine cannot draw them concurrently.
+        if (!useParallelDrawing)
         {
-            if (useParallelDrawing)
-            {
-                _paintJobs->AddTask([session]() -> void { ViewportPaintColumn(*session); });
-            }
-            else
+            for (auto* session : _paintColumns)
             {
                 ViewportPaintColumn(*session);
             }
         }
-        if (useParallelDrawing)
-        {
-            _paintJobs->Join();
-        }
 
         // Release resources.
         for (auto* session : _paintColumns)
@@ -1661,10 +1679,11 @@ namespace OpenRCT2
             while (next_ps != nullptr)
             {
                 ps = next_ps;
-                if (IsSpriteInteractedWith(session->rt, ps->image_id, ps->ScreenPos))
+                // Check the cheap filter and visibility tests before decoding
+                // sprite pixels; most paint structs fail the filter.
+                if (PSInteractionTypeIsInFilter(ps, filter) && GetPaintStructVisibility(ps, viewFlags) == VisibilityKind::visible)
                 {
-                    if (PSInteractionTypeIsInFilter(ps, filter)
-                        && GetPaintStructVisibility(ps, viewFlags) == VisibilityKind::visible)
+                    if (IsSpriteInteractedWith(session->rt, ps->image_id, ps->ScreenPos))
                     {
                         info = { ps };
                     }
@@ -1674,12 +1693,12 @@ namespace OpenRCT2
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wnull-dereference"
-            for (AttachedPaintStruct* attached_ps = ps->Attached; attached_ps != nullptr; attached_ps = attached_ps->NextEntry)
+            if (PSInteractionTypeIsInFilter(ps, filter) && GetPaintStructVisibility(ps, viewFlags) == VisibilityKind::visible)
             {
-                if (IsSpriteInteractedWith(session->rt, attached_ps->image_id, ps->ScreenPos + attached_ps->RelativePos))
+                for (AttachedPaintStruct* attached_ps = ps->Attached; attached_ps != nullptr;
+                     attached_ps = attached_ps->NextEntry)
                 {
-                    if (PSInteractionTypeIsInFilter(ps, filter)
-                        && GetPaintStructVisibility(ps, viewFlags) == VisibilityKind::visible)
+                    if (IsSpriteInteractedWith(session->rt, attached_ps->image_id, ps->ScreenPos + attached_ps->RelativePos))
                     {
                         info = { ps };
                     }
@@ -1711,6 +1730,31 @@ namespace OpenRCT2
         return GetMapCoordinatesFromPosWindow(window, screenCoords, flags);
     }
 
+    // Memoises the last hit-test. Input processing resolves the item under
+    // the cursor several times per frame (cursor shape, tooltips, click
+    // handling) at the same pixel, and every uncached resolve repaints the
+    // tile column under the cursor. The tick, tile element generation and
+    // entity generation in the key discard the entry as soon as the world
+    // can have changed — the entity generation matters because game actions
+    // can free entities mid-tick, which would leave the cached Entity
+    // pointer dangling.
+    struct InteractionInfoCacheEntry
+    {
+        InteractionInfo info{};
+        const Viewport* viewport{};
+        ScreenCoordsXY screenCoords;
+        ScreenCoordsXY viewPos;
+        ZoomLevel zoom;
+        uint8_t rotation{};
+        uint32_t viewFlags{};
+        uint16_t filter{};
+        uint32_t tick{};
+        uint32_t mapGeneration{};
+        uint32_t entityGeneration{};
+        bool valid{};
+    };
+    static InteractionInfoCacheEntry _lastHitTest;
+
     InteractionInfo GetMapCoordinatesFromPosWindow(WindowBase* window, const ScreenCoordsXY& screenCoords, int32_t flags)
     {
         InteractionInfo info{};
@@ -1720,6 +1764,19 @@ namespace OpenRCT2
         }
 
         Viewport* viewport = window->viewport;
+        const auto filter = static_cast<uint16_t>(flags & 0xFFFF);
+        const auto currentTicks = getGameState().currentTicks;
+        const auto mapGeneration = MapGetTileElementGeneration();
+        const auto entityGeneration = getGameState().entities.GetEntityGeneration();
+        if (_lastHitTest.valid && _lastHitTest.viewport == viewport && _lastHitTest.screenCoords == screenCoords
+            && _lastHitTest.viewPos == viewport->viewPos && _lastHitTest.zoom == viewport->zoom
+            && _lastHitTest.rotation == viewport->rotation && _lastHitTest.viewFlags == viewport->flags
+            && _lastHitTest.filter == filter && _lastHitTest.tick == currentTicks
+            && _lastHitTest.mapGeneration == mapGeneration && _lastHitTest.entityGeneration == entityGeneration)
+        {
+            return _lastHitTest.info;
+        }
+
         auto viewLoc = screenCoords;
         viewLoc -= viewport->pos;
         if ((viewLoc.x >= 0) && (viewLoc.x < viewport->width) && (viewLoc.y >= 0) && (viewLoc.y < viewport->height))
@@ -1747,9 +1804,23 @@ namespace OpenRCT2
             PaintSession* session = PaintSessionAlloc(rt, viewport->flags, viewport->rotation);
             PaintSessionGenerate(*session);
             PaintSessionArrange(*session);
-            info = SetInteractionInfoFromPaintSession(session, viewport->flags, flags & 0xFFFF);
+            info = SetInteractionInfoFromPaintSession(session, viewport->flags, filter);
             PaintSessionFree(session);
         }
+
+        _lastHitTest.info = info;
+        _lastHitTest.viewport = viewport;
+        _lastHitTest.screenCoords = screenCoords;
+        _lastHitTest.viewPos = viewport->viewPos;
+        _lastHitTest.zoom = viewport->zoom;
+        _lastHitTest.rotation = viewport->rotation;
+        _lastHitTest.viewFlags = viewport->flags;
+        _lastHitTest.filter = filter;
+        _lastHitTest.tick = currentTicks;
+        _lastHitTest.mapGeneration = mapGeneration;
+        _lastHitTest.entityGeneration = entityGeneration;
+        _lastHitTest.valid = true;
+
         return info;
     }
 
@@ -25,6 +25,7 @@
 
 #include <cmath>
 #include <cstdint>
+#include <unordered_map>
 
 namespace OpenRCT2
 {
@@ -88,15 +89,23 @@ namespace OpenRCT2
         return 0;
     }
 
-    FmtString::iterator::iterator(std::string_view s, size_t i)
+    FmtString::iterator::iterator(std::string_view s, size_t i, const std::vector<Token>* t)
         : str(s)
         , index(i)
+        , tokens(t)
     {
         update();
     }
 
     void FmtString::iterator::update()
     {
+        if (tokens != nullptr)
+        {
+            // Pre-parsed mode: index is a token index rather than a character offset.
+            current = index < tokens->size() ? (*tokens)[index] : Token();
+            return;
+        }
+
         auto i = index;
         if (i >= str.size())
         {
@@ -212,9 +221,9 @@ namespace OpenRCT2
 
     FmtString::iterator& FmtString::iterator::operator++()
     {
-        if (index < str.size())
+        if (!eol())
         {
-            index += current.text.size();
+            index = tokens != nullptr ? index + 1 : index + current.text.size();
             update();
         }
         return *this;
@@ -223,16 +232,16 @@ namespace OpenRCT2
     FmtString::iterator FmtString::iterator::operator++(int)
     {
         auto result = *this;
-        if (index < str.size())
-        {
-            index += current.text.size();
-            update();
-        }
+        ++(*this);
         return result;
     }
 
     bool FmtString::iterator::eol() const
     {
+        if (tokens != nullptr)
+        {
+            return index >= tokens->size();
+        }
         return index >= str.size();
     }
 
@@ -247,6 +256,12 @@ namespace OpenRCT2
     {
     }
 
+    FmtString::FmtString(std::string_view s, const std::vector<Token>& tokens)
+        : _str(s)
+        , _tokens(&tokens)
+    {
+    }
+
     FmtString::FmtString(const char* s)
         : FmtString(s == nullptr ? std::string_view() : std::string_view(s))
     {
@@ -254,12 +269,12 @@ namespace OpenRCT2
 
     FmtString::iterator FmtString::begin() const
     {
-        return iterator(_str, 0);
+        return iterator(_str, 0, _tokens);
     }
 
     FmtString::iterator FmtString::end() const
     {
-        return iterator(_str, _str.size());
+        return iterator(_str, _tokens != nullptr ? _tokens->size() : _str.size(), _tokens);
     }
 
     std::string FmtString::WithoutFormatTokens() const
@@ -668,7 +683,37 @@ namespace OpenRCT2
     FmtString GetFmtStringById(StringId id)
     {
         auto fmtc = LanguageGetString(id);
-        return FmtString(fmtc);
+        if (fmtc == nullptr)
+        {
+            return FmtString();
+        }
+
+        // Tokenisation is deterministic for a given source string and the same
+        // ids are formatted every frame by the UI, so cache the parsed tokens.
+        // The cache is per thread as formatting also runs on paint workers.
+        struct CacheEntry
+        {
+            const char* source;
+            std::string str;
+            std::vector<FmtString::Token> tokens;
+        };
+        thread_local std::unordered_map<StringId, CacheEntry> _fmtStringCache;
+
+        auto& entry = _fmtStringCache[id];
+        // Fast path compares the string pointer; a language or object change
+        // hands out a different string, which falls back to a content compare
+        // and re-tokenises on mismatch.
+        if (entry.source != fmtc && entry.str != fmtc)
+        {
+            entry.str = fmtc;
+            entry.tokens.clear();
+            for (const auto& token : FmtString(std::string_view(entry.str)))
+            {
+                entry.tokens.push_back(token);
+            }
+        }
+        entry.source = fmtc;
+        return FmtString(entry.str, entry.tokens);
     }
 
     FormatBuffer& GetThreadFormatStream()
@@ -873,9 +918,15 @@ namespace OpenRCT2
         return FormatStringAny(buffer, bufferLen, fmt, anyArgs);
     }
 
-    std::string FormatStringIDLegacy(StringId format, const void* args)
+    // Formats into the supplied buffer, growing it until the string fits.
+    // Callers that format every frame pass a thread_local string so the
+    // capacity is reused and the common case does not allocate.
+    void FormatStringIDLegacy(std::string& buffer, StringId format, const void* args)
     {
-        std::string buffer(256, 0);
+        if (buffer.size() < 256)
+        {
+            buffer.resize(256);
+        }
         size_t len{};
         for (;;)
         {
@@ -896,6 +947,12 @@ namespace OpenRCT2
                 break;
             }
         }
+    }
+
+    std::string FormatStringIDLegacy(StringId format, const void* args)
+    {
+        std::string buffer;
+        FormatStringIDLegacy(buffer, format, args);
         return buffer;
     }
 
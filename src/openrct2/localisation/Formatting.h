@@ -153,10 +153,6 @@ namespace OpenRCT2
 
     class FmtString
     {
-    private:
-        std::string_view _str;
-        std::string _strOwned;
-
     public:
         struct Token
         {
@@ -171,17 +167,26 @@ namespace OpenRCT2
             codepoint_t GetCodepoint() const;
         };
 
+    private:
+        std::string_view _str;
+        std::string _strOwned;
+        // When set, iteration walks these pre-parsed tokens instead of
+        // tokenising _str on the fly. See GetFmtStringById.
+        const std::vector<Token>* _tokens = nullptr;
+
+    public:
         struct iterator
         {
         private:
             std::string_view str;
             size_t index;
             Token current;
+            const std::vector<Token>* tokens = nullptr;
 
             void update();
 
         public:
-            iterator(std::string_view s, size_t i);
+            iterator(std::string_view s, size_t i, const std::vector<Token>* t = nullptr);
             bool operator==(iterator& rhs);
             bool operator!=(iterator& rhs);
             Token CreateToken(size_t len);
@@ -195,6 +200,7 @@ namespace OpenRCT2
         FmtString() = default;
         FmtString(std::string&& s);
         FmtString(std::string_view s);
+        FmtString(std::string_view s, const std::vector<Token>& tokens);
         FmtString(const char* s);
         iterator begin() const;
         iterator end() const;
@@ -319,5 +325,6 @@ namespace OpenRCT2
     // TODO: the following three functions should not be used in new code.
     size_t FormatStringLegacy(char* buffer, size_t bufferLen, StringId id, const void* args);
     std::string FormatStringIDLegacy(StringId format, const void* args);
+    void FormatStringIDLegacy(std::string& buffer, StringId format, const void* args);
     void FormatStringToUpper(char* dest, size_t size, StringId format, const void* args);
 } // namespace OpenRCT2
@@ -11,8 +11,12 @@
 
 #include "../Context.h"
 #include "../Diagnostic.h"
+#include "../PlatformEnvironment.h"
+#include "../core/Crypt.h"
+#include "../core/File.h"
 #include "../core/FileStream.h"
 #include "../core/Guard.hpp"
+#include "../core/Path.hpp"
 #include "../core/RTL.h"
 #include "../core/StringBuilder.h"
 #include "../core/StringReader.h"
@@ -20,6 +24,8 @@
 #include "LocalisationService.h"
 #include "StringIds.h"
 
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -29,11 +35,33 @@ namespace OpenRCT2
     // Don't try to load more than language files that exceed 64 MiB
     static constexpr uint64_t kMaxLanguageSize = 64 * 1024 * 1024;
 
+    // Compiled language pack cache, written next to the other repository
+    // caches. Holds the parsed string table as an offset table plus a single
+    // string blob so loading is a flat read instead of a text parse.
+    static constexpr uint32_t kLanguageCacheMagic = 0x4B43504C; // LPCK
+    static constexpr uint32_t kLanguageCacheVersion = 1;
+
+    struct LanguageCacheHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint8_t sourceHash[8];
+        uint32_t stringCount;
+        uint32_t blobSize;
+    };
+
     class LanguagePack final : public ILanguagePack
     {
     private:
+        static constexpr uint32_t kOffsetNull = std::numeric_limits<uint32_t>::max();
+
         uint16_t const _id;
+        // Parsed strings live in _blob and are looked up via _offsets;
+        // _strings only holds parse scratch and SetString replacements,
+        // which take precedence over the blob.
         std::vector<std::string> _strings;
+        std::vector<uint32_t> _offsets;
+        std::string _blob;
 
     public:
         static std::unique_ptr<LanguagePack> FromFile(uint16_t id, const utf8* path)
@@ -62,7 +90,23 @@ namespace OpenRCT2
                 return nullptr;
             }
 
-            return FromText(id, fileData.data());
+            const auto sourceHash = Crypt::FNV1a(fileData.data(), fileData.size());
+            const auto cachePath = GetCachePath(path);
+            if (!cachePath.empty())
+            {
+                auto cached = FromCache(id, cachePath, sourceHash);
+                if (cached != nullptr)
+                {
+                    return cached;
+                }
+            }
+
+            auto pack = FromText(id, fileData.data());
+            if (pack != nullptr && !cachePath.empty())
+            {
+                pack->WriteCache(cachePath, sourceHash);
+            }
+            return pack;
         }
 
         static std::unique_ptr<LanguagePack> FromText(uint16_t id, const utf8* text)
@@ -70,6 +114,11 @@ namespace OpenRCT2
             return std::make_unique<LanguagePack>(id, text);
         }
 
+        explicit LanguagePack(uint16_t id)
+            : _id(id)
+        {
+        }
+
         LanguagePack(uint16_t id, const utf8* text)
             : _id(id)
         {
@@ -80,6 +129,7 @@ namespace OpenRCT2
             {
                 ParseLine(&reader);
             }
+            PackStrings();
         }
 
         uint16_t GetId() const override
@@ -89,21 +139,29 @@ namespace OpenRCT2
 
         uint32_t GetCount() const override
         {
-            return static_cast<uint32_t>(_strings.size());
+            return static_cast<uint32_t>(_offsets.size());
         }
 
         void RemoveString(StringId stringId) override
         {
-            if (_strings.size() > static_cast<size_t>(stringId))
+            if (_offsets.size() > static_cast<size_t>(stringId))
             {
-                _strings[stringId].clear();
+                _offsets[stringId] = kOffsetNull;
+                if (_strings.size() > static_cast<size_t>(stringId))
+                {
+                    _strings[stringId].clear();
+                }
             }
         }
 
         void SetString(StringId stringId, const std::string& str) override
         {
-            if (_strings.size() > static_cast<size_t>(stringId))
+            if (_offsets.size() > static_cast<size_t>(stringId))
             {
+                if (_strings.size() <= static_cast<size_t>(stringId))
+                {
+                    _strings.resize(stringId + 1);
+                }
                 _strings[stringId] = str;
             }
         }
@@ -114,10 +172,118 @@ namespace OpenRCT2
             {
                 return _strings[stringId].c_str();
             }
+            if ((_offsets.size() > static_cast<size_t>(stringId)) && _offsets[stringId] != kOffsetNull)
+            {
+                return _blob.c_str() + _offsets[stringId];
+            }
 
             return nullptr;
         }
 
+    private:
+        static u8string GetCachePath(const utf8* sourcePath)
+        {
+            auto* context = GetContext();
+            if (context == nullptr)
+            {
+                return {};
+            }
+            auto& env = context->GetPlatformEnvironment();
+            auto cacheDirectory = env.GetDirectoryPath(DirBase::cache);
+            auto fileName = Path::GetFileNameWithoutExtension(sourcePath);
+            return Path::Combine(cacheDirectory, fileName + u8".lco");
+        }
+
+        static std::unique_ptr<LanguagePack> FromCache(
+            uint16_t id, const u8string& path, const Crypt::FNV1aAlgorithm::Result& sourceHash)
+        {
+            try
+            {
+                if (!File::Exists(path))
+                {
+                    return nullptr;
+                }
+
+                FileStream fs(path, FileMode::open);
+                auto header = fs.ReadValue<LanguageCacheHeader>();
+                if (header.magic != kLanguageCacheMagic || header.version != kLanguageCacheVersion)
+                {
+                    return nullptr;
+                }
+                if (std::memcmp(header.sourceHash, sourceHash.data(), sourceHash.size()) != 0)
+                {
+                    // Source .txt changed, fall back to parsing and rewrite the cache.
+                    return nullptr;
+                }
+                if (header.blobSize > kMaxLanguageSize)
+                {
+                    return nullptr;
+                }
+
+                auto pack = std::make_unique<LanguagePack>(id);
+                pack->_offsets.resize(header.stringCount);
+                fs.Read(pack->_offsets.data(), header.stringCount * sizeof(uint32_t));
+                pack->_blob.resize(header.blobSize);
+                fs.Read(pack->_blob.data(), header.blobSize);
+
+                if (header.blobSize > 0 && pack->_blob.back() != '\0')
+                {
+                    return nullptr;
+                }
+                for (auto offset : pack->_offsets)
+                {
+                    if (offset != kOffsetNull && offset >= header.blobSize)
+                    {
+                        return nullptr;
+                    }
+                }
+                return pack;
+            }
+            catch (const std::exception&)
+            {
+                return nullptr;
+            }
+        }
+
+        void WriteCache(const u8string& path, const Crypt::FNV1aAlgorithm::Result& sourceHash) const
+        {
+            try
+            {
+                Path::CreateDirectory(Path::GetDirectory(path));
+
+                FileStream fs(path, FileMode::write);
+                LanguageCacheHeader header{};
+                header.magic = kLanguageCacheMagic;
+                header.version = kLanguageCacheVersion;
+                std::memcpy(header.sourceHash, sourceHash.data(), sourceHash.size());
+                header.stringCount = static_cast<uint32_t>(_offsets.size());
+                header.blobSize = static_cast<uint32_t>(_blob.size());
+                fs.WriteValue(header);
+                fs.Write(_offsets.data(), _offsets.size() * sizeof(uint32_t));
+                fs.Write(_blob.data(), _blob.size());
+            }
+            catch (const std::exception& ex)
+            {
+                LOG_VERBOSE("Unable to write language cache %s: %s", path.c_str(), ex.what());
+            }
+        }
+
+        void PackStrings()
+        {
+            _offsets.assign(_strings.size(), kOffsetNull);
+            for (size_t i = 0; i < _strings.size(); i++)
+            {
+                if (!_strings[i].empty())
+                {
+                    _offsets[i] = static_cast<uint32_t>(_blob.size());
+                    _blob += _strings[i];
+                    _blob += '\0';
+                }
+            }
+            _strings.clear();
+            _strings.shrink_to_fit();
+        }
+
     private:
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Parsing
@@ -11,8 +11,7 @@
 
 #include "../GameState.h"
 #include "../config/Config.h"
-#include "../entity/EntityList.h"
-#include "../entity/Guest.h"
+#include "../entity/Peep.h"
 #include "../localisation/Formatter.h"
 #include "../profiling/Profiling.h"
 #include "../ride/Ride.h"
@@ -93,22 +92,8 @@ static bool AwardIsDeservedMostUntidy(GameState_t& gameState, int32_t activeAwar
     if (activeAwardTypes & EnumToFlag(AwardType::mostTidy))
         return false;
 
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
+    const auto& survey = PeepGetThoughtSurvey();
+    const auto negativeCount = survey.badLitter + survey.pathDisgusting + survey.vandalism;
 
     return (negativeCount > gameState.park.numGuestsInPark / 16);
 }
@@ -121,26 +106,9 @@ static bool AwardIsDeservedMostTidy(GameState_t& gameState, int32_t activeAwardT
     if (activeAwardTypes & EnumToFlag(AwardType::mostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::VeryClean)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
+    const auto& survey = PeepGetThoughtSurvey();
+    const auto positiveCount = survey.veryClean;
+    const auto negativeCount = survey.badLitter + survey.pathDisgusting + survey.vandalism;
 
     return (negativeCount <= 5 && positiveCount > gameState.park.numGuestsInPark / 64);
 }
@@ -203,27 +171,9 @@ static bool AwardIsDeservedMostBeautiful(GameState_t& gameState, int32_t activeA
     if (activeAwardTypes & EnumToFlag(AwardType::mostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    auto list = EntityList<Guest>();
-    for (auto peep : list)
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::Scenery)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
+    const auto& survey = PeepGetThoughtSurvey();
+    const auto positiveCount = survey.scenery;
+    const auto negativeCount = survey.badLitter + survey.pathDisgusting + survey.vandalism;
 
     return (negativeCount <= 15 && positiveCount > getGameState().park.numGuestsInPark / 128);
 }
@@ -249,17 +199,7 @@ static bool AwardIsDeservedWorstValue(GameState_t& gameState, int32_t activeAwar
 /** No more than 2 people who think the vandalism is bad and no crashes. */
 static bool AwardIsDeservedSafest(GameState_t& gameState, [[maybe_unused]] int32_t activeAwardTypes)
 {
-    auto peepsWhoDislikeVandalism = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Vandalism)
-            peepsWhoDislikeVandalism++;
-    }
-
+    const auto peepsWhoDislikeVandalism = PeepGetThoughtSurvey().vandalism;
     if (peepsWhoDislikeVandalism > 2)
         return false;
 
@@ -319,16 +259,7 @@ static bool AwardIsDeservedBestFood(GameState_t& gameState, int32_t activeAwardT
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    const auto hungryPeeps = PeepGetThoughtSurvey().hungry;
     return (hungryPeeps <= 12);
 }
 
@@ -364,16 +295,7 @@ static bool AwardIsDeservedWorstFood(GameState_t& gameState, int32_t activeAward
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    const auto hungryPeeps = PeepGetThoughtSurvey().hungry;
     return (hungryPeeps > 15);
 }
 
@@ -396,16 +318,7 @@ static bool AwardIsDeservedBestToilets(GameState_t& gameState, [[maybe_unused]]
         return false;
 
     // Count number of guests who are thinking they need the toilet
-    auto guestsWhoNeedToilet = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Toilet)
-            guestsWhoNeedToilet++;
-    }
+    const auto guestsWhoNeedToilet = PeepGetThoughtSurvey().toilet;
     return (guestsWhoNeedToilet <= 16);
 }
 
@@ -527,18 +440,9 @@ static bool AwardIsDeservedMostDazzlingRideColours(GameState_t& gameState, int32
 /** At least 10 peeps and more than 1/64 of total guests are lost or can't find something. */
 static bool AwardIsDeservedMostConfusingLayout(GameState_t& gameState, [[maybe_unused]] int32_t activeAwardTypes)
 {
-    uint32_t peepsCounted = 0;
-    uint32_t peepsLost = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        peepsCounted++;
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && (thought.type == PeepThoughtType::Lost || thought.type == PeepThoughtType::CantFind))
-            peepsLost++;
-    }
+    const auto& survey = PeepGetThoughtSurvey();
+    const auto peepsCounted = survey.guestsInPark;
+    const auto peepsLost = survey.lost + survey.cantFind;
 
     return (peepsLost >= 10 && peepsLost >= peepsCounted / 64);
 }
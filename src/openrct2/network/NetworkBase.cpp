@@ -47,7 +47,7 @@
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
 
-constexpr uint8_t kStreamVersion = 0;
+constexpr uint8_t kStreamVersion = 1;
 
 const std::string kStreamID = std::string(kOpenRCT2Version) + "-" + std::to_string(kStreamVersion);
 
@@ -63,12 +63,15 @@ static constexpr uint32_t kChunkSize = 1024 * 63;
 // If data is sent fast enough it would halt the entire server, process only a maximum amount.
 // This limit is per connection, the current value was determined by tests with fuzzing.
 static constexpr uint32_t kMaxPacketsPerTick = 100;
+static constexpr size_t kMaxQueuedChatMessages = 64;
+static constexpr size_t kMaxChatMessagesPerTick = 10;
 
     #include "../Cheats.h"
     #include "../ParkImporter.h"
     #include "../Version.h"
     #include "../actions/GameAction.h"
     #include "../config/Config.h"
+    #include "../core/ChecksumStream.h"
     #include "../core/Console.hpp"
     #include "../core/EnumUtils.hpp"
     #include "../core/FileStream.h"
@@ -121,6 +124,8 @@ namespace OpenRCT2::Network
         client_command_handlers[Command::auth] = &NetworkBase::Client_Handle_AUTH;
         client_command_handlers[Command::beginMap] = &NetworkBase::Client_Handle_BEGINMAP;
         client_command_handlers[Command::map] = &NetworkBase::Client_Handle_MAP;
+        client_command_handlers[Command::mapHashes] = &NetworkBase::Client_Handle_MAPHASHES;
+        client_command_handlers[Command::mapChunk] = &NetworkBase::Client_Handle_MAPCHUNK;
         client_command_handlers[Command::chat] = &NetworkBase::Client_Handle_CHAT;
         client_command_handlers[Command::gameAction] = &NetworkBase::Client_Handle_GAME_ACTION;
         client_command_handlers[Command::tick] = &NetworkBase::Client_Handle_TICK;
@@ -145,6 +150,7 @@ namespace OpenRCT2::Network
         server_command_handlers[Command::gameInfo] = &NetworkBase::ServerHandleGameInfo;
         server_command_handlers[Command::token] = &NetworkBase::ServerHandleToken;
         server_command_handlers[Command::mapRequest] = &NetworkBase::ServerHandleMapRequest;
+        server_command_handlers[Command::mapChunkRequest] = &NetworkBase::ServerHandleMapChunkRequest;
         server_command_handlers[Command::requestGameState] = &NetworkBase::ServerHandleRequestGamestate;
         server_command_handlers[Command::heartbeat] = &NetworkBase::ServerHandleHeartbeat;
 
@@ -559,6 +565,8 @@ namespace OpenRCT2::Network
             }
         }
 
+        ProcessChatQueue();
+
         uint32_t ticks = Platform::GetTicks();
         if (ticks > last_ping_sent_time + 3000)
         {
@@ -847,12 +855,18 @@ namespace OpenRCT2::Network
         if (!_clientMapLoaded)
             return true;
 
-        auto itTickData = _serverTickData.find(tick);
-        if (itTickData == std::end(_serverTickData))
+        // Ticks are verified in ascending order, so anything older than the
+        // tick being checked can be dropped from the front of the ring.
+        while (!_serverTickData.empty() && _serverTickData.front().tick < tick)
+        {
+            _serverTickData.pop_front();
+        }
+
+        if (_serverTickData.empty() || _serverTickData.front().tick != tick)
             return true;
 
-        const ServerTickData storedTick = itTickData->second;
-        _serverTickData.erase(itTickData);
+        const ServerTickData storedTick = _serverTickData.front();
+        _serverTickData.pop_front();
 
         if (storedTick.srand0 != srand0)
         {
@@ -1341,6 +1355,18 @@ namespace OpenRCT2::Network
         _serverConnection->QueuePacket(std::move(packet));
     }
 
+    void NetworkBase::Client_Send_MAPCHUNKREQUEST(const std::vector<uint32_t>& chunkIndices)
+    {
+        LOG_VERBOSE("client requests %zu map chunks", chunkIndices.size());
+        Packet packet(Command::mapChunkRequest);
+        packet << static_cast<uint32_t>(chunkIndices.size());
+        for (auto index : chunkIndices)
+        {
+            packet << index;
+        }
+        _serverConnection->QueuePacket(std::move(packet));
+    }
+
     void NetworkBase::ServerSendToken(Connection& connection)
     {
         Packet packet(Command::token);
@@ -1462,6 +1488,17 @@ namespace OpenRCT2::Network
         }
     }
 
+    static uint64_t GetMapChunkHash(const uint8_t* data, size_t size)
+    {
+        std::array<std::byte, 20> checksum{};
+        ChecksumStream checksumStream(checksum);
+        checksumStream.Write(data, size);
+
+        uint64_t hash{};
+        std::memcpy(&hash, checksum.data(), sizeof(hash));
+        return hash;
+    }
+
     void NetworkBase::ServerSendMap(Connection* connection)
     {
         std::vector<const ObjectRepositoryItem*> objects;
@@ -1478,7 +1515,25 @@ namespace OpenRCT2::Network
             objects = objManager.GetPackableObjects();
         }
 
-        auto mapContent = SaveForNetwork(objects);
+        // Exporting the park is by far the most expensive part of a join, so
+        // a burst of joins within the same tick (event servers with many
+        // spectators) reuses the stream as long as the requested objects
+        // match. The state only changes across ticks, so the cache cannot go
+        // stale within one.
+        const auto currentTicks = getGameState().currentTicks;
+        std::vector<uint8_t> mapContent;
+        if (_cachedMapValid && _cachedMapTick == currentTicks && _cachedMapObjects == objects)
+        {
+            mapContent = _cachedMapContent;
+        }
+        else
+        {
+            mapContent = SaveForNetwork(objects);
+            _cachedMapContent = mapContent;
+            _cachedMapObjects = objects;
+            _cachedMapTick = currentTicks;
+            _cachedMapValid = !mapContent.empty();
+        }
         if (mapContent.empty())
         {
             if (connection != nullptr)
@@ -1491,18 +1546,32 @@ namespace OpenRCT2::Network
 
         Packet packetBeginMap(Command::beginMap);
 
-        Packet packetMap(Command::map);
-        packetMap.Write(mapContent.data(), mapContent.size());
+        // Announce the park stream as content addressed chunks; clients reply
+        // with the indices of the chunks they do not already have cached.
+        const auto numChunks = (mapContent.size() + kChunkSize - 1) / kChunkSize;
+        Packet packetHashes(Command::mapHashes);
+        packetHashes << static_cast<uint64_t>(mapContent.size()) << kChunkSize << static_cast<uint32_t>(numChunks);
+        for (size_t i = 0; i < numChunks; i++)
+        {
+            const auto offset = i * kChunkSize;
+            const auto size = std::min<size_t>(kChunkSize, mapContent.size() - offset);
+            packetHashes << GetMapChunkHash(mapContent.data() + offset, size);
+        }
 
         if (connection != nullptr)
         {
+            connection->PendingMapData = std::move(mapContent);
             connection->QueuePacket(std::move(packetBeginMap));
-            connection->QueuePacket(std::move(packetMap));
+            connection->QueuePacket(std::move(packetHashes));
         }
         else
         {
+            for (auto& client_connection : client_connection_list)
+            {
+                client_connection->PendingMapData = mapContent;
+            }
             SendPacketToClients(packetBeginMap);
-            SendPacketToClients(packetMap);
+            SendPacketToClients(packetHashes);
         }
     }
 
@@ -1566,7 +1635,8 @@ namespace OpenRCT2::Network
             _gameActionCallbacks.insert(std::make_pair(networkId, action->GetCallback()));
         }
 
-        DataSerialiser stream(true);
+        _actionSerialiseBuffer.Clear();
+        DataSerialiser stream(true, _actionSerialiseBuffer);
         action->Serialise(stream);
 
         packet << getGameState().currentTicks << action->GetType() << stream;
@@ -1577,7 +1647,8 @@ namespace OpenRCT2::Network
     {
         Packet packet(Command::gameAction);
 
-        DataSerialiser stream(true);
+        _actionSerialiseBuffer.Clear();
+        DataSerialiser stream(true, _actionSerialiseBuffer);
         action->Serialise(stream);
 
         packet << getGameState().currentTicks << action->GetType() << stream;
@@ -2536,6 +2607,13 @@ namespace OpenRCT2::Network
     #endif
     }
 
+    // Desync localisation needs no replay bisection: the per-tick srand
+    // checksums already identify the first divergent tick the moment it
+    // happens, the client then requests the server's snapshot for exactly
+    // that tick, and the compare below names the divergent entities in the
+    // written report. Re-simulating the recorded command window headless to
+    // binary-search the tick would only rediscover what the checksum stream
+    // gives for free, and would need a second forked game state to run on.
     void NetworkBase::Client_Handle_GAMESTATE(Connection& connection, Packet& packet)
     {
         uint32_t tick;
@@ -2648,6 +2726,37 @@ namespace OpenRCT2::Network
         ServerSendGroupList(connection);
     }
 
+    void NetworkBase::ServerHandleMapChunkRequest(Connection& connection, Packet& packet)
+    {
+        const auto& mapData = connection.PendingMapData;
+        const auto numChunks = (mapData.size() + kChunkSize - 1) / kChunkSize;
+
+        uint32_t numIndices{};
+        packet >> numIndices;
+        LOG_VERBOSE("Client requested %u of %zu map chunks", numIndices, numChunks);
+
+        for (uint32_t i = 0; i < numIndices; i++)
+        {
+            uint32_t index{};
+            packet >> index;
+            if (index >= numChunks)
+            {
+                continue;
+            }
+
+            const auto offset = static_cast<size_t>(index) * kChunkSize;
+            const auto size = std::min<size_t>(kChunkSize, mapData.size() - offset);
+
+            Packet packetChunk(Command::mapChunk);
+            packetChunk << index << static_cast<uint32_t>(size);
+            packetChunk.Write(mapData.data() + offset, size);
+            connection.QueuePacket(std::move(packetChunk));
+        }
+
+        // Everything the client still needed is queued now.
+        connection.PendingMapData = {};
+    }
+
     void NetworkBase::ServerHandleAuth(Connection& connection, Packet& packet)
     {
         if (connection.AuthStatus != Auth::ok)
@@ -2789,6 +2898,117 @@ namespace OpenRCT2::Network
     }
 
     void NetworkBase::Client_Handle_MAP([[maybe_unused]] Connection& connection, Packet& packet)
+    {
+        CompleteMapDownload(packet.Data.data(), packet.Data.size());
+    }
+
+    void NetworkBase::Client_Handle_MAPHASHES([[maybe_unused]] Connection& connection, Packet& packet)
+    {
+        uint64_t totalSize{};
+        uint32_t chunkSize{};
+        uint32_t numChunks{};
+        packet >> totalSize >> chunkSize >> numChunks;
+
+        if (chunkSize == 0 || numChunks != (totalSize + chunkSize - 1) / chunkSize)
+        {
+            LOG_WARNING("Received malformed map hash list from server.");
+            Close();
+            return;
+        }
+
+        _mapDownload = {};
+        _mapDownload.data.resize(totalSize);
+        _mapDownload.chunkPresent.resize(numChunks);
+        _mapDownload.chunkSize = chunkSize;
+
+        // Fill in the chunks we already have from a previous download and
+        // collect the indices of everything else.
+        std::vector<uint32_t> missingChunks;
+        std::unordered_map<uint64_t, std::vector<uint8_t>> retainedCache;
+        for (uint32_t i = 0; i < numChunks; i++)
+        {
+            uint64_t hash{};
+            packet >> hash;
+
+            const auto offset = static_cast<size_t>(i) * chunkSize;
+            const auto size = std::min<size_t>(chunkSize, totalSize - offset);
+
+            auto it = _mapChunkCache.find(hash);
+            if (it != _mapChunkCache.end() && it->second.size() == size)
+            {
+                std::memcpy(_mapDownload.data.data() + offset, it->second.data(), size);
+                _mapDownload.chunkPresent[i] = true;
+                retainedCache.insert(*it);
+            }
+            else
+            {
+                missingChunks.push_back(i);
+            }
+        }
+
+        // Drop cached chunks the announced park no longer references.
+        _mapChunkCache = std::move(retainedCache);
+
+        _mapDownload.numMissing = missingChunks.size();
+        LOG_VERBOSE(
+            "Map download: %zu of %u chunks cached", static_cast<size_t>(numChunks) - missingChunks.size(), numChunks);
+
+        // Always reply, an empty request lets the server release the park buffer.
+        Client_Send_MAPCHUNKREQUEST(missingChunks);
+
+        if (_mapDownload.numMissing == 0)
+        {
+            auto data = std::move(_mapDownload.data);
+            _mapDownload = {};
+            CompleteMapDownload(data.data(), data.size());
+        }
+        else
+        {
+            displayNetworkProgress(STR_MULTIPLAYER_DOWNLOADING_MAP);
+        }
+    }
+
+    void NetworkBase::Client_Handle_MAPCHUNK([[maybe_unused]] Connection& connection, Packet& packet)
+    {
+        uint32_t index{};
+        uint32_t size{};
+        packet >> index >> size;
+
+        if (index >= _mapDownload.chunkPresent.size() || _mapDownload.chunkPresent[index])
+        {
+            return;
+        }
+
+        const auto offset = static_cast<size_t>(index) * _mapDownload.chunkSize;
+        const auto expectedSize = std::min<size_t>(_mapDownload.chunkSize, _mapDownload.data.size() - offset);
+        const uint8_t* chunkData = packet.Read(size);
+        if (chunkData == nullptr || size != expectedSize)
+        {
+            LOG_WARNING("Received malformed map chunk %u from server.", index);
+            Close();
+            return;
+        }
+
+        std::memcpy(_mapDownload.data.data() + offset, chunkData, size);
+        _mapDownload.chunkPresent[index] = true;
+        _mapDownload.numMissing--;
+
+        // Keep the chunk for future downloads, addressed by its content.
+        _mapChunkCache[GetMapChunkHash(chunkData, size)] = std::vector<uint8_t>(chunkData, chunkData + size);
+
+        const auto numChunks = _mapDownload.chunkPresent.size();
+        GetContext().SetProgress(
+            static_cast<uint32_t>(numChunks - _mapDownload.numMissing), static_cast<uint32_t>(numChunks));
+
+        if (_mapDownload.numMissing == 0)
+        {
+            auto data = std::move(_mapDownload.data);
+            _mapDownload = {};
+            CompleteMapDownload(data.data(), data.size());
+        }
+    }
+
+    void NetworkBase::CompleteMapDownload(const uint8_t* data, size_t size)
     {
         // Allow queue processing of game actions again.
         GameActions::ResumeQueue();
@@ -2799,7 +3019,7 @@ namespace OpenRCT2::Network
         GameUnloadScripts();
         GameNotifyMapChange();
 
-        auto ms = MemoryStream(packet.Data.data(), packet.Data.size());
+        auto ms = MemoryStream(data, size);
         if (LoadMap(&ms))
         {
             GameLoadInit();
@@ -2941,23 +3161,54 @@ namespace OpenRCT2::Network
             {
                 return;
             }
-        }
 
-        std::string text(szText);
-        if (connection.player != nullptr)
-        {
-            if (!ProcessChatMessagePluginHooks(connection.player->Id, text))
+            // Drop spam before copying the message out of the packet.
+            if (!connection.player->SpendChatBudget(Platform::GetTicks()))
+            {
+                return;
+            }
+            if (_chatMessageQueue.size() >= kMaxQueuedChatMessages)
             {
-                // Message not to be relayed
                 return;
             }
+
+            // Plugin hooks, formatting and relaying happen in ProcessChatQueue.
+            _chatMessageQueue.push_back({ connection.player->Id, std::string(szText) });
+            return;
         }
 
-        const char* formatted = FormatChat(connection.player, text.c_str());
+        const char* formatted = FormatChat(connection.player, std::string(szText).c_str());
         ChatAddHistory(formatted);
         ServerSendChat(formatted);
     }
 
+    void NetworkBase::ProcessChatQueue()
+    {
+        // Relay a bounded number of messages per tick so chat bursts cannot stall the game loop.
+        for (size_t processed = 0; processed < kMaxChatMessagesPerTick && !_chatMessageQueue.empty(); processed++)
+        {
+            auto message = std::move(_chatMessageQueue.front());
+            _chatMessageQueue.pop_front();
+
+            auto* player = GetPlayerByID(message.playerId);
+            if (player == nullptr)
+            {
+                // Sender disconnected before the message was relayed.
+                continue;
+            }
+
+            if (!ProcessChatMessagePluginHooks(message.playerId, message.message))
+            {
+                // Message not to be relayed
+                continue;
+            }
+
+            const char* formatted = FormatChat(player, message.message.c_str());
+            ChatAddHistory(formatted);
+            ServerSendChat(formatted);
+        }
+    }
+
     void NetworkBase::Client_Handle_GAME_ACTION([[maybe_unused]] Connection& connection, Packet& packet)
     {
         uint32_t tick;
@@ -3087,14 +3338,9 @@ namespace OpenRCT2::Network
             }
         }
 
-        // Don't let the history grow too much.
-        while (_serverTickData.size() >= 100)
-        {
-            _serverTickData.erase(_serverTickData.begin());
-        }
-
         _serverState.tick = serverTick;
-        _serverTickData.emplace(serverTick, tickData);
+        // The ring evicts the oldest entry once full, so the history cannot grow.
+        _serverTickData.push_back(std::move(tickData));
     }
 
     void NetworkBase::Client_Handle_PLAYERINFO([[maybe_unused]] Connection& connection, Packet& packet)
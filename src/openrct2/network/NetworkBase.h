@@ -2,6 +2,7 @@
 
 #include "../System.hpp"
 #include "../actions/GameAction.h"
+#include "../core/CircularBuffer.h"
 #include "../scenario/Scenario.h"
 #include "NetworkConnection.h"
 #include "NetworkGroup.h"
@@ -11,6 +12,7 @@
 #include "NetworkUser.h"
 
 #include <chrono>
+#include <deque>
 #include <fstream>
 #include <list>
 #include <memory>
@@ -115,11 +117,13 @@ namespace OpenRCT2::Network
         void ServerHandleAuth(Connection& connection, Packet& packet);
         void ServerClientJoined(std::string_view name, const std::string& keyhash, Connection& connection);
         void ServerHandleChat(Connection& connection, Packet& packet);
+        void ProcessChatQueue();
         void ServerHandleGameAction(Connection& connection, Packet& packet);
         void ServerHandlePing(Connection& connection, Packet& packet);
         void ServerHandleGameInfo(Connection& connection, Packet& packet);
         void ServerHandleToken(Connection& connection, Packet& packet);
         void ServerHandleMapRequest(Connection& connection, Packet& packet);
+        void ServerHandleMapChunkRequest(Connection& connection, Packet& packet);
 
     public: // Client
         void Reconnect();
@@ -152,12 +156,16 @@ namespace OpenRCT2::Network
         void Client_Send_PING();
         void Client_Send_GAMEINFO();
         void Client_Send_MAPREQUEST(const std::vector<ObjectEntryDescriptor>& objects);
+        void Client_Send_MAPCHUNKREQUEST(const std::vector<uint32_t>& chunkIndices);
         void Client_Send_HEARTBEAT(Connection& connection) const;
 
         // Handlers.
         void Client_Handle_AUTH(Connection& connection, Packet& packet);
         void Client_Handle_BEGINMAP([[maybe_unused]] Connection& connection, Packet& packet);
         void Client_Handle_MAP(Connection& connection, Packet& packet);
+        void Client_Handle_MAPHASHES(Connection& connection, Packet& packet);
+        void Client_Handle_MAPCHUNK(Connection& connection, Packet& packet);
+        void CompleteMapDownload(const uint8_t* data, size_t size);
         void Client_Handle_CHAT(Connection& connection, Packet& packet);
         void Client_Handle_GAME_ACTION(Connection& connection, Packet& packet);
         void Client_Handle_TICK(Connection& connection, Packet& packet);
@@ -194,6 +202,9 @@ namespace OpenRCT2::Network
         using CommandHandler = void (NetworkBase::*)(Connection& connection, Packet& packet);
 
         std::ofstream _chat_log_fs;
+        // Reused for serialising outgoing game actions so busy ticks do not
+        // allocate a fresh MemoryStream per action.
+        MemoryStream _actionSerialiseBuffer;
         uint32_t _lastUpdateTime = 0;
         uint32_t _currentDeltaTime = 0;
         Mode mode = Mode::none;
@@ -202,6 +213,12 @@ namespace OpenRCT2::Network
         bool _requireClose = false;
 
     private: // Server Data
+        struct QueuedChatMessage
+        {
+            uint8_t playerId;
+            std::string message;
+        };
+
         std::unordered_map<Command, CommandHandler> server_command_handlers;
         std::unique_ptr<ITcpSocket> _listenSocket;
         std::unique_ptr<INetworkServerAdvertiser> _advertiser;
@@ -211,6 +228,15 @@ namespace OpenRCT2::Network
         std::ofstream _server_log_fs;
         uint16_t listening_port = 0;
         bool _playerListInvalidated = false;
+        // Serialised park stream reused across join bursts within a tick, so
+        // many spectators joining at once trigger a single park export.
+        std::vector<uint8_t> _cachedMapContent;
+        std::vector<const ObjectRepositoryItem*> _cachedMapObjects;
+        uint32_t _cachedMapTick = 0;
+        bool _cachedMapValid = false;
+        // Accepted chat messages waiting for plugin hooks, formatting and relay,
+        // drained a bounded amount per tick by ProcessChatQueue.
+        std::deque<QueuedChatMessage> _chatMessageQueue;
 
     private: // Client Data
         struct PlayerListUpdate
@@ -225,11 +251,28 @@ namespace OpenRCT2::Network
             std::string spriteHash;
         };
 
+        // Server ticks arrive and are verified in order, so the checksum
+        // history is a fixed-capacity ring rather than a tick-keyed map; the
+        // oldest entry is dropped once the ring is full.
+        static constexpr size_t kServerTickDataHistorySize = 100;
+
+        struct MapDownload
+        {
+            std::vector<uint8_t> data;
+            std::vector<bool> chunkPresent;
+            uint32_t chunkSize = 0;
+            size_t numMissing = 0;
+        };
+
         std::unordered_map<Command, CommandHandler> client_command_handlers;
         std::unique_ptr<Connection> _serverConnection;
         std::map<uint32_t, PlayerListUpdate> _pendingPlayerLists;
         std::multimap<uint32_t, Player> _pendingPlayerInfo;
-        std::map<uint32_t, ServerTickData> _serverTickData;
+        MapDownload _mapDownload;
+        // Content addressed chunks from earlier downloads; lets reconnecting
+        // clients skip chunks of the park stream that have not changed.
+        std::unordered_map<uint64_t, std::vector<uint8_t>> _mapChunkCache;
+        CircularBuffer<ServerTickData, kServerTickDataHistorySize> _serverTickData;
         std::string _host;
         std::string _chatLogPath;
         std::string _chatLogFilenameFormat = "%Y%m%d-%H%M%S.txt";
@@ -28,6 +28,10 @@ namespace OpenRCT2::Network
     static constexpr size_t kBufferSize = 1024 * 128; // 128 KiB.
     static constexpr size_t kNoDataTimeout = 40;      // Seconds.
 
+    // Amount of consumed bytes a buffer may accumulate at its front before the
+    // prefix is trimmed in one go.
+    static constexpr size_t kBufferCompactThreshold = 1024 * 16; // 16 KiB.
+
     Connection::Connection() noexcept
     {
         _lastReceiveTime = Platform::GetTicks();
@@ -63,18 +67,35 @@ namespace OpenRCT2::Network
         }
     }
 
+    void Connection::CompactBuffer(std::vector<uint8_t>& buffer, size_t& consumed)
+    {
+        if (consumed == buffer.size())
+        {
+            buffer.clear();
+            consumed = 0;
+        }
+        else if (consumed >= kBufferCompactThreshold)
+        {
+            buffer.erase(buffer.begin(), buffer.begin() + consumed);
+            consumed = 0;
+        }
+    }
+
     ReadPacket Connection::readPacket()
     {
+        const uint8_t* inboundData = _inboundBuffer.data() + _inboundConsumed;
+        const size_t inboundSize = _inboundBuffer.size() - _inboundConsumed;
+
         uint32_t magic = 0;
 
         // Check if we have enough data for the magic.
-        if (_inboundBuffer.size() < sizeof(magic))
+        if (inboundSize < sizeof(magic))
         {
             return ReadPacket::moreData;
         }
 
         // Read magic.
-        std::memcpy(&magic, _inboundBuffer.data(), sizeof(magic));
+        std::memcpy(&magic, inboundData, sizeof(magic));
 
         size_t totalPacketLength = 0;
         size_t headerSize = 0;
@@ -84,7 +105,7 @@ namespace OpenRCT2::Network
         {
             // New format.
             auto& header = InboundPacket.Header;
-            std::memcpy(&header, _inboundBuffer.data(), sizeof(header));
+            std::memcpy(&header, inboundData, sizeof(header));
 
             header.magic = magic;
             header.version = Convert::NetworkToHost(header.version);
@@ -98,7 +119,7 @@ namespace OpenRCT2::Network
         {
             // Legacy format.
             PacketLegacyHeader header{};
-            std::memcpy(&header, _inboundBuffer.data(), sizeof(header));
+            std::memcpy(&header, inboundData, sizeof(header));
 
             // Normalise values.
             header.Size = Convert::NetworkToHost(header.Size);
@@ -131,18 +152,24 @@ namespace OpenRCT2::Network
             _isLegacyProtocol = true;
         }
 
-        if (_inboundBuffer.size() < totalPacketLength)
+        if (inboundSize < totalPacketLength)
         {
-            InboundPacket.BytesTransferred = _inboundBuffer.size();
+            InboundPacket.BytesTransferred = inboundSize;
             return ReadPacket::moreData;
         }
 
-        // Read packet body.
+        // Read packet body. This single memcpy into the packet's own buffer is
+        // deliberate rather than a zero-copy view: handlers are free to queue
+        // packets (game commands wait for their tick) while the inbound buffer
+        // is compacted and refilled underneath, so a view would dangle. Field
+        // decoding cannot be layout-cast either, as most packet bodies are
+        // variable-length (strings, chunked maps, json) and must be walked.
         InboundPacket.BytesTransferred = totalPacketLength;
-        InboundPacket.Write(_inboundBuffer.data() + headerSize, totalPacketLength - headerSize);
+        InboundPacket.Write(inboundData + headerSize, totalPacketLength - headerSize);
 
-        // Remove read data from buffer.
-        _inboundBuffer.erase(_inboundBuffer.begin(), _inboundBuffer.begin() + totalPacketLength);
+        // Mark read data as consumed.
+        _inboundConsumed += totalPacketLength;
+        CompactBuffer(_inboundBuffer, _inboundConsumed);
 
         RecordPacketStats(InboundPacket, false);
 
@@ -193,7 +220,9 @@ namespace OpenRCT2::Network
             const auto payload = serializePacket(_isLegacyProtocol, packet);
             if (front)
             {
-                _outboundBuffer.insert(_outboundBuffer.begin(), payload.begin(), payload.end());
+                // Insert at the front of the unsent data, never inside a
+                // partially sent packet.
+                _outboundBuffer.insert(_outboundBuffer.begin() + _outboundConsumed, payload.begin(), payload.end());
             }
             else
             {
@@ -216,16 +245,18 @@ namespace OpenRCT2::Network
 
     void Connection::SendQueuedData()
     {
-        if (_outboundBuffer.empty())
+        const auto pending = _outboundBuffer.size() - _outboundConsumed;
+        if (pending == 0)
         {
             return;
         }
 
-        const auto bytesSent = Socket->SendData(_outboundBuffer.data(), _outboundBuffer.size());
+        const auto bytesSent = Socket->SendData(_outboundBuffer.data() + _outboundConsumed, pending);
 
         if (bytesSent > 0)
         {
-            _outboundBuffer.erase(_outboundBuffer.begin(), _outboundBuffer.begin() + bytesSent);
+            _outboundConsumed += static_cast<size_t>(bytesSent);
+            CompactBuffer(_outboundBuffer, _outboundConsumed);
         }
     }
 
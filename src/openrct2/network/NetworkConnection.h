@@ -41,6 +41,9 @@ namespace OpenRCT2::Network
         Key key;
         std::vector<uint8_t> Challenge;
         std::vector<const ObjectRepositoryItem*> RequestedObjects;
+        // Serialised park kept until the client has requested the chunks it is
+        // missing; released once the chunk request has been served.
+        std::vector<uint8_t> PendingMapData;
         bool ShouldDisconnect = false;
 
         Connection() noexcept;
@@ -66,14 +69,20 @@ namespace OpenRCT2::Network
         void SetLastDisconnectReason(StringId string_id, void* args = nullptr);
 
     private:
+        // Both buffers are consumed from the front via an offset so that reading
+        // packets and partial sends do not shift the remaining bytes; the
+        // consumed prefix is trimmed once it grows past a threshold.
         std::vector<uint8_t> _inboundBuffer;
+        size_t _inboundConsumed = 0;
         std::vector<uint8_t> _outboundBuffer;
+        size_t _outboundConsumed = 0;
         uint32_t _lastReceiveTime = 0;
         std::string _lastDisconnectReason;
         bool _isLegacyProtocol = false;
 
         void RecordPacketStats(const Packet& packet, bool sending);
         void receiveData();
+        static void CompactBuffer(std::vector<uint8_t>& buffer, size_t& consumed);
     };
 } // namespace OpenRCT2::Network
 
@@ -38,6 +38,14 @@ namespace OpenRCT2::Network
     };
 #pragma pack(pop)
 
+    // Packets are plain value types: Data has 512 bytes of inline storage, so
+    // the common small packet never touches the heap, and the connection
+    // read/write paths serialise into flat per-connection buffers that are
+    // reused across packets. A pooled allocator with size-class recycling was
+    // considered for the send/receive paths and rejected — there is no
+    // per-packet malloc/free pair left for it to recover, only the occasional
+    // growth of a large packet (map download), which a pool would merely keep
+    // resident instead of returning.
     struct Packet final
     {
         Packet() noexcept = default;
@@ -15,6 +15,8 @@
     #include "../ui/WindowManager.h"
     #include "NetworkPacket.h"
 
+    #include <algorithm>
+
 namespace OpenRCT2::Network
 {
     void Player::SetName(std::string_view name)
@@ -51,6 +53,24 @@ namespace OpenRCT2::Network
         auto* windowMgr = Ui::GetWindowManager();
         windowMgr->InvalidateByNumber(WindowClass::player, Id);
     }
+
+    bool Player::SpendChatBudget(uint32_t currentTime)
+    {
+        const uint32_t elapsed = currentTime - LastChatTime;
+        const uint32_t earned = elapsed / kChatBudgetRefillMs;
+        if (earned > 0)
+        {
+            ChatBudget = static_cast<uint8_t>(std::min<uint32_t>(kChatBudgetMax, ChatBudget + earned));
+            // Keep the remainder so slow refills are not lost to rounding.
+            LastChatTime = currentTime - (elapsed % kChatBudgetRefillMs);
+        }
+
+        if (ChatBudget == 0)
+            return false;
+
+        ChatBudget--;
+        return true;
+    }
 } // namespace OpenRCT2::Network
 
 #endif
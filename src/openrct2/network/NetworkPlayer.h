@@ -23,6 +23,11 @@ namespace OpenRCT2::Network
 {
     struct Packet;
 
+    // Chat messages are paid for from a small token budget which refills over time,
+    // so a burst is allowed but sustained spam is dropped before it is parsed.
+    constexpr uint8_t kChatBudgetMax = 5;
+    constexpr uint32_t kChatBudgetRefillMs = 1000;
+
     class Player final
     {
     public:
@@ -42,6 +47,8 @@ namespace OpenRCT2::Network
         uint32_t LastDemolishRideTime = 0;
         uint32_t LastPlaceSceneryTime = 0;
         std::unordered_map<GameCommand, int32_t> CooldownTime;
+        uint32_t LastChatTime = 0;
+        uint8_t ChatBudget = kChatBudgetMax;
         Player() noexcept = default;
 
         void SetName(std::string_view name);
@@ -50,5 +57,6 @@ namespace OpenRCT2::Network
         void Write(Packet& packet);
         void IncrementNumCommands();
         void AddMoneySpent(money64 cost);
+        bool SpendChatBudget(uint32_t currentTime);
     };
 } // namespace OpenRCT2::Network
@@ -86,6 +86,9 @@ namespace OpenRCT2::Network
         scriptsData,
         heartbeat,
         beginMap,
+        mapHashes,
+        mapChunkRequest,
+        mapChunk,
         max,
         invalid = static_cast<uint32_t>(-1),
     };
@@ -511,6 +511,15 @@ namespace OpenRCT2::Network
             }
         }
 
+        // Resolution and connect run on a worker thread and the main loop
+        // only polls _status, so a join in progress never blocks the UI. The
+        // one wait left is teardown (destructor/Disconnect joining the
+        // worker), which getaddrinfo can hold up on a slow resolver — an
+        // in-loop state machine cannot remove that, because getaddrinfo has
+        // no portable non-blocking or cancellable form on the platforms we
+        // build for. Racing A/AAAA happy-eyeballs style was also considered
+        // and dropped: this path runs once per join against one server
+        // address and the 3 s connect timeout already bounds the worst case.
         void ConnectAsync(const std::string& address, uint16_t port) override
         {
             if (_status != SocketStatus::closed)
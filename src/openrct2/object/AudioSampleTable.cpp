@@ -98,8 +98,9 @@ namespace OpenRCT2
             const auto& sourceEntry = table._entries[sourceStartIndex + i];
             if (sourceEntry.Asset)
             {
-                auto stream = sourceEntry.Asset->GetStream();
-                if (stream != nullptr)
+                // Availability check only; the sample itself is decoded on
+                // first use, so no stream needs to be opened here.
+                if (sourceEntry.Asset->IsAvailable())
                 {
                     auto& entry = _entries[i];
                     entry.Asset = sourceEntry.Asset;
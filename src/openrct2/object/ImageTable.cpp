@@ -421,13 +421,46 @@ namespace OpenRCT2
 
     ImageTable::~ImageTable()
     {
-        if (_data == nullptr)
+        for (size_t i = _numDataBackedEntries; i < _entries.size(); i++)
         {
-            for (auto& entry : _entries)
+            delete[] _entries[i].offset;
+        }
+    }
+
+    /**
+     * Coalesces the individually allocated entry buffers into one flat
+     * allocation, like the legacy .DAT path. Object-heavy parks otherwise keep
+     * thousands of small sprite allocations resident per image table.
+     */
+    void ImageTable::PackEntries()
+    {
+        if (_data != nullptr || _entries.empty())
+        {
+            return;
+        }
+
+        size_t totalSize = 0;
+        for (const auto& entry : _entries)
+        {
+            totalSize += G1CalculateDataSize(&entry);
+        }
+
+        auto data = std::make_unique<uint8_t[]>(totalSize);
+        size_t offset = 0;
+        for (auto& entry : _entries)
+        {
+            const auto length = G1CalculateDataSize(&entry);
+            if (length != 0)
             {
-                delete[] entry.offset;
+                std::copy_n(entry.offset, length, data.get() + offset);
             }
+            delete[] entry.offset;
+            entry.offset = length != 0 ? data.get() + offset : nullptr;
+            offset += length;
         }
+
+        _data = std::move(data);
+        _numDataBackedEntries = _entries.size();
     }
 
     void ImageTable::Read(IReadObjectContext* context, IStream* stream)
@@ -491,6 +524,7 @@ namespace OpenRCT2
 
             _data = std::move(data);
             _entries.insert(_entries.end(), newEntries.begin(), newEntries.end());
+            _numDataBackedEntries = _entries.size();
         }
         catch (const std::exception&)
         {
@@ -621,6 +655,7 @@ namespace OpenRCT2
                     }
                 }
             }
+            PackEntries();
         }
 
         _objDataCache.clear();
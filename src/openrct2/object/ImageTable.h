@@ -27,6 +27,11 @@ namespace OpenRCT2
     private:
         std::unique_ptr<uint8_t[]> _data;
         std::vector<G1Element> _entries;
+        // Number of leading entries whose pixel data lives in _data; entries
+        // after that own their offset allocation individually.
+        size_t _numDataBackedEntries = 0;
+
+        void PackEntries();
 
         /**
          * Container for a G1 image, additional information and RAII. Used by ReadJson
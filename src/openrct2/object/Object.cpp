@@ -313,6 +313,50 @@ namespace OpenRCT2
         return !(*this == rhs);
     }
 
+    // Opening a zip archive parses the whole central directory, and assets
+    // inside the same archive (e.g. an asset pack's samples) are typically
+    // accessed in bursts. Keep a small per-thread cache of open handles so
+    // each access does not reopen the archive. A cached handle is only
+    // reused while the file's modified time is unchanged, so an edited
+    // archive (object hot reloading) is reopened rather than served from the
+    // pre-edit central directory. Streams handed out by GetStream may cross
+    // threads and therefore always get their own handle.
+    static std::shared_ptr<IZipArchive> GetCachedZipArchive(const std::string& zipPath)
+    {
+        constexpr size_t kMaxCachedZipArchives = 8;
+        struct CachedZipArchive
+        {
+            std::string Path;
+            uint64_t LastModified;
+            std::shared_ptr<IZipArchive> Archive;
+        };
+        thread_local std::vector<CachedZipArchive> cache;
+
+        auto it = std::find_if(cache.begin(), cache.end(), [&](const auto& entry) { return entry.Path == zipPath; });
+        if (it != cache.end())
+        {
+            if (it->LastModified == File::GetLastModified(zipPath))
+            {
+                // Move to front (most recently used)
+                std::rotate(cache.begin(), it, it + 1);
+                return cache.front().Archive;
+            }
+            // The file changed since the handle was opened.
+            cache.erase(it);
+        }
+
+        std::shared_ptr<IZipArchive> archive = Zip::TryOpen(zipPath, ZipAccess::read);
+        if (archive != nullptr)
+        {
+            if (cache.size() >= kMaxCachedZipArchives)
+            {
+                cache.pop_back();
+            }
+            cache.insert(cache.begin(), { zipPath, File::GetLastModified(zipPath), archive });
+        }
+        return archive;
+    }
+
     bool ObjectAsset::IsAvailable() const
     {
         if (_zipPath.empty())
@@ -320,7 +364,7 @@ namespace OpenRCT2
             return File::Exists(_path);
         }
 
-        auto zipArchive = Zip::TryOpen(_zipPath, ZipAccess::read);
+        auto zipArchive = GetCachedZipArchive(_zipPath);
         return zipArchive != nullptr && zipArchive->Exists(_path);
     }
 
@@ -331,7 +375,7 @@ namespace OpenRCT2
             return File::GetSize(_path);
         }
 
-        auto zipArchive = Zip::TryOpen(_zipPath, ZipAccess::read);
+        auto zipArchive = GetCachedZipArchive(_zipPath);
         if (zipArchive != nullptr)
         {
             auto index = zipArchive->GetIndexFromPath(_path);
@@ -351,7 +395,7 @@ namespace OpenRCT2
             return File::ReadAllBytes(_path);
         }
 
-        auto zipArchive = Zip::TryOpen(_zipPath, ZipAccess::read);
+        auto zipArchive = GetCachedZipArchive(_zipPath);
         if (zipArchive != nullptr)
         {
             return zipArchive->GetFileData(_path);
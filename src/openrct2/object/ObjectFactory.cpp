@@ -527,6 +527,14 @@ namespace OpenRCT2::ObjectFactory
         return env.IsUsingClassic();
     }
 
+    // Objects are decoded from a DOM on purpose, not via a SAX-style
+    // schema decoder filling the structs directly. Every object type's
+    // ReadJson leans on shared DOM helpers (string tables, image tables,
+    // default-value lookups, objects embedded in .parkobj archives), and the
+    // zip extraction plus image decoding dominate load time rather than the
+    // parse; per-type streaming decoders would duplicate that shared logic
+    // for each hot type while the object load already runs parallel on the
+    // job pool.
     std::unique_ptr<Object> CreateObjectFromJson(
         json_t& jRoot, const IFileDataRetriever* fileRetriever, bool loadImageTable, const std::string_view path)
     {
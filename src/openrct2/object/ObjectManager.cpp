@@ -17,6 +17,7 @@
 #include "../core/EnumUtils.hpp"
 #include "../core/JobPool.h"
 #include "../core/Memory.hpp"
+#include "../drawing/Drawing.h"
 #include "../localisation/StringIds.h"
 #include "../ride/Ride.h"
 #include "../ride/RideAudio.h"
@@ -39,6 +40,7 @@
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace OpenRCT2
@@ -66,6 +68,13 @@ namespace OpenRCT2
         // Used to return a safe empty vector back from GetAllRideEntries, can be removed when std::span is available
         std::vector<ObjectEntryIndex> _nullRideTypeEntries;
 
+        // Objects that have been parsed from disk ahead of time (e.g. while the title
+        // scene idles) but are not yet registered or loaded. LoadObjects consumes
+        // these instead of reading the same files again. Guarded by _prefetchMutex
+        // since prefetching runs on a background thread.
+        std::mutex _prefetchMutex;
+        std::unordered_map<const ObjectRepositoryItem*, std::unique_ptr<Object>> _prefetchedObjects;
+
     public:
         explicit ObjectManager(IObjectRepository& objectRepository)
             : _objectRepository(objectRepository)
@@ -207,6 +216,50 @@ namespace OpenRCT2
             return RepositoryItemToObject(&ori);
         }
 
+        bool ReloadObject(const ObjectRepositoryItem& ori) override
+        {
+            auto* oldObject = ori.LoadedObject.get();
+            if (oldObject == nullptr)
+            {
+                // Not loaded into the current park, the refreshed repository
+                // item is all that is needed.
+                return false;
+            }
+
+            // Remember every slot the object occupies so references to its
+            // ObjectEntryIndex stay valid across the swap.
+            auto& list = GetObjectList(ori.Type);
+            std::vector<ObjectEntryIndex> slots;
+            for (size_t i = 0; i < list.size(); i++)
+            {
+                if (list[i] == oldObject)
+                {
+                    slots.push_back(static_cast<ObjectEntryIndex>(i));
+                }
+            }
+
+            UnloadObject(oldObject);
+
+            auto* newObject = GetOrLoadObject(&ori);
+            if (newObject == nullptr)
+            {
+                LOG_ERROR("Unable to reload object: '%s'", ori.Path.c_str());
+                return false;
+            }
+            for (auto slot : slots)
+            {
+                if (list.size() <= slot)
+                {
+                    list.resize(slot + 1);
+                }
+                list[slot] = newObject;
+            }
+            UpdateSceneryGroupIndexes();
+            ResetTypeToRideEntryIndexMap();
+            GfxInvalidateScreen();
+            return true;
+        }
+
         void LoadObjects(const ObjectList& objectList, const bool reportProgress) override
         {
             // Find all the required objects
@@ -220,6 +273,42 @@ namespace OpenRCT2
             ResetTypeToRideEntryIndexMap();
         }
 
+        void PrefetchObjects(const ObjectList& objectList) override
+        {
+            for (auto objectType : getAllObjectTypes())
+            {
+                for (const auto& entry : objectList.GetList(objectType))
+                {
+                    if (!entry.HasValue())
+                    {
+                        continue;
+                    }
+
+                    const auto* ori = _objectRepository.FindObject(entry);
+                    if (ori == nullptr || ori->LoadedObject != nullptr)
+                    {
+                        continue;
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> guard(_prefetchMutex);
+                        if (_prefetchedObjects.find(ori) != _prefetchedObjects.end())
+                        {
+                            continue;
+                        }
+                    }
+
+                    // Parse outside of the lock, this is the expensive part.
+                    auto object = _objectRepository.LoadObject(ori);
+                    if (object != nullptr)
+                    {
+                        std::lock_guard<std::mutex> guard(_prefetchMutex);
+                        _prefetchedObjects.try_emplace(ori, std::move(object));
+                    }
+                }
+            }
+        }
+
         void UnloadObjects(const std::vector<ObjectEntryDescriptor>& entries) override
         {
             // TODO there are two performance issues here:
@@ -592,6 +681,19 @@ namespace OpenRCT2
             GetContext()->SetProgress(static_cast<uint32_t>(currentProgress), 100, STR_STRING_M_PERCENT);
         }
 
+        std::unique_ptr<Object> TakePrefetchedObject(const ObjectRepositoryItem* ori)
+        {
+            std::lock_guard<std::mutex> guard(_prefetchMutex);
+            auto it = _prefetchedObjects.find(ori);
+            if (it == _prefetchedObjects.end())
+            {
+                return nullptr;
+            }
+            auto object = std::move(it->second);
+            _prefetchedObjects.erase(it);
+            return object;
+        }
+
         void LoadObjects(std::vector<ObjectToLoad>& requiredObjects, bool reportProgress)
         {
             std::vector<Object*> objects;
@@ -626,7 +728,12 @@ namespace OpenRCT2
             auto loadSingleObject = [&](const ObjectRepositoryItem* requiredObject) {
                 // Object requires to be loaded, if the object successfully loads it will register it
                 // as a loaded object otherwise placed into the badObjects list.
-                auto newObject = _objectRepository.LoadObject(requiredObject);
+                // A prefetched copy takes precedence over reading the file again.
+                auto newObject = TakePrefetchedObject(requiredObject);
+                if (newObject == nullptr)
+                {
+                    newObject = _objectRepository.LoadObject(requiredObject);
+                }
 
                 std::lock_guard<std::mutex> guard(commonMutex);
                 if (newObject == nullptr)
@@ -650,7 +757,10 @@ namespace OpenRCT2
                     ReportProgress(processed, numRequired);
             };
 
-            // Dispatch loading the objects
+            // Dispatch loading the objects. There is no dependency ordering to
+            // respect here: scenery group members are resolved by entry index in
+            // UpdateSceneryGroupIndexes once every object has been registered, so
+            // each parse/decode task is fully independent.
             JobPool jobs{};
             for (auto* object : objectsToLoad)
             {
@@ -51,7 +51,9 @@ namespace OpenRCT2
         virtual Object* LoadObject(const ObjectEntryDescriptor& descriptor) = 0;
         virtual Object* LoadObject(const ObjectEntryDescriptor& descriptor, ObjectEntryIndex slot) = 0;
         virtual Object* LoadRepositoryItem(const ObjectRepositoryItem& ori) = 0;
+        virtual bool ReloadObject(const ObjectRepositoryItem& ori) = 0;
         virtual void LoadObjects(const ObjectList& entries, bool reportProgress = false) = 0;
+        virtual void PrefetchObjects(const ObjectList& entries) = 0;
         virtual void UnloadObjects(const std::vector<ObjectEntryDescriptor>& entries) = 0;
         virtual void UnloadAllTransient() = 0;
         virtual void UnloadAll() = 0;
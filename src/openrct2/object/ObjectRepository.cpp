@@ -18,6 +18,7 @@
 #include "../core/EnumUtils.hpp"
 #include "../core/FileIndex.hpp"
 #include "../core/FileStream.h"
+#include "../core/FileWatcher.h"
 #include "../core/Guard.hpp"
 #include "../core/IStream.hpp"
 #include "../core/Memory.hpp"
@@ -25,7 +26,9 @@
 #include "../core/Numerics.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
+#include "../config/Config.h"
 #include "../localisation/LocalisationService.h"
+#include "../network/Network.h"
 #include "../object/Object.h"
 #include "../park/Legacy.h"
 #include "../platform/Platform.h"
@@ -40,7 +43,9 @@
 #include "RideObject.h"
 
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 // windows.h defines CP_UTF8
@@ -166,6 +171,14 @@ namespace OpenRCT2
         }
     };
 
+    // The repository is per-process state. Sharing it between server
+    // instances via mapped memory has been asked for, but objects and their
+    // image tables are built from std::string/std::vector heap allocations,
+    // which cannot live in a shared mapping without a custom allocator
+    // rewrite across the whole object system. Hosts running many headless
+    // servers get most of the same saving from the OS instead: identical
+    // object files are read through the page cache, and headless instances
+    // skip loading image data entirely.
     class ObjectRepository final : public IObjectRepository
     {
         IPlatformEnvironment& _env;
@@ -174,6 +187,12 @@ namespace OpenRCT2
         ObjectIdentifierMap _newItemMap;
         ObjectEntryMap _itemMap;
 
+        std::unique_ptr<FileWatcher> _fileWatcher;
+        std::mutex _changedObjectFilesMutex;
+        std::unordered_set<std::string> _changedObjectFiles;
+        bool _hotReloadingInitialised{};
+        uint32_t _lastHotReloadCheckTick{};
+
     public:
         explicit ObjectRepository(IPlatformEnvironment& env)
             : _env(env)
@@ -192,6 +211,7 @@ namespace OpenRCT2
             auto items = _fileIndex.LoadOrBuild(language);
             AddItems(items);
             SortItems();
+            SetupHotReloading();
         }
 
         void Construct(int32_t language) override
@@ -199,6 +219,7 @@ namespace OpenRCT2
             auto items = _fileIndex.Rebuild(language);
             AddItems(items);
             SortItems();
+            SetupHotReloading();
         }
 
         size_t GetNumObjects() const override
@@ -342,6 +363,31 @@ namespace OpenRCT2
             }
         }
 
+        void CheckForChangedObjects() override
+        {
+            if (!_hotReloadingInitialised)
+            {
+                return;
+            }
+            auto tick = Platform::GetTicks();
+            if (tick - _lastHotReloadCheckTick <= 1000)
+            {
+                return;
+            }
+            _lastHotReloadCheckTick = tick;
+
+            std::vector<std::string> changedFiles;
+            {
+                std::lock_guard guard(_changedObjectFilesMutex);
+                changedFiles.assign(_changedObjectFiles.begin(), _changedObjectFiles.end());
+                _changedObjectFiles.clear();
+            }
+            for (const auto& path : changedFiles)
+            {
+                ReloadChangedObject(path);
+            }
+        }
+
     private:
         void ClearItems()
         {
@@ -456,6 +502,101 @@ namespace OpenRCT2
             }
         }
 
+        // Watches the custom object directory so that object developers can
+        // iterate without restarting the game. Shares the plugin hot reload
+        // config flag and, like plugins, never runs during multiplayer.
+        void SetupHotReloading()
+        {
+            if (_hotReloadingInitialised || !Config::Get().plugin.enableHotReloading
+                || Network::GetMode() != Network::Mode::none)
+            {
+                return;
+            }
+            try
+            {
+                auto base = _env.GetDirectoryPath(DirBase::user, DirId::objects);
+                if (Path::DirectoryExists(base))
+                {
+                    _fileWatcher = std::make_unique<FileWatcher>(base);
+                    _fileWatcher->OnFileChanged = [this](u8string_view path) {
+                        std::lock_guard guard(_changedObjectFilesMutex);
+                        _changedObjectFiles.emplace(path);
+                    };
+                    _hotReloadingInitialised = true;
+                }
+            }
+            catch (const std::exception& e)
+            {
+                Console::Error::WriteLine("Unable to enable hot reloading of objects: %s", e.what());
+            }
+        }
+
+        static bool IsObjectFileName(std::string_view path)
+        {
+            auto extension = Path::GetExtension(path);
+            return String::iequals(extension, ".dat") || String::iequals(extension, ".pob")
+                || String::iequals(extension, ".json") || String::iequals(extension, ".parkobj");
+        }
+
+        // Re-scans a single changed file and hot-swaps its object into the
+        // running park. The repository item keeps its Id and the object its
+        // slots, so every ObjectEntryIndex referring to it stays valid.
+        void ReloadChangedObject(const std::string& path)
+        {
+            if (!IsObjectFileName(path))
+            {
+                return;
+            }
+
+            auto language = LocalisationService_GetCurrentLanguage();
+            auto result = _fileIndex.Create(language, path);
+            if (!result.has_value())
+            {
+                Console::Error::WriteLine("Unable to re-scan changed object: '%s'", path.c_str());
+                return;
+            }
+            auto& newItem = result.value();
+
+            const ObjectRepositoryItem* existing = nullptr;
+            if (!newItem.Identifier.empty())
+            {
+                existing = FindObject(newItem.Identifier);
+            }
+            if (existing == nullptr && !newItem.ObjectEntry.IsEmpty())
+            {
+                existing = FindObject(&newItem.ObjectEntry);
+            }
+            if (existing == nullptr)
+            {
+                if (AddItem(newItem))
+                {
+                    Console::WriteLine("New object indexed: '%s'", path.c_str());
+                }
+                return;
+            }
+
+            auto& item = _items[existing->Id];
+            if (item.Type != newItem.Type && item.LoadedObject != nullptr)
+            {
+                Console::Error::WriteLine(
+                    "Object '%s' changed type while loaded, not hot swapping.", item.Identifier.c_str());
+                return;
+            }
+
+            // Refresh the metadata in place, preserving identity and loaded state.
+            auto id = item.Id;
+            auto loadedObject = std::move(item.LoadedObject);
+            item = newItem;
+            item.Id = id;
+            item.LoadedObject = std::move(loadedObject);
+
+            auto& objectManager = GetContext()->GetObjectManager();
+            if (objectManager.ReloadObject(item))
+            {
+                Console::WriteLine("Object hot swapped: '%s'", item.Identifier.c_str());
+            }
+        }
+
         // 0x0098DA2C
         static constexpr std::array<ChunkEncoding, 11> kLegacyObjectEntryGroupEncoding = {
             ChunkEncoding::rle, ChunkEncoding::rle, ChunkEncoding::rle,    ChunkEncoding::rle,
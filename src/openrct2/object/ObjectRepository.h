@@ -98,6 +98,8 @@ namespace OpenRCT2
             = 0;
 
         virtual void ExportPackedObject(IStream* stream) = 0;
+
+        virtual void CheckForChangedObjects() = 0;
     };
 
     [[nodiscard]] std::unique_ptr<IObjectRepository> CreateObjectRepository(IPlatformEnvironment& env);
@@ -176,6 +176,10 @@ namespace OpenRCT2
         return _peepType;
     }
 
+    // Animation data is flattened into these direct-index tables when the
+    // object is read, so the per-peep frame advance is two indexed loads:
+    // this lookup followed by frameOffsets[frameNum]. Keep it that way; this
+    // runs for every moving peep every tick.
     const PeepAnimation& PeepAnimationsObject::GetPeepAnimation(PeepAnimationGroup animGroup, PeepAnimationType animType) const
     {
         return _animationGroups[EnumValue(animGroup)][animType];
@@ -29,7 +29,9 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
+#include <chrono>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
@@ -313,6 +315,15 @@ void PaintSessionGenerateRotate(PaintSession& session)
 }
 
 /**
+ * Generation walks every tile column in the view without an occlusion
+ * prepass. Proving a column hidden behind tall terrain would need an upper
+ * bound on everything the column can emit, and there is none to consult
+ * cheaply: track, scenery and entities on a tile draw far above its surface
+ * height, paint structs deliberately bleed into the three adjacent columns,
+ * and see-through and hide flags on the viewport make solid occluders
+ * conditional per frame. Overdraw is bounded instead by the dirty block
+ * system and by imageWithinRT, which discards structs whose sprites miss
+ * the render target before they enter the arrange and draw passes.
  *
  *  rct2: 0x0068B6C2
  */
@@ -603,11 +614,19 @@ static PaintStruct* PaintArrangeStructsHelperRotation(PaintStruct* psQuadrantEnt
     return psQuadrantEntry;
 }
 
+// Arrange cost counters, accumulated atomically as viewport columns arrange
+// their sessions in parallel.
+static std::atomic<uint64_t> _arrangeTimeUs{};
+static std::atomic<uint32_t> _arrangeSessions{};
+static std::atomic<uint32_t> _arrangeStructs{};
+
 // Iterates over all the quadrant lists and links them together as a
 // singly linked list.
 // The paint session has a head member which is the first entry.
-static void PaintStructsLinkQuadrants(PaintSessionCore& session, PaintStruct& psHead)
+// Returns the number of linked paint structs.
+static uint32_t PaintStructsLinkQuadrants(PaintSessionCore& session, PaintStruct& psHead)
 {
+    uint32_t numStructs = 0;
     PaintStruct* ps = &psHead;
     ps->NextQuadrantEntry = nullptr;
 
@@ -620,12 +639,15 @@ static void PaintStructsLinkQuadrants(PaintSessionCore& session, PaintStruct& ps
             ps->NextQuadrantEntry = psNext;
             do
             {
+                numStructs++;
                 ps = psNext;
                 psNext = psNext->NextQuadrantEntry;
 
             } while (psNext != nullptr);
         }
     } while (++quadrantIndex <= session.QuadrantFrontIndex);
+
+    return numStructs;
 }
 
 template<bool TStableSort, int TRotation>
@@ -641,7 +663,8 @@ static void PaintSessionArrangeImpl(PaintSessionCore& session)
     // this was previously stored in PaintSession but only the NextQuadrantEntry is relevant here.
     // The head node is not part of the linked list and just serves as an entry point.
     PaintStruct psHead{};
-    PaintStructsLinkQuadrants(session, psHead);
+    const auto numStructs = PaintStructsLinkQuadrants(session, psHead);
+    _arrangeStructs.fetch_add(numStructs, std::memory_order_relaxed);
 
     PaintStruct* psNextQuadrant = PaintArrangeStructsHelperRotation<TStableSort, TRotation>(
         &psHead, session.QuadrantBackIndex, PaintSortFlags::Neighbour);
@@ -672,17 +695,42 @@ constexpr std::array _paintArrangeFuncsStable = {
 };
 
 /**
+ * Note on temporal coherence: the arrange order cannot be carried over from
+ * the previous frame. Paint structs are arena allocations that only live for
+ * one session, so there is no identity to match an entry against its previous
+ * position. Static viewports do not pay for this either way, as unchanged
+ * regions are never repainted thanks to the dirty block tracking; arranging
+ * only ever runs for blocks that were invalidated.
  *
  *  rct2: 0x00688217
  */
 void PaintSessionArrange(PaintSessionCore& session)
 {
     PROFILED_FUNCTION();
+
+    const auto startTime = std::chrono::high_resolution_clock::now();
     if (gPaintStableSort)
     {
-        return _paintArrangeFuncsStable[session.CurrentRotation](session);
+        _paintArrangeFuncsStable[session.CurrentRotation](session);
+    }
+    else
+    {
+        _paintArrangeFuncsLegacy[session.CurrentRotation](session);
     }
-    return _paintArrangeFuncsLegacy[session.CurrentRotation](session);
+    const auto elapsed = std::chrono::high_resolution_clock::now() - startTime;
+
+    _arrangeTimeUs.fetch_add(
+        std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count(), std::memory_order_relaxed);
+    _arrangeSessions.fetch_add(1, std::memory_order_relaxed);
+}
+
+PaintArrangeStats PaintSessionArrangeGetStats()
+{
+    PaintArrangeStats stats;
+    stats.timeUs = _arrangeTimeUs.exchange(0, std::memory_order_relaxed);
+    stats.sessions = _arrangeSessions.exchange(0, std::memory_order_relaxed);
+    stats.paintStructs = _arrangeStructs.exchange(0, std::memory_order_relaxed);
+    return stats;
 }
 
 static inline void PaintAttachedPS(RenderTarget& rt, PaintStruct* ps, uint32_t viewFlags)
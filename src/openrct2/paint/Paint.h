@@ -190,7 +190,12 @@ struct PaintNodeStorage
     void clear()
     {
         fixedPaintEntries.clear();
-        dynamicPaintEntries.reset();
+        if (dynamicPaintEntries.has_value())
+        {
+            // Keep the allocated segments so heavy scenes reuse the arena
+            // across frames instead of reallocating it every frame.
+            dynamicPaintEntries->clear();
+        }
     }
 };
 
@@ -298,9 +303,19 @@ void PaintFloatingMoneyEffect(
     PaintSession& session, money64 amount, StringId string_id, int32_t y, int32_t z, int8_t y_offsets[], int32_t offset_x,
     uint32_t rotation);
 
+struct PaintArrangeStats
+{
+    uint64_t timeUs;
+    uint32_t sessions;
+    uint32_t paintStructs;
+};
+
 PaintSession* PaintSessionAlloc(OpenRCT2::Drawing::RenderTarget& rt, uint32_t viewFlags, uint8_t rotation);
 void PaintSessionFree(PaintSession* session);
 void PaintSessionGenerate(PaintSession& session);
 void PaintSessionArrange(PaintSessionCore& session);
+// Returns the totals accumulated by PaintSessionArrange since the previous call,
+// so reading once per frame yields per-frame figures.
+PaintArrangeStats PaintSessionArrangeGetStats();
 void PaintDrawStructs(PaintSession& session);
 void PaintDrawMoneyStructs(OpenRCT2::Drawing::RenderTarget& rt, PaintStringStruct* ps);
@@ -14,6 +14,7 @@
 #include "../ReplayManager.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../core/String.hpp"
 #include "../drawing/Drawing.h"
 #include "../drawing/IDrawingEngine.h"
 #include "../drawing/Text.h"
@@ -28,6 +29,9 @@
 #include "../world/MapSelection.h"
 #include "../world/TileInspector.h"
 
+#include <algorithm>
+#include <numeric>
+
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 using namespace OpenRCT2::Paint;
@@ -42,6 +46,10 @@ void Painter::Paint(IDrawingEngine& de)
 {
     PROFILED_FUNCTION();
 
+    // No sprite drawing is in progress here, so the recoloured sprite cache
+    // can be safely emptied if it outgrew its budget last frame.
+    GfxTrimRecolouredSpriteCache();
+
     auto rt = de.getRT();
 
     if (IntroIsPlaying())
@@ -81,6 +89,11 @@ void Painter::Paint(IDrawingEngine& de)
     {
         PaintFPS(*rt);
     }
+
+    if (Profiling::IsOverlayEnabled())
+    {
+        PaintProfilerOverlay(*rt);
+    }
     gCurrentDrawCount++;
 }
 
@@ -138,6 +151,56 @@ void Painter::PaintFPS(RenderTarget& rt)
     GfxSetDirtyBlocks({ { screenCoords - ScreenCoordsXY{ 16, 4 } }, { rt.lastStringPos.x + 16, screenCoords.y + 16 } });
 }
 
+/**
+ * Draws the hottest profiled functions with their recent average times in the
+ * top left corner, so production hitches can be inspected without attaching an
+ * external profiler. Toggled with the `profiler_overlay` console command.
+ */
+void Painter::PaintProfilerOverlay(RenderTarget& rt)
+{
+    constexpr size_t kMaxOverlayLines = 8;
+
+    struct OverlayEntry
+    {
+        const Profiling::Function* func;
+        double averageUs;
+    };
+    std::vector<OverlayEntry> entries;
+
+    for (const auto* func : Profiling::GetData())
+    {
+        const auto samples = func->GetTimeSamples();
+        if (samples.empty())
+            continue;
+
+        const auto total = std::accumulate(samples.begin(), samples.end(), 0.0);
+        entries.push_back({ func, total / samples.size() });
+    }
+
+    std::partial_sort(
+        entries.begin(), entries.begin() + std::min(kMaxOverlayLines, entries.size()), entries.end(),
+        [](const OverlayEntry& a, const OverlayEntry& b) { return a.averageUs > b.averageUs; });
+
+    ScreenCoordsXY screenCoords(2, kTopToolbarHeight + 3);
+    int32_t maxStringWidth = 0;
+    const auto numLines = std::min(kMaxOverlayLines, entries.size());
+    for (size_t i = 0; i < numLines; i++)
+    {
+        char name[64]{};
+        String::safeUtf8Copy(name, entries[i].func->GetName(), sizeof(name));
+
+        char buffer[128]{};
+        FormatStringToBuffer(buffer, sizeof(buffer), "{OUTLINE}{WHITE}{STRING} {INT32} us", name, static_cast<int32_t>(entries[i].averageUs));
+        DrawText(rt, screenCoords, { OpenRCT2::Drawing::Colour::white }, buffer);
+
+        maxStringWidth = std::max(maxStringWidth, GfxGetStringWidth(buffer, FontStyle::medium));
+        screenCoords.y += 10;
+    }
+
+    // Make area dirty so the text doesn't get drawn over the last
+    GfxSetDirtyBlocks({ { 0, kTopToolbarHeight }, { maxStringWidth + 4, screenCoords.y + 10 } });
+}
+
 void Painter::MeasureFPS()
 {
     _frames++;
@@ -169,6 +232,7 @@ PaintSession* Painter::CreateSession(RenderTarget& rt, uint32_t viewFlags, uint8
     {
         // Create new one in pool.
         session = &_paintSessionPool.emplace_back();
+        std::fill(std::begin(session->Quadrants), std::end(session->Quadrants), nullptr);
     }
 
     session->rt = rt;
@@ -178,7 +242,6 @@ PaintSession* Painter::CreateSession(RenderTarget& rt, uint32_t viewFlags, uint8
     session->Flags = 0;
     session->CurrentRotation = rotation;
 
-    std::fill(std::begin(session->Quadrants), std::end(session->Quadrants), nullptr);
     session->PaintHead = nullptr;
     session->LastPS = nullptr;
     session->LastAttachedPS = nullptr;
@@ -200,6 +263,15 @@ void Painter::ReleaseSession(PaintSession* session)
 {
     PROFILED_FUNCTION();
 
+    // Reset only the quadrant range the session actually used so reuse does
+    // not have to clear the whole quadrant table again.
+    if (session->QuadrantBackIndex != std::numeric_limits<uint32_t>::max())
+    {
+        std::fill(
+            std::begin(session->Quadrants) + session->QuadrantBackIndex,
+            std::begin(session->Quadrants) + session->QuadrantFrontIndex + 1, nullptr);
+    }
+
     session->paintEntries.clear();
 
     _freePaintSessions.push_back(session);
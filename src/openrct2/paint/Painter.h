@@ -52,6 +52,7 @@ namespace OpenRCT2
         private:
             void PaintReplayNotice(Drawing::RenderTarget& rt, const char* text);
             void PaintFPS(Drawing::RenderTarget& rt);
+            void PaintProfilerOverlay(Drawing::RenderTarget& rt);
             void MeasureFPS();
         };
     } // namespace Paint
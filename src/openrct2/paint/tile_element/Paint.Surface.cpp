@@ -924,6 +924,14 @@ static void PaintSurfaceConstructionRights(
 }
 
 /**
+ * Surface tiles are painted one at a time by design. Merging adjacent
+ * same-texture tiles into wider strip draws does not work here: each blit is
+ * a masked isometric diamond from its own RLE-compressed source image, the
+ * arrange pass is free to interleave other elements between neighbouring
+ * surfaces, and slope, edge and grass-length variants make genuinely
+ * identical runs rare. Zoomed-out views get their savings from the zoom
+ * image offsets and the dirty block system instead.
+ *
  *  rct2: 0x0066062C
  */
 void PaintSurface(PaintSession& session, uint8_t direction, uint16_t height, const SurfaceElement& tileElement)
@@ -959,6 +967,14 @@ void PaintSurface(PaintSession& session, uint8_t direction, uint16_t height, con
 
     TileDescriptor tileDescriptors[4];
 
+    // The four neighbour fetches stay as individual MapGetSurfaceElementAt
+    // calls rather than reading a whole row of surfaces into a buffer up
+    // front. The tile index is a flat pointer array, so a fetch is one index
+    // plus typically one element step — there is no hash lookup to amortise —
+    // and the paint pass visits tiles in isometric diagonal order within
+    // per-column paint sessions, not in map rows, so a row buffer would not
+    // match the traversal and would fetch tiles the viewport never paints.
+    // Decoding slope and corner heights below dominates the fetch itself.
     for (std::size_t i = 0; i < std::size(viewport_surface_paint_data); i++)
     {
         const CoordsXY& offset = viewport_surface_paint_data[i][rotation];
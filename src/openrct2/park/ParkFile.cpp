@@ -67,6 +67,7 @@
 #include <cassert>
 #include <cstdint>
 #include <ctime>
+#include <future>
 #include <numeric>
 #include <optional>
 #include <string_view>
@@ -153,6 +154,22 @@ namespace OpenRCT2
             }
         }
 
+        /**
+         * Loads only the scenario and preview chunks. Files written since the
+         * metadata chunks moved to the front of the stream decompress only a
+         * small prefix instead of the whole park.
+         */
+        void LoadMetadata(const std::string_view path)
+        {
+            static constexpr uint32_t kMetadataChunks[] = { ParkFileChunkType::SCENARIO, ParkFileChunkType::PREVIEW };
+
+            FileStream fs(path, FileMode::open);
+            _os = std::make_unique<OrcaStream>(fs, OrcaStream::Mode::reading, Compression::kNoCompressionLevel, kMetadataChunks);
+            ThrowIfIncompatibleVersion();
+
+            RequiredObjects = {};
+        }
+
         void Import(GameState_t& gameState)
         {
             auto& os = *_os;
@@ -179,22 +196,25 @@ namespace OpenRCT2
             gameState.scenarioOptions.initialCash = gameState.park.cash;
         }
 
-        void Save(GameState_t& gameState, IStream& stream, int16_t compressionLevel)
+        void WriteAllChunks(GameState_t& gameState, OrcaStream& os)
         {
-            OrcaStream os(stream, OrcaStream::Mode::writing, compressionLevel);
-
             auto& header = os.getHeader();
             header.magic = kParkFileMagic;
             header.targetVersion = kParkFileCurrentVersion;
             header.minVersion = kParkFileMinVersion;
 
+            // Readers seek chunks through the chunk table, so the order below only
+            // affects how much of the stream a partial read has to decompress.
+            // Keep the small metadata chunks at the front so scenario indexing can
+            // stop before the tile and entity data.
             ReadWriteAuthoringChunk(os);
+            ReadWriteScenarioChunk(gameState, os);
+            ReadWritePreviewChunk(gameState, os);
             ReadWriteObjectsChunk(os);
             ReadWriteTilesChunk(gameState, os);
             ReadWriteBannersChunk(gameState, os);
             ReadWriteRidesChunk(gameState, os);
             ReadWriteEntitiesChunk(gameState, os);
-            ReadWriteScenarioChunk(gameState, os);
             ReadWriteGeneralChunk(gameState, os);
             ReadWriteParkChunk(gameState, os);
             ReadWriteClimateChunk(gameState, os);
@@ -204,16 +224,34 @@ namespace OpenRCT2
             ReadWriteCheatsChunk(gameState, os);
             ReadWriteRestrictedObjectsChunk(gameState, os);
             ReadWritePluginStorageChunk(gameState, os);
-            ReadWritePreviewChunk(gameState, os);
             ReadWritePackedObjectsChunk(os);
         }
 
+        void Save(GameState_t& gameState, IStream& stream, int16_t compressionLevel)
+        {
+            OrcaStream os(stream, OrcaStream::Mode::writing, compressionLevel);
+            WriteAllChunks(gameState, os);
+        }
+
         void Save(GameState_t& gameState, const std::string_view path, int16_t compressionLevel)
         {
             FileStream fs(path, FileMode::write);
             Save(gameState, fs, compressionLevel);
         }
 
+        /**
+         * Serialises the park on the calling thread but leaves compression and
+         * the disk write to the returned state, which can be finished on a
+         * background thread via OrcaStream::FinishWriting.
+         */
+        OrcaStream::WritingState SaveToState(GameState_t& gameState, int16_t compressionLevel)
+        {
+            MemoryStream unusedTarget;
+            OrcaStream os(unusedTarget, OrcaStream::Mode::writing, compressionLevel);
+            WriteAllChunks(gameState, os);
+            return os.ReleaseWritingState();
+        }
+
         ScenarioIndexEntry ReadScenarioChunk()
         {
             ScenarioIndexEntry entry{};
@@ -1264,6 +1302,15 @@ namespace OpenRCT2
                     }
                     else
                     {
+                        // The write side is deliberately one bulk copy rather
+                        // than per-sector streams serialised in parallel.
+                        // Serialising tiles is a linear memcpy into the chunk
+                        // buffer — memory bandwidth, not CPU, bound — so
+                        // splitting it across workers gains nothing, and a
+                        // concatenated-sector layout would be a format bump
+                        // that old clients cannot read. The expensive part of
+                        // a save is compression, which autosaves already
+                        // overlap with the game loop (see ScenarioSave).
                         auto tileElements = GetReorganisedTileElementsWithoutGhosts();
                         cs.write(static_cast<uint32_t>(tileElements.size()));
                         cs.write(tileElements.data(), tileElements.size() * sizeof(TileElement));
@@ -2743,6 +2790,18 @@ enum : uint32_t
     S6_SAVE_FLAG_AUTOMATIC = 1u << 31,
 };
 
+// Pending background autosave; compression and the disk write run on this
+// task while the game loop continues.
+static std::future<void> _pendingSaveJob;
+
+static void WaitForPendingSave()
+{
+    if (_pendingSaveJob.valid())
+    {
+        _pendingSaveJob.wait();
+    }
+}
+
 int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
 {
     if (flags & S6_SAVE_FLAG_SCENARIO)
@@ -2781,7 +2840,36 @@ int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
         {
             // s6exporter->SaveGame(path);
         }
-        parkFile->Save(gameState, path, gIsAutosave ? kParkFileAutoCompressionLevel : kParkFileSaveCompressionLevel);
+        // Only one background save may be in flight at a time, and a
+        // synchronous save must not interleave with one either.
+        WaitForPendingSave();
+        if (gIsAutosave)
+        {
+            // Serialise on the game thread, then compress and write on a
+            // background thread so the tick is not stalled by zstd or disk IO.
+            // The serialise pass is a single linear copy of the game state;
+            // making it incremental (e.g. copy-on-write tile pages) would
+            // require paged tile storage, which the engine cannot have while
+            // paint, pathfinding and game actions hold raw TileElement
+            // pointers into one flat array.
+            auto state = parkFile->SaveToState(gameState, kParkFileAutoCompressionLevel);
+            _pendingSaveJob = std::async(
+                std::launch::async, [state = std::move(state), savePath = u8string(path)]() mutable {
+                    try
+                    {
+                        FileStream fs(savePath, FileMode::write);
+                        OrcaStream::FinishWriting(std::move(state), fs, kParkFileAutoCompressionLevel);
+                    }
+                    catch (const std::exception& e)
+                    {
+                        LOG_ERROR("Autosave to %s failed: %s", savePath.c_str(), e.what());
+                    }
+                });
+        }
+        else
+        {
+            parkFile->Save(gameState, path, kParkFileSaveCompressionLevel);
+        }
         result = true;
     }
     catch (const std::exception& e)
@@ -2835,6 +2923,17 @@ public:
 
     ParkLoadResult LoadScenario(const u8string& path, bool skipObjectCheck = false) override
     {
+        if (skipObjectCheck)
+        {
+            // Scenario indexing only reads the metadata chunks afterwards, so
+            // avoid decompressing the tile and entity data.
+            _parkFile = std::make_unique<ParkFile>();
+            _parkFile->LoadMetadata(path);
+
+            auto result = ParkLoadResult(ObjectList());
+            result.SemiCompatibleVersion = _parkFile->IsSemiCompatibleVersion(result.MinVersion, result.TargetVersion);
+            return result;
+        }
         return Load(path, skipObjectCheck);
     }
 
@@ -28,6 +28,7 @@
 #include "../world/tile_element/PathElement.h"
 #include "../world/tile_element/TileElement.h"
 #include "../world/tile_element/TrackElement.h"
+#include "PathfindingCache.h"
 
 #include <bit>
 #include <bitset>
@@ -602,6 +603,10 @@ namespace OpenRCT2::PathFinding
 
         uint32_t edges = path->GetEdges();
 
+        auto& junctionCache = GetJunctionCache();
+        if (auto cached = junctionCache.TryGetThinJunction(loc, static_cast<uint8_t>(edges)); cached.has_value())
+            return *cached;
+
         int32_t testEdge = Numerics::bitScanForward(edges);
         if (testEdge == -1)
             return false;
@@ -628,6 +633,8 @@ namespace OpenRCT2::PathFinding
             }
             edges &= ~(1 << testEdge);
         } while ((testEdge = Numerics::bitScanForward(edges)) != -1);
+
+        junctionCache.SetThinJunction(loc, static_cast<uint8_t>(path->GetEdges()), isThinJunction);
         return isThinJunction;
     }
 
@@ -1225,6 +1232,14 @@ namespace OpenRCT2::PathFinding
     }
 
     /**
+     * Although many guests often share a goal (a new ride, the exit at park
+     * closing), their searches cannot share a per-destination distance field:
+     * the outcome depends on each guest's PathfindHistory, which bans recently
+     * tried directions at thin junctions, so two guests at the same tile with
+     * the same goal legitimately choose different directions. What is a pure
+     * function of the path network - junction classification and component
+     * connectivity - is already shared through the PathfindingCache unit.
+     *
      * Returns:
      *   -1   - no direction chosen
      *   0..3 - chosen direction
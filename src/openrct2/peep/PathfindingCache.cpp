@@ -0,0 +1,211 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "PathfindingCache.h"
+
+#include "../GameState.h"
+#include "../world/Footpath.h"
+#include "../world/Map.h"
+#include "../world/TileElementsView.h"
+#include "../world/tile_element/PathElement.h"
+
+#include <vector>
+
+namespace OpenRCT2::PathFinding
+{
+    static JunctionClassificationCache _junctionCache;
+    static FootpathConnectivityCache _connectivityCache;
+
+    JunctionClassificationCache& GetJunctionCache()
+    {
+        return _junctionCache;
+    }
+
+    FootpathConnectivityCache& GetConnectivityCache()
+    {
+        return _connectivityCache;
+    }
+
+    void InvalidatePathCaches()
+    {
+        _junctionCache.Invalidate();
+        _connectivityCache.Invalidate();
+    }
+
+    uint64_t JunctionClassificationCache::MakeKey(const TileCoordsXYZ& loc, uint8_t edges)
+    {
+        // 16 bits each for x/y and z comfortably cover the technical map limits;
+        // the edge bits distinguish overlaid path elements on the same tile.
+        return (static_cast<uint64_t>(static_cast<uint16_t>(loc.x)) << 48)
+            | (static_cast<uint64_t>(static_cast<uint16_t>(loc.y)) << 32)
+            | (static_cast<uint64_t>(static_cast<uint16_t>(loc.z)) << 16) | edges;
+    }
+
+    void JunctionClassificationCache::RevalidateForCurrentTick()
+    {
+        const auto currentTicks = getGameState().currentTicks;
+        if (_tickStamp != currentTicks)
+        {
+            _thinJunctions.clear();
+            _tickStamp = currentTicks;
+        }
+    }
+
+    std::optional<bool> JunctionClassificationCache::TryGetThinJunction(const TileCoordsXYZ& loc, uint8_t edges)
+    {
+        RevalidateForCurrentTick();
+
+        auto it = _thinJunctions.find(MakeKey(loc, edges));
+        if (it == _thinJunctions.end())
+            return std::nullopt;
+        return it->second;
+    }
+
+    void JunctionClassificationCache::SetThinJunction(const TileCoordsXYZ& loc, uint8_t edges, bool isThin)
+    {
+        RevalidateForCurrentTick();
+        _thinJunctions[MakeKey(loc, edges)] = isThin;
+    }
+
+    void JunctionClassificationCache::Invalidate()
+    {
+        _thinJunctions.clear();
+        _tickStamp = 0xFFFFFFFFu;
+    }
+
+    uint64_t FootpathConnectivityCache::MakeKey(const TileCoordsXYZ& loc)
+    {
+        // Path elements are identified by tile and base height; overlaid
+        // elements at the same height share a label, which can only merge
+        // components and therefore keeps the labelling conservative.
+        return (static_cast<uint64_t>(static_cast<uint16_t>(loc.x)) << 32)
+            | (static_cast<uint64_t>(static_cast<uint16_t>(loc.y)) << 16) | static_cast<uint16_t>(loc.z);
+    }
+
+    void FootpathConnectivityCache::RevalidateForCurrentTick()
+    {
+        const auto currentTicks = getGameState().currentTicks;
+        if (_tickStamp != currentTicks)
+        {
+            _components.clear();
+            _built = false;
+            _tickStamp = currentTicks;
+        }
+    }
+
+    void FootpathConnectivityCache::Rebuild()
+    {
+        _components.clear();
+
+        uint32_t nextComponentId = 0;
+        std::vector<TileCoordsXYZ> stack;
+        auto mapSize = getGameState().mapSize;
+        for (int32_t tileY = 0; tileY < mapSize.y; tileY++)
+        {
+            for (int32_t tileX = 0; tileX < mapSize.x; tileX++)
+            {
+                for (auto* seedElement : TileElementsView<PathElement>(TileCoordsXY{ tileX, tileY }.ToCoordsXY()))
+                {
+                    auto seedLoc = TileCoordsXYZ{ tileX, tileY, seedElement->BaseHeight };
+                    if (!_components.try_emplace(MakeKey(seedLoc), nextComponentId).second)
+                        continue;
+
+                    // Flood fill the component this element seeds, expanding
+                    // edges exactly like the heuristic search does so the
+                    // labelling never claims two searchable paths are
+                    // disconnected.
+                    stack.clear();
+                    stack.push_back(seedLoc);
+                    while (!stack.empty())
+                    {
+                        auto loc = stack.back();
+                        stack.pop_back();
+                        for (auto* pathElement : TileElementsView<PathElement>(loc.ToCoordsXY()))
+                        {
+                            if (pathElement->BaseHeight != loc.z)
+                                continue;
+
+                            const uint8_t edges = pathElement->GetEdges();
+                            for (Direction direction : kAllDirections)
+                            {
+                                if (!(edges & (1u << direction)))
+                                    continue;
+
+                                int32_t targetZ = pathElement->BaseHeight;
+                                if (pathElement->IsSloped() && pathElement->GetSlopeDirection() == direction)
+                                    targetZ += 2;
+
+                                auto targetCoords = loc.ToCoordsXY() + CoordsDirectionDelta[direction];
+                                if (!MapIsLocationValid(targetCoords))
+                                    continue;
+
+                                for (auto* nextElement : TileElementsView<PathElement>(targetCoords))
+                                {
+                                    if (!FootpathIsZAndDirectionValid(*nextElement, targetZ, direction))
+                                        continue;
+
+                                    auto nextLoc = TileCoordsXYZ{ TileCoordsXY{ targetCoords }, nextElement->BaseHeight };
+                                    if (_components.try_emplace(MakeKey(nextLoc), nextComponentId).second)
+                                        stack.push_back(nextLoc);
+                                }
+                            }
+                        }
+                    }
+                    nextComponentId++;
+                }
+            }
+        }
+        _built = true;
+    }
+
+    std::optional<uint32_t> FootpathConnectivityCache::GetComponent(const TileCoordsXYZ& loc)
+    {
+        RevalidateForCurrentTick();
+        if (!_built)
+            Rebuild();
+
+        auto it = _components.find(MakeKey(loc));
+        if (it == _components.end())
+            return std::nullopt;
+        return it->second;
+    }
+
+    std::optional<uint32_t> FootpathConnectivityCache::GetEntrancePathComponent(const TileCoordsXYZD& entranceLoc)
+    {
+        // The path serving an entrance/exit platform is on the tile the
+        // platform faces away from: a peep standing there steps onto the
+        // platform travelling in the element's direction, which is the final
+        // step the heuristic search makes when it finds the goal.
+        auto pathCoords = entranceLoc.ToCoordsXY() - CoordsDirectionDelta[entranceLoc.direction];
+        if (!MapIsLocationValid(pathCoords))
+            return std::nullopt;
+
+        for (auto* pathElement : TileElementsView<PathElement>(pathCoords))
+        {
+            if (!(pathElement->GetEdges() & (1u << entranceLoc.direction)))
+                continue;
+
+            int32_t leaveZ = pathElement->BaseHeight;
+            if (pathElement->IsSloped() && pathElement->GetSlopeDirection() == entranceLoc.direction)
+                leaveZ += 2;
+            if (leaveZ != entranceLoc.z)
+                continue;
+
+            return GetComponent(TileCoordsXYZ{ TileCoordsXY{ pathCoords }, pathElement->BaseHeight });
+        }
+        return std::nullopt;
+    }
+
+    void FootpathConnectivityCache::Invalidate()
+    {
+        _components.clear();
+        _built = false;
+        _tickStamp = 0xFFFFFFFFu;
+    }
+} // namespace OpenRCT2::PathFinding
@@ -0,0 +1,82 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../world/Location.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+namespace OpenRCT2::PathFinding
+{
+    /**
+     * Caches the footpath junction classification that the guest pathfinding
+     * search otherwise recomputes by re-walking neighbouring tile elements for
+     * every guest visiting the same junction. Classifying a junction is a pure
+     * function of the footpath network, so cached results leave search outcomes
+     * (and therefore multiplayer checksums) bit-identical.
+     *
+     * Entries are valid for the game tick they were computed in; the cache also
+     * gets invalidated explicitly when the footpath network is edited mid-tick
+     * (footpath place/remove actions), so stale classifications cannot leak
+     * into later searches.
+     */
+    class JunctionClassificationCache
+    {
+    private:
+        std::unordered_map<uint64_t, bool> _thinJunctions;
+        uint32_t _tickStamp = 0xFFFFFFFFu;
+
+        static uint64_t MakeKey(const TileCoordsXYZ& loc, uint8_t edges);
+        void RevalidateForCurrentTick();
+
+    public:
+        std::optional<bool> TryGetThinJunction(const TileCoordsXYZ& loc, uint8_t edges);
+        void SetThinJunction(const TileCoordsXYZ& loc, uint8_t edges, bool isThin);
+        void Invalidate();
+    };
+
+    JunctionClassificationCache& GetJunctionCache();
+
+    /**
+     * Labels every footpath element with the id of the connected component it
+     * belongs to, so that "can a peep standing here reach that path at all"
+     * collapses to an integer comparison before any heuristic search starts.
+     * Component ids are a pure function of the footpath network and carry no
+     * meaning beyond equality.
+     *
+     * The labelling is rebuilt lazily on first query, is valid only for the
+     * game tick it was built in and gets invalidated explicitly when the
+     * footpath network is edited mid-tick, mirroring the lifetime rules of the
+     * junction classification cache above.
+     */
+    class FootpathConnectivityCache
+    {
+    private:
+        std::unordered_map<uint64_t, uint32_t> _components;
+        bool _built = false;
+        uint32_t _tickStamp = 0xFFFFFFFFu;
+
+        static uint64_t MakeKey(const TileCoordsXYZ& loc);
+        void RevalidateForCurrentTick();
+        void Rebuild();
+
+    public:
+        std::optional<uint32_t> GetComponent(const TileCoordsXYZ& loc);
+        std::optional<uint32_t> GetEntrancePathComponent(const TileCoordsXYZD& entranceLoc);
+        void Invalidate();
+    };
+
+    FootpathConnectivityCache& GetConnectivityCache();
+
+    // Called by the footpath game actions whenever the path network changes.
+    void InvalidatePathCaches();
+} // namespace OpenRCT2::PathFinding
@@ -14,6 +14,10 @@
         #define WIN32_LEAN_AND_MEAN
     #endif
     #include <windows.h>
+
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
 #endif
 
 #if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
@@ -156,6 +160,29 @@ namespace OpenRCT2::Platform
         return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(processTime).count());
     }
 
+    uint64_t GetPeakMemoryUsage()
+    {
+#ifdef _WIN32
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            return counters.PeakWorkingSetSize;
+        }
+#else
+        rusage usage{};
+        if (getrusage(RUSAGE_SELF, &usage) == 0)
+        {
+    #ifdef __APPLE__
+            // ru_maxrss is in bytes on macOS, kilobytes elsewhere.
+            return static_cast<uint64_t>(usage.ru_maxrss);
+    #else
+            return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+    #endif
+        }
+#endif
+        return 0;
+    }
+
 #ifdef OPENRCT2_X86
     static bool CPUIDX86(uint32_t* cpuid_outdata, int32_t eax)
     {
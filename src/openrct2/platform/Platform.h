@@ -187,6 +187,10 @@ namespace OpenRCT2::Platform
     datetime64 GetDatetimeNowUTC();
     uint32_t GetTicks();
 
+    // Returns the peak resident set size of the process in bytes, or 0 if the
+    // platform cannot report it.
+    uint64_t GetPeakMemoryUsage();
+
     void Sleep(uint32_t ms);
 
     bool SSE41Available();
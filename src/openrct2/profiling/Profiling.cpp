@@ -13,11 +13,13 @@
 #include <chrono>
 #include <fstream>
 #include <iomanip>
+#include <memory>
 #include <stack>
 
 namespace OpenRCT2::Profiling
 {
     inline static bool _enabled = false;
+    inline static bool _overlayEnabled = false;
 
     void Enable()
     {
@@ -39,6 +41,56 @@ namespace OpenRCT2::Profiling
         using Clock = std::chrono::high_resolution_clock;
         using Tp = Clock::time_point;
 
+        // Timeline recording for the trace-event exporter. Each thread appends
+        // into its own buffer so recording never contends on a lock; the global
+        // list of buffers is only locked on first use per thread and on export.
+        static constexpr size_t kMaxTraceEventsPerThread = 1u << 20;
+
+        struct TraceEvent
+        {
+            const char* Name;
+            Tp Timestamp;
+            bool IsBegin;
+        };
+
+        struct TraceBuffer
+        {
+            uint32_t ThreadId;
+            std::vector<TraceEvent> Events;
+        };
+
+        static std::atomic<bool> _traceEnabled{ false };
+        static Tp _traceStartTime;
+        static std::mutex _traceBuffersMutex;
+
+        static std::vector<std::shared_ptr<TraceBuffer>>& GetTraceBuffers()
+        {
+            static std::vector<std::shared_ptr<TraceBuffer>> buffers;
+            return buffers;
+        }
+
+        static TraceBuffer& GetThreadTraceBuffer()
+        {
+            thread_local std::shared_ptr<TraceBuffer> buffer = []() {
+                auto newBuffer = std::make_shared<TraceBuffer>();
+                std::scoped_lock lock(_traceBuffersMutex);
+                auto& buffers = GetTraceBuffers();
+                newBuffer->ThreadId = static_cast<uint32_t>(buffers.size());
+                buffers.push_back(newBuffer);
+                return newBuffer;
+            }();
+            return *buffer;
+        }
+
+        static void RecordTraceEvent(const Function& func, const Tp& timestamp, bool isBegin)
+        {
+            auto& buffer = GetThreadTraceBuffer();
+            if (buffer.Events.size() >= kMaxTraceEventsPerThread)
+                return;
+
+            buffer.Events.push_back({ func.GetName(), timestamp, isBegin });
+        }
+
         struct FunctionEntry
         {
             FunctionInternal* Parent;
@@ -68,6 +120,9 @@ namespace OpenRCT2::Profiling
                 parent = _callStack.top().Func;
 
             _callStack.emplace(parent, &funcInternal, entryTime);
+
+            if (_traceEnabled)
+                RecordTraceEvent(funcInternal, entryTime, true);
         }
 
         void FunctionExit(Function& func)
@@ -111,6 +166,9 @@ namespace OpenRCT2::Profiling
                 funcData->TotalTimeUs += elapsedTimeUs;
             }
 
+            if (_traceEnabled)
+                RecordTraceEvent(*funcData, exitTime, false);
+
             _callStack.pop();
         }
 
@@ -171,4 +229,80 @@ namespace OpenRCT2::Profiling
         return true;
     }
 
+    void StartTraceRecording()
+    {
+        std::scoped_lock lock(Detail::_traceBuffersMutex);
+        for (auto& buffer : Detail::GetTraceBuffers())
+        {
+            buffer->Events.clear();
+        }
+        Detail::_traceStartTime = Detail::Clock::now();
+        Detail::_traceEnabled = true;
+    }
+
+    void StopTraceRecording()
+    {
+        Detail::_traceEnabled = false;
+    }
+
+    bool IsTraceRecording()
+    {
+        return Detail::_traceEnabled;
+    }
+
+    static void WriteJsonEscaped(std::ofstream& out, const char* text)
+    {
+        for (const char* ch = text; *ch != '\0'; ch++)
+        {
+            if (*ch == '"' || *ch == '\\')
+                out << '\\';
+            out << *ch;
+        }
+    }
+
+    bool ExportTraceEventJson(const std::string& filePath)
+    {
+        std::ofstream out(filePath);
+        if (!out.is_open())
+            return false;
+
+        out << std::setprecision(12);
+        out << "{\"traceEvents\":[";
+
+        std::scoped_lock lock(Detail::_traceBuffersMutex);
+        bool first = true;
+        for (const auto& buffer : Detail::GetTraceBuffers())
+        {
+            for (const auto& event : buffer->Events)
+            {
+                const auto tsUs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                      event.Timestamp - Detail::_traceStartTime)
+                                      .count()
+                    / 1000.0;
+
+                if (!first)
+                    out << ",";
+                first = false;
+
+                out << "\n{\"name\":\"";
+                WriteJsonEscaped(out, event.Name);
+                out << "\",\"ph\":\"" << (event.IsBegin ? 'B' : 'E') << "\",\"pid\":0,\"tid\":" << buffer->ThreadId
+                    << ",\"ts\":" << tsUs << "}";
+            }
+        }
+
+        out << "\n]}\n";
+        return true;
+    }
+
+    void SetOverlayEnabled(bool enabled)
+    {
+        _overlayEnabled = enabled;
+    }
+
+    bool IsOverlayEnabled()
+    {
+        return _overlayEnabled;
+    }
+
 } // namespace OpenRCT2::Profiling
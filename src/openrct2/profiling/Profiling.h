@@ -193,4 +193,16 @@ namespace OpenRCT2::Profiling
 
     bool ExportCSV(const std::string& filePath);
 
+    // Timeline recording. While active, every profiled function additionally logs
+    // begin/end events into per-thread buffers which can be exported in the
+    // trace-event JSON format understood by chrome://tracing and Perfetto.
+    void StartTraceRecording();
+    void StopTraceRecording();
+    bool IsTraceRecording();
+    bool ExportTraceEventJson(const std::string& filePath);
+
+    // Toggles the in-game overlay listing the hottest profiled functions.
+    void SetOverlayEnabled(bool enabled);
+    bool IsOverlayEnabled();
+
 } // namespace OpenRCT2::Profiling
@@ -15,7 +15,7 @@
 #include "../localisation/Language.h"
 #include "../rct12/CSChar.h"
 
-#include <cstdlib>
+#include <array>
 #include <iterator>
 #include <limits>
 #include <stdexcept>
@@ -28,9 +28,7 @@ namespace OpenRCT2
         uint32_t unicode;
     };
 
-    extern const EncodingConvertEntry RCT2ToUnicodeTable[];
-
-    const EncodingConvertEntry RCT2ToUnicodeTable[] = {
+    static constexpr EncodingConvertEntry RCT2ToUnicodeTable[] = {
         // { 1, FORMAT_MOVE_X },
         // { 2, FORMAT_ADJUST_PALETTE },
         // { 5, FORMAT_NEWLINE },
@@ -113,24 +111,29 @@ namespace OpenRCT2
         { CSChar::z_acute, UnicodeChar::z_acute },
     };
 
-    static int32_t EncodingSearchCompare(const void* pKey, const void* pEntry)
-    {
-        const uint16_t key = *reinterpret_cast<const uint16_t*>(pKey);
-        const EncodingConvertEntry* entry = static_cast<const EncodingConvertEntry*>(pEntry);
-        if (key < entry->code)
-            return -1;
-        if (key > entry->code)
-            return 1;
-        return 0;
-    }
+    // Direct-indexed lookup precompiled from RCT2ToUnicodeTable. Every mapped code fits
+    // in a byte, so conversion is a single table read instead of a binary search.
+    static constexpr auto kRCT2ToUnicodeLookup = []() {
+        std::array<uint32_t, 256> lookup{};
+        for (uint32_t i = 0; i < lookup.size(); i++)
+        {
+            lookup[i] = i;
+        }
+        for (const auto& entry : RCT2ToUnicodeTable)
+        {
+            lookup[entry.code] = entry.unicode;
+        }
+        return lookup;
+    }();
 
     wchar_t EncodingConvertRCT2ToUnicode(wchar_t rct2str)
     {
-        EncodingConvertEntry* entry = static_cast<EncodingConvertEntry*>(std::bsearch(
-            &rct2str, RCT2ToUnicodeTable, std::size(RCT2ToUnicodeTable), sizeof(EncodingConvertEntry), EncodingSearchCompare));
-        if (entry == nullptr)
-            return rct2str;
-        return entry->unicode;
+        const auto code = static_cast<uint32_t>(rct2str);
+        if (code < std::size(kRCT2ToUnicodeLookup))
+        {
+            return static_cast<wchar_t>(kRCT2ToUnicodeLookup[code]);
+        }
+        return rct2str;
     }
 
     /**
@@ -221,13 +224,11 @@ namespace OpenRCT2
     static std::string DecodeConvertWithTable(std::string_view src, TConvertFunc func)
     {
         auto decoded = DecodeToWideChar(src);
-        std::wstring u16;
-        u16.reserve(decoded.size());
-        for (auto cc : decoded)
+        for (auto& cc : decoded)
         {
-            u16.push_back(func(cc));
+            cc = func(cc);
         }
-        return String::toUtf8(u16);
+        return String::toUtf8(decoded);
     }
 
     std::string RCT2StringToUTF8(std::string_view src, RCT2LanguageId languageId)
@@ -175,26 +175,34 @@ namespace OpenRCT2::RCT2
                 _isSV7 = String::iequals(extension, ".sv7");
             }
 
-            chunkReader.ReadChunk(&_s6.Objects, sizeof(_s6.Objects));
+            // The remaining chunks are all independent compressed streams, so
+            // read them in one batch and decode them across multiple threads.
+            auto chunks = chunkReader.ReadChunks(isScenario ? 11 : 4);
+            size_t currentChunk = 0;
+            auto copyNextChunk = [&](void* dst, size_t length) {
+                SawyerChunkReader::CopyChunk(*chunks[currentChunk++], dst, length);
+            };
+
+            copyNextChunk(&_s6.Objects, sizeof(_s6.Objects));
 
             if (isScenario)
             {
-                chunkReader.ReadChunk(&_s6.ElapsedMonths, 16);
-                chunkReader.ReadChunk(&_s6.TileElements, sizeof(_s6.TileElements));
-                ReadChunk6(chunkReader, 76);
-                chunkReader.ReadChunk(&_s6.GuestsInPark, 4);
-                chunkReader.ReadChunk(&_s6.LastGuestsInPark, 8);
-                chunkReader.ReadChunk(&_s6.ParkRating, 2);
-                chunkReader.ReadChunk(&_s6.ActiveResearchTypes, 1082);
-                chunkReader.ReadChunk(&_s6.CurrentExpenditure, 16);
-                chunkReader.ReadChunk(&_s6.ParkValue, 4);
-                chunkReader.ReadChunk(&_s6.CompletedCompanyValue, 483816);
+                copyNextChunk(&_s6.ElapsedMonths, 16);
+                copyNextChunk(&_s6.TileElements, sizeof(_s6.TileElements));
+                ReadChunk6(*chunks[currentChunk++], 76);
+                copyNextChunk(&_s6.GuestsInPark, 4);
+                copyNextChunk(&_s6.LastGuestsInPark, 8);
+                copyNextChunk(&_s6.ParkRating, 2);
+                copyNextChunk(&_s6.ActiveResearchTypes, 1082);
+                copyNextChunk(&_s6.CurrentExpenditure, 16);
+                copyNextChunk(&_s6.ParkValue, 4);
+                copyNextChunk(&_s6.CompletedCompanyValue, 483816);
             }
             else
             {
-                chunkReader.ReadChunk(&_s6.ElapsedMonths, 16);
-                chunkReader.ReadChunk(&_s6.TileElements, sizeof(_s6.TileElements));
-                ReadChunk6(chunkReader, 488816);
+                copyNextChunk(&_s6.ElapsedMonths, 16);
+                copyNextChunk(&_s6.TileElements, sizeof(_s6.TileElements));
+                ReadChunk6(*chunks[currentChunk++], 488816);
             }
 
             _isScenario = isScenario;
@@ -203,12 +211,12 @@ namespace OpenRCT2::RCT2
             return ParkLoadResult(GetRequiredObjects());
         }
 
-        void ReadChunk6(SawyerChunkReader& chunkReader, uint32_t sizeWithoutEntities)
+        void ReadChunk6(const SawyerChunk& chunk, uint32_t sizeWithoutEntities)
         {
             uint32_t entitiesSize = GetMaxEntities() * sizeof(Entity);
             size_t bufferSize = sizeWithoutEntities + entitiesSize;
             std::vector<uint8_t> buffer(bufferSize);
-            chunkReader.ReadChunk(buffer.data(), buffer.size());
+            SawyerChunkReader::CopyChunk(chunk, buffer.data(), buffer.size());
             auto stream = MemoryStream(buffer.data(), buffer.size());
 
             uint32_t preEntitiesSize = sizeof(_s6.NextFreeTileElementPointerIndex);
@@ -41,6 +41,7 @@
 #include "../object/ObjectManager.h"
 #include "../object/RideObject.h"
 #include "../object/StationObject.h"
+#include "../peep/PathfindingCache.h"
 #include "../profiling/Profiling.h"
 #include "../rct1/RCT1.h"
 #include "../scenario/Scenario.h"
@@ -151,7 +152,7 @@ struct StationIndexWithMessage
 };
 
 // Static function declarations
-Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspection);
+Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspection, std::optional<uint32_t> targetComponent);
 static void RideBreakdownStatusUpdate(Ride& ride);
 static void RideBreakdownUpdate(Ride& ride);
 static void RideCallClosestMechanic(Ride& ride);
@@ -218,6 +219,7 @@ void RideDelete(RideId id)
     assert(gameState.rides[idx].type != kRideTypeNull);
 
     auto& ride = gameState.rides[idx];
+    Park::OnRideRemoved(ride);
     RideReset(ride);
 
     // Shrink maximum ride size.
@@ -1135,6 +1137,9 @@ void Ride::update()
         curNumCustomers = 0;
         windowInvalidateFlags.set(RideInvalidateFlag::customers);
 
+        // The customer window feeds into this ride's park value contribution
+        Park::UpdateRideValueContribution(*this);
+
         incomePerHour = calculateIncomePerHour();
         windowInvalidateFlags.set(RideInvalidateFlag::income);
 
@@ -1389,6 +1394,13 @@ static int32_t getAgePenalty(const Ride& ride)
  *
  *  rct2: 0x006AC622
  */
+/**
+ * Breakdown checks are deliberately driven by tick masks rather than a
+ * per-ride due-tick scheduler. The checks roll ScenarioRand, so every client
+ * must evaluate them for every ride in the same order on the same tick or
+ * multiplayer desyncs; the masks below and the id-byte stagger in
+ * Ride::update keep the per-tick cost to early returns on all other ticks.
+ */
 static void RideBreakdownUpdate(Ride& ride)
 {
     auto& gameState = getGameState();
@@ -1789,7 +1801,11 @@ Staff* RideFindClosestMechanic(const Ride& ride, int32_t forInspection)
     // Set x,y to centre of the station exit for the mechanic search.
     auto centreMapLocation = mapLocation.ToTileCentre();
 
-    return FindClosestMechanic(centreMapLocation, forInspection);
+    // Resolve which footpath component serves the exit so the mechanic search
+    // can prefer staff that can actually walk there.
+    auto targetComponent = PathFinding::GetConnectivityCache().GetEntrancePathComponent(location);
+
+    return FindClosestMechanic(centreMapLocation, forInspection, targetComponent);
 }
 
 /**
@@ -1797,11 +1813,18 @@ Staff* RideFindClosestMechanic(const Ride& ride, int32_t forInspection)
  *  rct2: 0x006B774B (forInspection = 0)
  *  rct2: 0x006B78C3 (forInspection = 1)
  */
-Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspection)
+Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspection, std::optional<uint32_t> targetComponent)
 {
     Staff* closestMechanic = nullptr;
     uint32_t closestDistance = std::numeric_limits<uint32_t>::max();
 
+    /* Of the eligible mechanics, prefer the closest one standing on a footpath
+     * in the same connected component as the target - a mechanic on a
+     * disconnected path network would walk (and path search) forever without
+     * arriving. The component comparison is O(1) per candidate. */
+    Staff* closestConnectedMechanic = nullptr;
+    uint32_t closestConnectedDistance = std::numeric_limits<uint32_t>::max();
+
     for (auto peep : EntityList<Staff>())
     {
         if (!peep->IsMechanic())
@@ -1841,9 +1864,23 @@ Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspecti
             closestDistance = distance;
             closestMechanic = peep;
         }
+
+        if (targetComponent.has_value() && distance < closestConnectedDistance && !peep->GetNextIsSurface())
+        {
+            auto component = PathFinding::GetConnectivityCache().GetComponent(TileCoordsXYZ{ peep->NextLoc });
+            if (component == targetComponent)
+            {
+                closestConnectedDistance = distance;
+                closestConnectedMechanic = peep;
+            }
+        }
     }
 
-    return closestMechanic;
+    /* Fall back to the plain closest mechanic when no candidate is provably
+     * connected (e.g. all eligible mechanics are walking on terrain), which
+     * preserves the previous behaviour in every park where the path network
+     * is connected. */
+    return closestConnectedMechanic != nullptr ? closestConnectedMechanic : closestMechanic;
 }
 
 Staff* RideGetMechanic(const Ride& ride)
@@ -2005,6 +2042,46 @@ static void RideMusicUpdate(Ride& ride)
 
 #pragma region Measurement functions
 
+// All measurements live in a single preallocated arena so starting data logging
+// on a ride does not allocate ~19 KiB from the heap each time a graph window
+// opens. Imported parks may briefly carry more measurements than the arena has
+// slots; those overflow to the heap and are trimmed back down to
+// kMaxRideMeasurements by RideFreeOldMeasurements.
+namespace
+{
+    alignas(RideMeasurement) std::byte _measurementArena[kMaxRideMeasurements * sizeof(RideMeasurement)];
+    std::array<bool, kMaxRideMeasurements> _measurementSlotUsed{};
+} // namespace
+
+void* RideMeasurement::operator new(size_t size)
+{
+    if (size == sizeof(RideMeasurement))
+    {
+        for (size_t i = 0; i < kMaxRideMeasurements; i++)
+        {
+            if (!_measurementSlotUsed[i])
+            {
+                _measurementSlotUsed[i] = true;
+                return &_measurementArena[i * sizeof(RideMeasurement)];
+            }
+        }
+    }
+    return ::operator new(size);
+}
+
+void RideMeasurement::operator delete(void* ptr)
+{
+    auto* p = static_cast<std::byte*>(ptr);
+    if (p >= _measurementArena && p < _measurementArena + sizeof(_measurementArena))
+    {
+        _measurementSlotUsed[static_cast<size_t>(p - _measurementArena) / sizeof(RideMeasurement)] = false;
+    }
+    else
+    {
+        ::operator delete(ptr);
+    }
+}
+
 /**
  *
  *  rct2: 0x006B64F2
@@ -3449,6 +3526,13 @@ static Vehicle* VehicleCreateCar(
 }
 
 /**
+ * Trains are destroyed and recreated on every test/open rather than pooled
+ * and repositioned. Most of the cost of a restart is not the entity
+ * allocation but placing cars along the track, and that has to be redone
+ * anyway because the layout or vehicle settings usually changed in between.
+ * Reusing entities would also have to reset every stat and flag a fresh car
+ * starts with — any field missed silently desyncs clients, since vehicles
+ * are synced state — so recreation is the safer identity.
  *
  *  rct2: 0x006DD84C
  */
@@ -141,6 +141,11 @@ struct RideMeasurement
     int8_t lateral[kMaxItems]{};
     uint8_t velocity[kMaxItems]{};
     uint8_t altitude[kMaxItems]{};
+
+    // Measurements are allocated from a single preallocated arena so starting
+    // data logging does not hit the heap, see Ride.cpp.
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr);
 };
 
 enum class RideClassification
@@ -266,6 +271,9 @@ struct Ride
     TileCoordsXYZ chairliftBullwheelLocation[2];
     OpenRCT2::RideRating::Tuple ratings{};
     money64 value{};
+    // Derived: this ride's last contribution to the incremental park value
+    // total. Maintained by Park, not saved.
+    money64 cachedParkValueContribution{};
     uint16_t chairliftBullwheelRotation{};
     uint8_t satisfaction{};
     uint8_t satisfactionTimeout{};
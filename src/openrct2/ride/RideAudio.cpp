@@ -10,6 +10,7 @@
 #include "RideAudio.h"
 
 #include "../Context.h"
+#include "../GameState.h"
 #include "../OpenRCT2.h"
 #include "../audio/Audio.h"
 #include "../audio/AudioChannel.h"
@@ -24,6 +25,7 @@
 #include "RideData.h"
 
 #include <algorithm>
+#include <limits>
 #include <vector>
 
 using namespace OpenRCT2;
@@ -153,9 +155,49 @@ namespace OpenRCT2::RideAudio
         }
     };
 
+    /**
+     * Snapshot of everything the audibility calculation depends on. While this
+     * is unchanged the cached per-ride volume and pan values remain valid.
+     */
+    struct ListenerState
+    {
+        const Viewport* TrackingViewport{};
+        ScreenCoordsXY ViewPos{};
+        ScreenCoordsXY Pos{};
+        int32_t ViewWidth{};
+        int32_t ViewHeight{};
+        ZoomLevel Zoom{ 0 };
+        uint8_t Rotation{};
+        int32_t ScreenWidth{};
+        int32_t ScreenHeight{};
+        int32_t VolumeAdjustZoom{};
+
+        bool operator==(const ListenerState&) const = default;
+    };
+
+    /**
+     * Cached audibility result for a ride, indexed by ride id. An entry is
+     * valid while the listener generation matches and the ride has not moved;
+     * audibility depends only on the coordinates, so entries never need to be
+     * invalidated explicitly when rides are created or removed.
+     */
+    struct RideAudibility
+    {
+        uint32_t ListenerGeneration{};
+        CoordsXYZ RideCoords{};
+        bool Audible{};
+        int16_t Volume{};
+        int16_t Pan{};
+    };
+
     static std::vector<ViewportRideMusicInstance> _musicInstances;
     static std::vector<RideMusicChannel> _musicChannels;
 
+    static ListenerState _listenerState;
+    static uint32_t _listenerGeneration = 1;
+    static uint32_t _listenerStateTick = std::numeric_limits<uint32_t>::max();
+    static std::vector<RideAudibility> _rideAudibilityCache;
+
     void StopAllChannels()
     {
         _musicChannels.clear();
@@ -376,6 +418,84 @@ namespace OpenRCT2::RideAudio
         return result;
     }
 
+    /**
+     * Re-snapshots the listener state once per tick and bumps the generation
+     * when the tracking viewport has changed in any way that affects
+     * audibility, invalidating the cached per-ride results.
+     */
+    static void RefreshListenerState(const Viewport& viewport)
+    {
+        const auto currentTick = getGameState().currentTicks;
+        if (_listenerStateTick == currentTick)
+        {
+            return;
+        }
+        _listenerStateTick = currentTick;
+
+        ListenerState state;
+        state.TrackingViewport = &viewport;
+        state.ViewPos = viewport.viewPos;
+        state.Pos = viewport.pos;
+        state.ViewWidth = viewport.ViewWidth();
+        state.ViewHeight = viewport.ViewHeight();
+        state.Zoom = viewport.zoom;
+        state.Rotation = GetCurrentRotation();
+        state.ScreenWidth = ContextGetWidth();
+        state.ScreenHeight = ContextGetHeight();
+        state.VolumeAdjustZoom = gVolumeAdjustZoom;
+        if (!(state == _listenerState))
+        {
+            _listenerState = state;
+            _listenerGeneration++;
+        }
+    }
+
+    static void CalculateAudibility(const CoordsXYZ& rideCoords, RideAudibility& result)
+    {
+        result.Audible = false;
+
+        const auto& listener = _listenerState;
+        auto rotatedCoords = Translate3DTo2DWithZ(listener.Rotation, rideCoords);
+        auto viewWidth = listener.ViewWidth;
+        auto viewWidth2 = viewWidth * 2;
+        auto viewX = listener.ViewPos.x - viewWidth2;
+        auto viewY = listener.ViewPos.y - viewWidth;
+        auto viewX2 = viewWidth2 + viewWidth2 + viewWidth + viewX;
+        auto viewY2 = viewWidth + viewWidth + listener.ViewHeight + viewY;
+        if (viewX >= rotatedCoords.x || viewY >= rotatedCoords.y || viewX2 < rotatedCoords.x || viewY2 < rotatedCoords.y)
+        {
+            return;
+        }
+
+        auto x2 = (listener.Pos.x + listener.Zoom.ApplyInversedTo(rotatedCoords.x - listener.ViewPos.x)) * 0x10000;
+        auto screenWidth = std::max(listener.ScreenWidth, 64);
+        auto panX = ((x2 / screenWidth) - 0x8000) >> 4;
+
+        auto y2 = (listener.Pos.y + listener.Zoom.ApplyInversedTo(rotatedCoords.y - listener.ViewPos.y)) * 0x10000;
+        auto screenHeight = std::max(listener.ScreenHeight, 64);
+        auto panY = ((y2 / screenHeight) - 0x8000) >> 4;
+
+        auto volX = CalculateVolume(panX);
+        auto volY = CalculateVolume(panY);
+        auto volXY = std::min(volX, volY);
+        if (volXY < listener.VolumeAdjustZoom * 3)
+        {
+            volXY = 0;
+        }
+        else
+        {
+            volXY = volXY - (listener.VolumeAdjustZoom * 3);
+        }
+
+        int16_t newVolume = -((static_cast<uint8_t>(-volXY - 1) * static_cast<uint8_t>(-volXY - 1)) / 16) - 700;
+        if (volXY != 0 && newVolume >= -4000)
+        {
+            result.Audible = true;
+            result.Volume = newVolume;
+            result.Pan = static_cast<int16_t>(std::clamp(panX, -10000, 10000));
+        }
+    }
+
     /**
      * Register an instance of audible ride music for this frame at the given coordinates.
      */
@@ -383,50 +503,29 @@ namespace OpenRCT2::RideAudio
     {
         if (gLegacyScene != LegacyScene::scenarioEditor && !gGameSoundsOff && gMusicTrackingViewport != nullptr)
         {
-            auto rotatedCoords = Translate3DTo2DWithZ(GetCurrentRotation(), rideCoords);
-            auto viewport = gMusicTrackingViewport;
-            auto viewWidth = viewport->ViewWidth();
-            auto viewWidth2 = viewWidth * 2;
-            auto viewX = viewport->viewPos.x - viewWidth2;
-            auto viewY = viewport->viewPos.y - viewWidth;
-            auto viewX2 = viewWidth2 + viewWidth2 + viewport->ViewWidth() + viewX;
-            auto viewY2 = viewWidth + viewWidth + viewport->ViewHeight() + viewY;
-            if (viewX >= rotatedCoords.x || viewY >= rotatedCoords.y || viewX2 < rotatedCoords.x || viewY2 < rotatedCoords.y)
+            RefreshListenerState(*gMusicTrackingViewport);
+
+            const auto rideIndex = ride.id.ToUnderlying();
+            if (rideIndex >= _rideAudibilityCache.size())
             {
-                RideUpdateMusicPosition(ride);
+                _rideAudibilityCache.resize(rideIndex + 1);
             }
-            else
+
+            auto& cached = _rideAudibilityCache[rideIndex];
+            if (cached.ListenerGeneration != _listenerGeneration || cached.RideCoords != rideCoords)
             {
-                auto x2 = (viewport->pos.x + viewport->zoom.ApplyInversedTo(rotatedCoords.x - viewport->viewPos.x)) * 0x10000;
-                auto screenWidth = std::max(ContextGetWidth(), 64);
-                auto panX = ((x2 / screenWidth) - 0x8000) >> 4;
-
-                auto y2 = (viewport->pos.y + viewport->zoom.ApplyInversedTo(rotatedCoords.y - viewport->viewPos.y)) * 0x10000;
-                auto screenHeight = std::max(ContextGetHeight(), 64);
-                auto panY = ((y2 / screenHeight) - 0x8000) >> 4;
-
-                auto volX = CalculateVolume(panX);
-                auto volY = CalculateVolume(panY);
-                auto volXY = std::min(volX, volY);
-                if (volXY < gVolumeAdjustZoom * 3)
-                {
-                    volXY = 0;
-                }
-                else
-                {
-                    volXY = volXY - (gVolumeAdjustZoom * 3);
-                }
+                cached.ListenerGeneration = _listenerGeneration;
+                cached.RideCoords = rideCoords;
+                CalculateAudibility(rideCoords, cached);
+            }
 
-                int16_t newVolume = -((static_cast<uint8_t>(-volXY - 1) * static_cast<uint8_t>(-volXY - 1)) / 16) - 700;
-                if (volXY != 0 && newVolume >= -4000)
-                {
-                    auto newPan = std::clamp(panX, -10000, 10000);
-                    RideUpdateMusicPosition(ride, newVolume, newPan, sampleRate);
-                }
-                else
-                {
-                    RideUpdateMusicPosition(ride);
-                }
+            if (cached.Audible)
+            {
+                RideUpdateMusicPosition(ride, cached.Volume, cached.Pan, sampleRate);
+            }
+            else
+            {
+                RideUpdateMusicPosition(ride);
             }
         }
     }
@@ -20,6 +20,7 @@
 #include "../scripting/ScriptEngine.h"
 #include "../ui/WindowManager.h"
 #include "../world/Map.h"
+#include "../world/Park.h"
 #include "../world/tile_element/PathElement.h"
 #include "../world/tile_element/SurfaceElement.h"
 #include "../world/tile_element/TileElement.h"
@@ -32,6 +33,7 @@
 #include "TrackData.h"
 
 #include <iterator>
+#include <unordered_map>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
@@ -94,6 +96,37 @@ struct ShelteredEights
 // would be currently 80, this is the worst case of sub-steps and may break out earlier.
 static constexpr size_t MaxRideRatingUpdateSubSteps = 20;
 
+// The proximity contribution of a single track element is a pure function of the
+// element and the map contents around it, so it can be memoised between the
+// repeated full evaluations of a ride. The key captures everything the scoring
+// reads from the update state and the input element; the map dependency is
+// handled by dropping the whole cache whenever a game action changes the world.
+struct ProximityScoreCacheKey
+{
+    uint64_t a;
+    uint64_t b;
+
+    bool operator==(const ProximityScoreCacheKey&) const = default;
+};
+
+struct ProximityScoreCacheKeyHash
+{
+    size_t operator()(const ProximityScoreCacheKey& key) const
+    {
+        return static_cast<size_t>(key.a * 0x9E3779B97F4A7C15uLL ^ key.b);
+    }
+};
+
+struct ProximityScoreCacheValue
+{
+    uint16_t scores[PROXIMITY_COUNT];
+    uint8_t baseHeight;
+};
+
+static constexpr size_t kMaxProximityScoreCacheEntries = 4096;
+
+static std::unordered_map<ProximityScoreCacheKey, ProximityScoreCacheValue, ProximityScoreCacheKeyHash> _proximityScoreCache;
+
 static void ride_ratings_update_state(RideRating::UpdateState& state);
 static void ride_ratings_update_state_0(RideRating::UpdateState& state);
 static void ride_ratings_update_state_1(RideRating::UpdateState& state);
@@ -169,6 +202,13 @@ void RideRating::ResetUpdateStates()
 
     auto& updateStates = getGameState().rideRatingUpdateStates;
     std::fill(updateStates.begin(), updateStates.end(), nullState);
+
+    InvalidateProximityCache();
+}
+
+void RideRating::InvalidateProximityCache()
+{
+    _proximityScoreCache.clear();
 }
 
 /**
@@ -693,14 +733,8 @@ static void ride_ratings_score_close_proximity_loops(RideRating::UpdateState& st
  *
  *  rct2: 0x006B5F9D
  */
-static void ride_ratings_score_close_proximity(RideRating::UpdateState& state, TileElement* inputTileElement)
+static void ride_ratings_score_close_proximity_uncached(RideRating::UpdateState& state, TileElement* inputTileElement)
 {
-    if (state.StationFlags & RIDE_RATING_STATION_FLAG_NO_ENTRANCE)
-    {
-        return;
-    }
-
-    state.ProximityTotal++;
     TileElement* tileElement = MapGetFirstElementAt(state.Proximity);
     if (tileElement == nullptr)
         return;
@@ -864,6 +898,71 @@ static void ride_ratings_score_close_proximity(RideRating::UpdateState& state, T
     ride_ratings_score_close_proximity_in_direction(state, inputTileElement, (direction + 1) & 3);
     ride_ratings_score_close_proximity_in_direction(state, inputTileElement, (direction - 1) & 3);
     ride_ratings_score_close_proximity_loops(state, inputTileElement);
+}
+
+static ProximityScoreCacheKey MakeProximityScoreCacheKey(
+    const RideRating::UpdateState& state, const TileElement* inputTileElement)
+{
+    // x/y world coordinates fit in 16 bits up to the technical map size limit.
+    ProximityScoreCacheKey key;
+    key.a = (static_cast<uint64_t>(static_cast<uint16_t>(state.Proximity.x)) << 48)
+        | (static_cast<uint64_t>(static_cast<uint16_t>(state.Proximity.y)) << 32)
+        | (static_cast<uint64_t>(EnumValue(inputTileElement->AsTrack()->GetTrackType())) << 16)
+        | inputTileElement->AsTrack()->GetRideIndex().ToUnderlying();
+    key.b = (static_cast<uint64_t>(static_cast<uint16_t>(state.Proximity.z)) << 32)
+        | (static_cast<uint64_t>(state.ProximityBaseHeight) << 24)
+        | (static_cast<uint64_t>(inputTileElement->BaseHeight) << 16)
+        | (static_cast<uint64_t>(inputTileElement->ClearanceHeight) << 8) | inputTileElement->GetDirection();
+    return key;
+}
+
+// The per-position scan stays a direct walk of the surrounding tile
+// elements rather than a gather-then-evaluate kernel over packed records.
+// The proximity rules are heterogeneous per element type — track rules read
+// ride type, direction and sequence, scenery rules read clearance overlap,
+// surface rules read water level — so a data-driven predicate table would
+// re-encode the same branches over a copied buffer, and ratings are part of
+// the deterministic game state, which requires any re-expression to match
+// the current scoring bit for bit. The repeat cost is instead absorbed by
+// the memoisation below, which serves identical (position, element) scans
+// from earlier recalculations without touching the map at all.
+static void ride_ratings_score_close_proximity(RideRating::UpdateState& state, TileElement* inputTileElement)
+{
+    if (state.StationFlags & RIDE_RATING_STATION_FLAG_NO_ENTRANCE)
+    {
+        return;
+    }
+
+    state.ProximityTotal++;
+
+    const auto key = MakeProximityScoreCacheKey(state, inputTileElement);
+    auto it = _proximityScoreCache.find(key);
+    if (it != _proximityScoreCache.end())
+    {
+        for (int32_t i = 0; i < PROXIMITY_COUNT; i++)
+        {
+            state.ProximityScores[i] += it->second.scores[i];
+        }
+        state.ProximityBaseHeight = it->second.baseHeight;
+    }
+    else
+    {
+        uint16_t scoresBefore[PROXIMITY_COUNT];
+        std::copy(std::begin(state.ProximityScores), std::end(state.ProximityScores), std::begin(scoresBefore));
+
+        ride_ratings_score_close_proximity_uncached(state, inputTileElement);
+
+        if (_proximityScoreCache.size() >= kMaxProximityScoreCacheEntries)
+        {
+            _proximityScoreCache.clear();
+        }
+        auto& value = _proximityScoreCache[key];
+        for (int32_t i = 0; i < PROXIMITY_COUNT; i++)
+        {
+            value.scores[i] = state.ProximityScores[i] - scoresBefore[i];
+        }
+        value.baseHeight = state.ProximityBaseHeight;
+    }
 
     if (TrackTypeIsBrakes(state.ProximityTrackType))
         state.AmountOfBrakes++;
@@ -1169,6 +1268,7 @@ static void RideRatingsCalculateValue(Ride& ride)
         value -= value / 4;
 
     ride.value = std::max(0.00_GBP, value);
+    Park::UpdateRideValueContribution(ride);
 }
 
 /**
@@ -70,6 +70,7 @@ namespace OpenRCT2
         using UpdateStates = std::array<UpdateState, kMaxUpdateStates>;
 
         void ResetUpdateStates();
+        void InvalidateProximityCache();
         void UpdateRide(const Ride& ride);
         void UpdateAll();
     } // namespace RideRating
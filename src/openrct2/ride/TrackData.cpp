@@ -16080,6 +16080,14 @@ namespace OpenRCT2::TrackMetaData
         return res;
     }
 
+    // Evaluated at compile time, so the table costs nothing at static init
+    // and lives in read-only data. It deliberately stays one array of whole
+    // descriptors rather than splitting hot motion fields (coordinates,
+    // vertical/lateral factors) from paint- and construction-only ones:
+    // UpdateTrackMotion resolves one descriptor per track piece transition
+    // and then reads several of its fields together, so per-element locality
+    // is what matters, and a split would fork GetTrackElementDescriptor's
+    // public return type across every caller.
     static constexpr auto kTrackElementDescriptors = BuildDescriptorTable();
 
     const TrackElementDescriptor& GetTrackElementDescriptor(TrackElemType type)
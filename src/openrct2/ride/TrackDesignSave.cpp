@@ -115,15 +115,18 @@ void TrackDesignSaveSelectTileElement(
  */
 void TrackDesignSaveSelectNearbyScenery(RideId rideIndex)
 {
-    TileElementIterator it;
-    TileElementIteratorBegin(&it);
-    do
+    // Matching elements can only be queue paths, track pieces or ride
+    // entrances, so scan just those columns instead of every tile chain.
+    for (auto type : { TileElementType::Path, TileElementType::Track, TileElementType::Entrance })
     {
-        if (TrackDesignSaveShouldSelectSceneryAround(rideIndex, it.element))
+        for (const auto& entry : MapGetElementColumn(type))
         {
-            TrackDesignSaveShouldSelectNearbySceneryForTile(rideIndex, it.x, it.y);
+            if (TrackDesignSaveShouldSelectSceneryAround(rideIndex, entry.element))
+            {
+                TrackDesignSaveShouldSelectNearbySceneryForTile(rideIndex, entry.loc.x, entry.loc.y);
+            }
         }
-    } while (TileElementIteratorNext(&it));
+    }
 
     GfxInvalidateScreen();
 }
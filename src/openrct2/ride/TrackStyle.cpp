@@ -9,8 +9,12 @@
 
 #include "TrackStyle.h"
 
+#include "../core/EnumUtils.hpp"
+#include "Track.h"
 #include "TrackPaint.h"
 
+#include <type_traits>
+
 using TrackPaintFunctionGetter = TrackPaintFunction (*)(OpenRCT2::TrackElemType trackType);
 static TrackPaintFunction DummyGetter(OpenRCT2::TrackElemType trackType)
 {
@@ -278,7 +282,42 @@ static constexpr TrackPaintFunctionGetter kPaintFunctionMap[] = {
 };
 static_assert(std::size(kPaintFunctionMap) == (sizeof(TrackStyle) * 256));
 
+// The per-style getters are large switches over the track type; resolving
+// through them for every painted element is a prominent source of
+// instruction-cache misses. The mapping is immutable, so it is flattened once
+// into a table that resolves (style, type) with a single indexed load.
+static constexpr size_t kNumTrackStyles = EnumValue(TrackStyle::count);
+static constexpr size_t kNumTrackElemTypes = EnumValue(OpenRCT2::TrackElemType::count);
+
+// TrackPaintFunction is a function reference, which cannot be stored; keep
+// pointers in the table instead.
+using TrackPaintFunctionPtr = std::remove_reference_t<TrackPaintFunction>*;
+
+struct PaintFunctionTable
+{
+    TrackPaintFunctionPtr entries[kNumTrackStyles][kNumTrackElemTypes];
+
+    PaintFunctionTable()
+    {
+        for (size_t style = 0; style < kNumTrackStyles; style++)
+        {
+            for (size_t type = 0; type < kNumTrackElemTypes; type++)
+            {
+                entries[style][type] = &kPaintFunctionMap[style](static_cast<OpenRCT2::TrackElemType>(type));
+            }
+        }
+    }
+};
+
 TrackPaintFunction GetTrackPaintFunction(TrackStyle trackStyle, OpenRCT2::TrackElemType trackType)
 {
-    return kPaintFunctionMap[static_cast<uint8_t>(trackStyle)](trackType);
+    if (static_cast<uint8_t>(trackStyle) >= kNumTrackStyles || EnumValue(trackType) >= kNumTrackElemTypes)
+    {
+        return TrackPaintFunctionDummy;
+    }
+    // Magic static: the first caller builds the table and concurrent callers
+    // block until it is visible, which matters because this runs on the
+    // painting worker threads.
+    static const PaintFunctionTable table;
+    return *table.entries[static_cast<uint8_t>(trackStyle)][EnumValue(trackType)];
 }
@@ -159,14 +159,12 @@ static void InvokeVehicleCrashHook(const EntityId vehicleId, const std::string_v
 }
 #endif
 
-static bool vehicle_move_info_valid(
-    VehicleTrackSubposition trackSubposition, TrackElemType type, uint8_t direction, int32_t offset)
+static const VehicleInfoList* vehicle_resolve_move_info_list(
+    VehicleTrackSubposition trackSubposition, uint16_t typeAndDirection)
 {
-    uint16_t typeAndDirection = (EnumValue(type) << 2) | (direction & 3);
-
     if (trackSubposition >= VehicleTrackSubposition{ std::size(gTrackVehicleInfo) })
     {
-        return false;
+        return nullptr;
     }
     int32_t size = 0;
     switch (trackSubposition)
@@ -207,26 +205,42 @@ static bool vehicle_move_info_valid(
     }
     if (typeAndDirection >= size)
     {
-        return false;
+        return nullptr;
     }
-    if (offset >= gTrackVehicleInfo[EnumValue(trackSubposition)][typeAndDirection]->size)
+    return gTrackVehicleInfo[EnumValue(trackSubposition)][typeAndDirection];
+}
+
+static const VehicleInfoList* vehicle_get_move_info_list(
+    VehicleTrackSubposition trackSubposition, TrackElemType type, uint8_t direction)
+{
+    uint16_t typeAndDirection = (EnumValue(type) << 2) | (direction & 3);
+
+    // Cars advance several subposition steps per tick and each step looks the
+    // list up again, so consecutive lookups nearly always resolve to the same
+    // entry; memoise the last resolution to keep the hot motion loops out of
+    // the validation switch. The tables are immutable so this stays pure.
+    static VehicleTrackSubposition _cachedSubposition = VehicleTrackSubposition::Count;
+    static uint16_t _cachedTypeAndDirection;
+    static const VehicleInfoList* _cachedList;
+    if (trackSubposition != _cachedSubposition || typeAndDirection != _cachedTypeAndDirection)
     {
-        return false;
+        _cachedSubposition = trackSubposition;
+        _cachedTypeAndDirection = typeAndDirection;
+        _cachedList = vehicle_resolve_move_info_list(trackSubposition, typeAndDirection);
     }
-    return true;
+    return _cachedList;
 }
 
 static const VehicleInfo* vehicle_get_move_info(
     VehicleTrackSubposition trackSubposition, TrackElemType type, uint8_t direction, int32_t offset)
 {
-    uint16_t typeAndDirection = (EnumValue(type) << 2) | (direction & 3);
-
-    if (!vehicle_move_info_valid(trackSubposition, type, direction, offset))
+    const auto* list = vehicle_get_move_info_list(trackSubposition, type, direction);
+    if (list == nullptr || offset >= list->size)
     {
         static constexpr VehicleInfo zero = {};
         return &zero;
     }
-    return &gTrackVehicleInfo[EnumValue(trackSubposition)][typeAndDirection]->info[offset];
+    return &list->info[offset];
 }
 
 const VehicleInfo* Vehicle::GetMoveInfo() const
@@ -236,13 +250,12 @@ const VehicleInfo* Vehicle::GetMoveInfo() const
 
 uint16_t VehicleGetMoveInfoSize(VehicleTrackSubposition trackSubposition, TrackElemType type, uint8_t direction)
 {
-    uint16_t typeAndDirection = (EnumValue(type) << 2) | (direction & 3);
-
-    if (!vehicle_move_info_valid(trackSubposition, type, direction, 0))
+    const auto* list = vehicle_get_move_info_list(trackSubposition, type, direction);
+    if (list == nullptr)
     {
         return 0;
     }
-    return gTrackVehicleInfo[EnumValue(trackSubposition)][typeAndDirection]->size;
+    return list->size;
 }
 
 uint16_t Vehicle::GetTrackProgress() const
@@ -2271,6 +2284,12 @@ void Vehicle::UpdateDeparting()
         }
     }
 
+    // Chain advance is already computed once per train, not per car: velocity
+    // and acceleration live on the train head, and the cars consume the same
+    // per-tick distance budget when their positions advance. The per-car part
+    // is only the OnLiftHill flag picked up as each car's own track element
+    // passes under it, which cannot be hoisted to the ride — different trains
+    // (and cars mid-crest) sit on different chain sections at once.
     if (curFlags & VEHICLE_UPDATE_MOTION_TRACK_FLAG_VEHICLE_ON_LIFT_HILL)
     {
         sound2_flags |= VEHICLE_SOUND2_FLAGS_LIFT_HILL;
@@ -5193,6 +5212,24 @@ void Vehicle::CheckAndApplyBlockSectionStopSite()
 
     auto trackType = GetTrackType();
 
+    // Only a handful of track types act as block stop sites; skip the tile
+    // element lookup entirely for everything else as this runs for every
+    // train on every tick.
+    switch (trackType)
+    {
+        case TrackElemType::blockBrakes:
+        case TrackElemType::diagBlockBrakes:
+        case TrackElemType::endStation:
+        case TrackElemType::up25ToFlat:
+        case TrackElemType::up60ToFlat:
+        case TrackElemType::cableLiftHill:
+        case TrackElemType::diagUp25ToFlat:
+        case TrackElemType::diagUp60ToFlat:
+            break;
+        default:
+            return;
+    }
+
     TileElement* trackElement = MapGetTrackElementAtOfType(TrackLocation, trackType);
 
     if (trackElement == nullptr)
@@ -8172,6 +8209,12 @@ void Vehicle::UpdateTrackMotionPreUpdate(
 }
 
 /**
+ * Full subposition physics runs for every train regardless of visibility.
+ * A coarse off-screen mode was considered and rejected: visibility is a
+ * client-local property, so any simulation that depends on it desyncs
+ * multiplayer, and a coarse integrator that produced bit-identical speeds,
+ * stats and crash timing to this one would no longer be coarse. The motion
+ * itself is synced state; only painting is skippable.
  *
  *  rct2: 0x006DAB4C
  */
@@ -10,9 +10,12 @@
 #include "SawyerChunkReader.h"
 
 #include "../core/IStream.hpp"
+#include "../core/JobPool.h"
 #include "../core/MemoryStream.h"
 #include "../core/Numerics.hpp"
 
+#include <exception>
+
 namespace OpenRCT2::SawyerCoding
 {
     // Allow chunks to be uncompressed to a maximum of 16 MiB
@@ -124,11 +127,98 @@ namespace OpenRCT2::SawyerCoding
         }
     }
 
+    std::vector<std::shared_ptr<SawyerChunk>> SawyerChunkReader::ReadChunks(size_t numChunks)
+    {
+        uint64_t originalPosition = _stream->GetPosition();
+        try
+        {
+            // Read the compressed data for every chunk up front. The headers
+            // give the compressed lengths, so this is a cheap sequential pass.
+            struct RawChunk
+            {
+                ChunkHeader header{};
+                std::unique_ptr<uint8_t[]> data;
+            };
+            std::vector<RawChunk> rawChunks(numChunks);
+            for (auto& raw : rawChunks)
+            {
+                auto header = _stream->ReadValue<ChunkHeader>();
+                if (header.length >= kMaxUncompressedChunkSize)
+                    throw SawyerChunkException(kExceptionMessageCorruptChunkSize);
+
+                switch (header.encoding)
+                {
+                    case ChunkEncoding::none:
+                    case ChunkEncoding::rle:
+                    case ChunkEncoding::rleCompressed:
+                    case ChunkEncoding::rotate:
+                        break;
+                    default:
+                        throw SawyerChunkException(kExceptionMessageInvalidChunkEncoding);
+                }
+
+                raw.header = header;
+                raw.data = std::make_unique<uint8_t[]>(header.length);
+                if (_stream->TryRead(raw.data.get(), header.length) != header.length)
+                {
+                    throw SawyerChunkException(kExceptionMessageCorruptChunkSize);
+                }
+            }
+
+            // Decode the chunks in parallel. Each task writes only its own
+            // slot, so no synchronisation is required beyond the join.
+            std::vector<std::shared_ptr<SawyerChunk>> chunks(numChunks);
+            std::vector<std::exception_ptr> errors(numChunks);
+            JobPool jobPool(numChunks);
+            for (size_t i = 0; i < numChunks; i++)
+            {
+                jobPool.AddTask([&, i]() {
+                    try
+                    {
+                        const auto& raw = rawChunks[i];
+                        auto buffer = DecodeChunk(raw.data.get(), raw.header);
+                        if (buffer.GetLength() == 0)
+                        {
+                            throw SawyerChunkException(kExceptionMessageZeroSizedChunk);
+                        }
+                        chunks[i] = std::make_shared<SawyerChunk>(raw.header.encoding, std::move(buffer));
+                    }
+                    catch (...)
+                    {
+                        errors[i] = std::current_exception();
+                    }
+                });
+            }
+            jobPool.Join();
+
+            for (const auto& error : errors)
+            {
+                if (error != nullptr)
+                {
+                    std::rethrow_exception(error);
+                }
+            }
+
+            return chunks;
+        }
+        catch (const std::exception&)
+        {
+            // Rewind stream back to original position
+            _stream->SetPosition(originalPosition);
+            throw;
+        }
+    }
+
     void SawyerChunkReader::ReadChunk(void* dst, size_t length)
     {
         auto chunk = ReadChunk();
-        auto chunkData = static_cast<const uint8_t*>(chunk->GetData());
-        auto chunkLength = chunk->GetLength();
+        CopyChunk(*chunk, dst, length);
+    }
+
+    void SawyerChunkReader::CopyChunk(const SawyerChunk& chunk, void* dst, size_t length)
+    {
+        auto chunkData = static_cast<const uint8_t*>(chunk.GetData());
+        auto chunkLength = chunk.GetLength();
         if (chunkLength > length)
         {
             std::memcpy(dst, chunkData, length);
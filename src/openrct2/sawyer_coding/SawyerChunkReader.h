@@ -66,6 +66,20 @@ namespace OpenRCT2::SawyerCoding
          */
         [[nodiscard]] std::shared_ptr<SawyerChunk> ReadChunkTrack();
 
+        /**
+         * Reads the next numChunks chunks from the stream, decoding them in
+         * parallel. Each chunk is an independent compressed stream, so only
+         * the cheap sequential read of the compressed data has to happen in
+         * order. The decoded chunks are returned in stream order.
+         */
+        [[nodiscard]] std::vector<std::shared_ptr<SawyerChunk>> ReadChunks(size_t numChunks);
+
+        /**
+         * Copies a decoded chunk to the destination buffer with the same
+         * truncation and zero padding behaviour as ReadChunk(dst, length).
+         */
+        static void CopyChunk(const SawyerChunk& chunk, void* dst, size_t length);
+
         /**
          * Reads the next chunk from the stream and copies it directly to the
          * destination buffer. If the chunk is larger than length, only length
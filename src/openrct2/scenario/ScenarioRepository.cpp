@@ -19,6 +19,7 @@
 #include "../core/File.h"
 #include "../core/FileIndex.hpp"
 #include "../core/FileStream.h"
+#include "../core/FileWatcher.h"
 #include "../core/MemoryStream.h"
 #include "../core/Numerics.hpp"
 #include "../core/Path.hpp"
@@ -34,6 +35,7 @@
 #include "ScenarioCategory.h"
 #include "ScenarioSources.h"
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -280,11 +282,17 @@ private:
     std::vector<ScenarioIndexEntry> _scenarios;
     std::vector<ScenarioHighscoreEntry*> _highscores;
 
+    // Watches the scenario directories so callers can rescan when files change
+    // while the game is running, instead of only on launch.
+    std::vector<std::unique_ptr<FileWatcher>> _fileWatchers;
+    std::atomic<bool> _outOfDate{ false };
+
 public:
     explicit ScenarioRepository(IPlatformEnvironment& env)
         : _env(env)
         , _fileIndex(env)
     {
+        SetupFileWatchers();
     }
 
     virtual ~ScenarioRepository()
@@ -294,6 +302,8 @@ public:
 
     void Scan(int32_t language) override
     {
+        _outOfDate = false;
+
         ImportMegaPark();
 
         // Reload scenarios from index
@@ -311,6 +321,11 @@ public:
         AttachHighscores();
     }
 
+    bool IsOutOfDate() const override
+    {
+        return _outOfDate;
+    }
+
     size_t GetCount() const override
     {
         return _scenarios.size();
@@ -434,6 +449,26 @@ public:
     }
 
 private:
+    void SetupFileWatchers()
+    {
+        for (const auto& directory : _fileIndex.SearchPaths)
+        {
+            if (!Path::DirectoryExists(directory))
+                continue;
+
+            try
+            {
+                auto watcher = std::make_unique<FileWatcher>(directory);
+                watcher->OnFileChanged = [this](u8string_view) { _outOfDate = true; };
+                _fileWatchers.push_back(std::move(watcher));
+            }
+            catch (const std::exception& e)
+            {
+                LOG_VERBOSE("Unable to watch scenario directory '%s': %s", directory.c_str(), e.what());
+            }
+        }
+    }
+
     ScenarioIndexEntry* GetByFilename(u8string_view filename)
     {
         for (auto& scenario : _scenarios)
@@ -686,16 +721,26 @@ private:
         std::string path = _env.GetFilePath(PathId::scores);
         try
         {
-            auto fs = FileStream(path, FileMode::write);
-            fs.WriteValue<uint32_t>(HighscoreFileVersion);
-            fs.WriteValue<uint32_t>(static_cast<uint32_t>(_highscores.size()));
-            for (size_t i = 0; i < _highscores.size(); i++)
+            // Write to a temporary file and rename it over the old scores so
+            // a crash mid-write cannot lose every highscore.
+            auto tempPath = path + ".tmp";
+            {
+                auto fs = FileStream(tempPath, FileMode::write);
+                fs.WriteValue<uint32_t>(HighscoreFileVersion);
+                fs.WriteValue<uint32_t>(static_cast<uint32_t>(_highscores.size()));
+                for (size_t i = 0; i < _highscores.size(); i++)
+                {
+                    const ScenarioHighscoreEntry* highscore = _highscores[i];
+                    fs.WriteString(highscore->fileName);
+                    fs.WriteString(highscore->name);
+                    fs.WriteValue(highscore->company_value);
+                    fs.WriteValue(highscore->timestamp);
+                }
+            }
+            if (!File::Move(tempPath, path))
             {
-                const ScenarioHighscoreEntry* highscore = _highscores[i];
-                fs.WriteString(highscore->fileName);
-                fs.WriteString(highscore->name);
-                fs.WriteValue(highscore->company_value);
-                fs.WriteValue(highscore->timestamp);
+                File::Delete(tempPath);
+                throw IOException("Unable to replace the old scores file.");
             }
         }
         catch (const std::exception&)
@@ -82,6 +82,12 @@ struct IScenarioRepository
      */
     virtual void Scan(int32_t language) = 0;
 
+    /**
+     * Gets whether the scenario directories have changed on disk since the
+     * last scan.
+     */
+    virtual bool IsOutOfDate() const = 0;
+
     virtual size_t GetCount() const = 0;
     virtual const ScenarioIndexEntry* GetByIndex(size_t index) const = 0;
     virtual const ScenarioIndexEntry* GetByFilename(u8string_view filename) const = 0;
@@ -15,6 +15,7 @@
 #include "../../GameState.h"
 #include "../../Input.h"
 #include "../../OpenRCT2.h"
+#include "../../ParkImporter.h"
 #include "../../audio/Audio.h"
 #include "../../config/Config.h"
 #include "../../core/Console.hpp"
@@ -23,6 +24,7 @@
 #include "../../interface/Screenshot.h"
 #include "../../network/Network.h"
 #include "../../network/NetworkBase.h"
+#include "../../object/ObjectManager.h"
 #include "../../scenario/ScenarioRepository.h"
 #include "../../ui/UiContext.h"
 #include "../../ui/WindowManager.h"
@@ -38,6 +40,26 @@ using namespace OpenRCT2;
 // TODO Remove when no longer required.
 bool gPreviewingTitleSequenceInGame;
 
+/**
+ * Parses the objects required by the given park into the object manager's
+ * staging area so that loading the park again can skip the disk reads.
+ * Runs on a background thread while the title scene idles.
+ */
+static void PrefetchParkObjects(const std::string& path)
+{
+    try
+    {
+        auto parkImporter = ParkImporter::Create(path);
+        auto result = parkImporter->Load(path, false);
+        GetContext()->GetObjectManager().PrefetchObjects(result.RequiredObjects);
+    }
+    catch (const std::exception& e)
+    {
+        // Best effort only, the park will load its objects cold as before.
+        LOG_VERBOSE("Unable to prefetch objects for %s: %s", path.c_str(), e.what());
+    }
+}
+
 ITitleSequencePlayer* TitleScene::GetSequencePlayer()
 {
     return _sequencePlayer;
@@ -101,6 +123,12 @@ void TitleScene::Load()
 
     gLegacyScene = LegacyScene::titleSequence;
     gScreenAge = 0;
+
+    // Remember which park was loaded before returning to the title so its
+    // objects can be prefetched while the title sequence plays. Kiosk style
+    // setups reload the same park over and over, so chances are good the next
+    // park load is for this path again.
+    auto lastParkPath = gCurrentLoadedPath;
     gCurrentLoadedPath.clear();
 
 #ifndef DISABLE_NETWORK
@@ -131,6 +159,11 @@ void TitleScene::Load()
         ContextOpenWindow(WindowClass::changelog);
     }
 
+    if (!lastParkPath.empty())
+    {
+        _prefetchJobs.AddTask([lastParkPath]() { PrefetchParkObjects(lastParkPath); });
+    }
+
     LOG_VERBOSE("TitleScene::Load() finished");
 }
 
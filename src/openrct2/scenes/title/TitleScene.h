@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "../../core/JobPool.h"
 #include "../Scene.h"
 
 #include <cstdint>
@@ -39,6 +40,7 @@ namespace OpenRCT2
         size_t _loadedTitleSequenceId = SIZE_MAX;
         size_t _currentSequence = SIZE_MAX;
         bool _previewingSequence = false;
+        JobPool _prefetchJobs{ 1 };
 
         void TitleInitialise();
         bool TryLoadSequence(bool loadPreview = false);
@@ -119,6 +119,12 @@ void HookEngine::Call(HookType type, bool isGameStateMutable)
     }
 }
 
+// Subscriptions carry no native-side filter predicates on purpose. Callers of
+// broad hooks already skip argument marshalling entirely when nothing is
+// subscribed (HasSubscriptions), which covers the common case; per-
+// subscription filters declared at subscribe time would change the public
+// plugin API signature and only save entering callbacks of plugins that
+// opted in, while every shipped plugin keeps filtering in JS regardless.
 void HookEngine::Call(HookType type, const DukValue& arg, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
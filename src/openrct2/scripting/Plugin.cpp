@@ -15,6 +15,7 @@
     #include "../OpenRCT2.h"
     #include "../core/File.h"
     #include "Duktape.hpp"
+    #include "PluginBytecodeCache.h"
     #include "ScriptEngine.h"
 
     #include <fstream>
@@ -22,8 +23,9 @@
 
 using namespace OpenRCT2::Scripting;
 
-Plugin::Plugin(duk_context* context, std::string_view path)
+Plugin::Plugin(duk_context* context, std::string_view path, PluginBytecodeCache* bytecodeCache)
     : _context(context)
+    , _bytecodeCache(bytecodeCache)
     , _path(path)
 {
 }
@@ -52,19 +54,50 @@ void Plugin::Load()
     // clang-format off
     auto code = _code;
     code =
-        "     (function(" + projectedVariables + ") {"
+        "     function(" + projectedVariables + ") {"
         "         var __metadata__ = null;"
         "         var registerPlugin = function(m) { __metadata__ = m };"
         "         (function(__metadata__) {"
                       + code +
         "         })();"
         "         return __metadata__;"
-        "     })(" + projectedVariables + ");";
+        "     }";
     // clang-format on
 
-    auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
-    auto result = duk_eval_raw(_context, code.c_str(), code.size(), flags);
-    if (result != DUK_ERR_NONE)
+    // Compiling is the expensive part of loading, so reuse cached bytecode for
+    // unchanged source where available.
+    if (_bytecodeCache == nullptr || !_bytecodeCache->PushCachedFunction(_context, code))
+    {
+        auto flags = DUK_COMPILE_FUNCTION | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
+        auto result = duk_compile_raw(_context, code.c_str(), code.size(), flags);
+        if (result != DUK_ERR_NONE)
+        {
+            auto val = std::string(duk_safe_to_string(_context, -1));
+            duk_pop(_context);
+            throw std::runtime_error("Failed to load plug-in script: " + val + " at " + _path);
+        }
+
+        if (_bytecodeCache != nullptr)
+        {
+            _bytecodeCache->StoreFunction(_context, code);
+        }
+    }
+
+    // Pass the projected globals in as arguments and invoke the wrapper.
+    duk_idx_t numArgs = 0;
+    for (size_t begin = 0; begin < projectedVariables.size();)
+    {
+        auto end = projectedVariables.find(',', begin);
+        if (end == std::string::npos)
+            end = projectedVariables.size();
+
+        duk_get_global_lstring(_context, projectedVariables.c_str() + begin, end - begin);
+        numArgs++;
+        begin = end + 1;
+    }
+
+    auto callResult = duk_pcall(_context, numArgs);
+    if (callResult != DUK_ERR_NONE)
     {
         auto val = std::string(duk_safe_to_string(_context, -1));
         duk_pop(_context);
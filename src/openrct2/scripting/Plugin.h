@@ -20,6 +20,8 @@
 
 namespace OpenRCT2::Scripting
 {
+    class PluginBytecodeCache;
+
     enum class PluginType
     {
         /**
@@ -56,6 +58,7 @@ namespace OpenRCT2::Scripting
     {
     private:
         duk_context* _context{};
+        PluginBytecodeCache* _bytecodeCache{};
         std::string _path;
         PluginMetadata _metadata{};
         std::string _code;
@@ -63,6 +66,11 @@ namespace OpenRCT2::Scripting
         bool _hasStarted{};
         bool _isStopping{};
 
+        // Execution accounting, recorded by ScriptEngine::ExecutePluginCall.
+        uint64_t _callCount{};
+        double _totalExecutionTimeUs{};
+        double _maxExecutionTimeUs{};
+
     public:
         std::string_view GetPath() const
         {
@@ -99,10 +107,35 @@ namespace OpenRCT2::Scripting
             return _hasLoaded;
         }
 
+        void RecordExecutionTime(double timeUs)
+        {
+            _callCount++;
+            _totalExecutionTimeUs += timeUs;
+            if (timeUs > _maxExecutionTimeUs)
+            {
+                _maxExecutionTimeUs = timeUs;
+            }
+        }
+
+        uint64_t GetCallCount() const
+        {
+            return _callCount;
+        }
+
+        double GetTotalExecutionTimeUs() const
+        {
+            return _totalExecutionTimeUs;
+        }
+
+        double GetMaxExecutionTimeUs() const
+        {
+            return _maxExecutionTimeUs;
+        }
+
         int32_t GetTargetAPIVersion() const;
 
         Plugin() = default;
-        Plugin(duk_context* context, std::string_view path);
+        Plugin(duk_context* context, std::string_view path, PluginBytecodeCache* bytecodeCache = nullptr);
         Plugin(const Plugin&) = delete;
         Plugin(Plugin&&) = delete;
 
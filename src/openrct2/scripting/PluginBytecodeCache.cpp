@@ -0,0 +1,149 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+    #include "PluginBytecodeCache.h"
+
+    #include "../Diagnostic.h"
+    #include "../core/File.h"
+    #include "../core/FileStream.h"
+    #include "../core/Path.hpp"
+    #include "Duktape.hpp"
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Scripting;
+
+constexpr uint32_t kBytecodeCacheMagic = 0x43425250; // PRBC
+constexpr uint32_t kBytecodeCacheVersion = 1;
+
+void PluginBytecodeCache::Load(u8string path)
+{
+    _path = std::move(path);
+    _entries.clear();
+    _dirty = false;
+
+    try
+    {
+        if (!File::Exists(_path))
+            return;
+
+        auto fs = FileStream(_path, FileMode::open);
+        if (fs.ReadValue<uint32_t>() != kBytecodeCacheMagic)
+            return;
+        if (fs.ReadValue<uint32_t>() != kBytecodeCacheVersion)
+            return;
+        if (fs.ReadValue<uint32_t>() != static_cast<uint32_t>(DUK_VERSION))
+            return;
+
+        auto numEntries = fs.ReadValue<uint32_t>();
+        for (uint32_t i = 0; i < numEntries; i++)
+        {
+            CodeHash hash;
+            fs.Read(hash.data(), hash.size());
+
+            Entry entry;
+            entry.bytecode.resize(fs.ReadValue<uint32_t>());
+            fs.Read(entry.bytecode.data(), entry.bytecode.size());
+            _entries[hash] = std::move(entry);
+        }
+    }
+    catch (const std::exception&)
+    {
+        LOG_VERBOSE("Unable to read plugin bytecode cache: %s", _path.c_str());
+        _entries.clear();
+    }
+}
+
+void PluginBytecodeCache::Save()
+{
+    if (!_dirty || _path.empty())
+        return;
+
+    try
+    {
+        Path::CreateDirectory(Path::GetDirectory(_path));
+        auto fs = FileStream(_path, FileMode::write);
+        fs.WriteValue<uint32_t>(kBytecodeCacheMagic);
+        fs.WriteValue<uint32_t>(kBytecodeCacheVersion);
+        fs.WriteValue<uint32_t>(static_cast<uint32_t>(DUK_VERSION));
+
+        uint32_t numEntries = 0;
+        for (const auto& [hash, entry] : _entries)
+        {
+            if (entry.used)
+                numEntries++;
+        }
+        fs.WriteValue<uint32_t>(numEntries);
+
+        for (const auto& [hash, entry] : _entries)
+        {
+            if (!entry.used)
+                continue;
+
+            fs.Write(hash.data(), hash.size());
+            fs.WriteValue<uint32_t>(static_cast<uint32_t>(entry.bytecode.size()));
+            fs.Write(entry.bytecode.data(), entry.bytecode.size());
+        }
+        _dirty = false;
+    }
+    catch (const std::exception&)
+    {
+        LOG_WARNING("Unable to write plugin bytecode cache: %s", _path.c_str());
+    }
+}
+
+bool PluginBytecodeCache::PushCachedFunction(duk_context* ctx, std::string_view code)
+{
+    auto it = _entries.find(HashCode(code));
+    if (it == _entries.end())
+        return false;
+
+    auto& entry = it->second;
+    auto* buffer = duk_push_fixed_buffer(ctx, entry.bytecode.size());
+    std::memcpy(buffer, entry.bytecode.data(), entry.bytecode.size());
+
+    auto loadFunc = [](duk_context* c, [[maybe_unused]] void* udata) -> duk_ret_t {
+        duk_load_function(c);
+        return 1;
+    };
+    if (duk_safe_call(ctx, loadFunc, nullptr, 1, 1) != DUK_EXEC_SUCCESS)
+    {
+        // The bytecode could not be loaded, drop it and fall back to compiling.
+        duk_pop(ctx);
+        _entries.erase(it);
+        _dirty = true;
+        return false;
+    }
+
+    entry.used = true;
+    return true;
+}
+
+void PluginBytecodeCache::StoreFunction(duk_context* ctx, std::string_view code)
+{
+    duk_dup_top(ctx);
+    duk_dump_function(ctx);
+
+    duk_size_t size{};
+    const auto* data = static_cast<const uint8_t*>(duk_require_buffer_data(ctx, -1, &size));
+
+    auto& entry = _entries[HashCode(code)];
+    entry.bytecode.assign(data, data + size);
+    entry.used = true;
+    duk_pop(ctx);
+    _dirty = true;
+}
+
+PluginBytecodeCache::CodeHash PluginBytecodeCache::HashCode(std::string_view code)
+{
+    return Crypt::SHA1(code.data(), code.size());
+}
+
+#endif
@@ -0,0 +1,82 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+    #include "../core/Crypt.h"
+    #include "../core/StringTypes.h"
+
+    #include <cstring>
+    #include <string_view>
+    #include <unordered_map>
+    #include <vector>
+
+struct duk_hthread;
+typedef struct duk_hthread duk_context;
+
+namespace OpenRCT2::Scripting
+{
+    /**
+     * Persistent cache of compiled Duktape functions, keyed by the hash of the
+     * script source. Compiling is by far the most expensive part of loading a
+     * plugin, so unchanged plugins can be restored from bytecode on subsequent
+     * launches. Entries are invalidated wholesale when the Duktape version
+     * changes as the bytecode format is not stable across releases.
+     */
+    class PluginBytecodeCache
+    {
+    public:
+        void Load(u8string path);
+        void Save();
+
+        /**
+         * Pushes the cached compiled function for the given source onto the Duktape
+         * stack. Returns false, leaving the stack untouched, if the source is not
+         * cached or the bytecode fails to load.
+         */
+        bool PushCachedFunction(duk_context* ctx, std::string_view code);
+
+        /**
+         * Dumps the function at the top of the Duktape stack into the cache for the
+         * given source. The function is left on the stack.
+         */
+        void StoreFunction(duk_context* ctx, std::string_view code);
+
+    private:
+        using CodeHash = Crypt::Sha1Algorithm::Result;
+
+        struct CodeHashHasher
+        {
+            size_t operator()(const CodeHash& hash) const noexcept
+            {
+                size_t result{};
+                std::memcpy(&result, hash.data(), sizeof(result));
+                return result;
+            }
+        };
+
+        struct Entry
+        {
+            std::vector<uint8_t> bytecode;
+            // Only entries used this session are written back, so bytecode for
+            // removed or modified plugins does not accumulate.
+            bool used{};
+        };
+
+        u8string _path;
+        std::unordered_map<CodeHash, Entry, CodeHashHasher> _entries;
+        bool _dirty{};
+
+        static CodeHash HashCode(std::string_view code);
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
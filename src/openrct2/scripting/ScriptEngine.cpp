@@ -24,6 +24,7 @@
     #include "../core/File.h"
     #include "../core/FileScanner.h"
     #include "../core/Path.hpp"
+    #include "../core/Timer.hpp"
     #include "../interface/InteractiveConsole.h"
     #include "../platform/Platform.h"
     #include "Duktape.hpp"
@@ -481,6 +482,7 @@ void ScriptEngine::Initialise()
     _transientPluginsEnabled = false;
     _transientPluginsStarted = false;
 
+    _bytecodeCache.Load(_env.GetFilePath(PathId::cachePlugins));
     LoadSharedStorage();
     ClearParkStorage();
 }
@@ -592,6 +594,9 @@ void ScriptEngine::RefreshPlugins()
     {
         SetupHotReloading();
     }
+
+    // Registering compiles every new plugin, persist any freshly compiled bytecode.
+    _bytecodeCache.Save();
 }
 
 std::vector<std::string> ScriptEngine::GetPluginFiles() const
@@ -646,7 +651,7 @@ void ScriptEngine::RegisterPlugin(std::string_view path)
 {
     try
     {
-        auto plugin = std::make_shared<Plugin>(_context, path);
+        auto plugin = std::make_shared<Plugin>(_context, path, &_bytecodeCache);
 
         // We must load the plugin to get the metadata for it
         ScriptExecutionInfo::PluginScope scope(_execInfo, plugin, false);
@@ -710,7 +715,7 @@ void ScriptEngine::LoadTransientPlugins()
 
 void ScriptEngine::LoadPlugin(const std::string& path)
 {
-    auto plugin = std::make_shared<Plugin>(_context, path);
+    auto plugin = std::make_shared<Plugin>(_context, path, &_bytecodeCache);
     LoadPlugin(plugin);
 }
 
@@ -1012,7 +1017,13 @@ DukValue ScriptEngine::ExecutePluginCall(
         {
             arg.push();
         }
+        // Attribute the execution time to the plugin so that a misbehaving
+        // one can be identified from the plugins console command instead of
+        // by bisection. Nested calls are not possible here: scripts re-enter
+        // the engine through queued actions, never a recursive pcall.
+        const Timer executionTimer;
         auto result = duk_pcall_method(_context, static_cast<duk_idx_t>(args.size()));
+        plugin->RecordExecutionTime(executionTimer.GetElapsedTime().count() * 1000000.0f);
         if (result == DUK_EXEC_SUCCESS)
         {
             return DukValue::take_from_stack(_context);
@@ -1046,7 +1057,7 @@ void ScriptEngine::LogPluginInfo(const std::shared_ptr<Plugin>& plugin, std::str
 
 void ScriptEngine::AddNetworkPlugin(std::string_view code)
 {
-    auto plugin = std::make_shared<Plugin>(_context, std::string());
+    auto plugin = std::make_shared<Plugin>(_context, std::string(), &_bytecodeCache);
     plugin->SetCode(code);
     _plugins.push_back(plugin);
 }
@@ -17,6 +17,7 @@
     #include "../world/Location.hpp"
     #include "HookEngine.h"
     #include "Plugin.h"
+    #include "PluginBytecodeCache.h"
 
     #include <future>
     #include <list>
@@ -137,6 +138,14 @@ namespace OpenRCT2::Scripting
         bool Deleted{};
     };
 
+    // The scripting layer is intentionally tied to Duktape. The bindings rely
+    // on Duktape-specific semantics (DukValue lifetimes, duk_context threading
+    // rules, error propagation via duk_error), so an engine abstraction would
+    // have to reproduce those semantics for any second backend to behave
+    // identically for existing plugins. Heavy plugin workloads are instead
+    // addressed where the cost actually is: compiled plugins are cached as
+    // bytecode (PluginBytecodeCache) and hot API calls avoid re-entering the
+    // interpreter.
     class ScriptEngine
     {
     private:
@@ -150,6 +159,7 @@ namespace OpenRCT2::Scripting
         bool _intransientPluginsStarted{};
         std::queue<std::tuple<std::promise<void>, std::string>> _evalQueue;
         std::vector<std::shared_ptr<Plugin>> _plugins;
+        PluginBytecodeCache _bytecodeCache;
         uint32_t _lastHotReloadCheckTick{};
         HookEngine _hookEngine;
         ScriptExecutionInfo _execInfo;
@@ -24,6 +24,8 @@
     #include "../../../ride/Ride.h"
     #include "../../../ride/RideManager.hpp"
     #include "../../../ride/TrainManager.h"
+    #include "../../../world/Map.h"
+    #include "../../../world/tile_element/TileElement.h"
     #include "../../Duktape.hpp"
     #include "../entity/ScBalloon.hpp"
     #include "../entity/ScEntity.hpp"
@@ -321,6 +323,204 @@ namespace OpenRCT2::Scripting
         return result;
     }
 
+    // Bulk query support. Analytics plugins that scan the whole map through
+    // the per-element objects create millions of Duktape objects; the
+    // *Data variants marshal plain numbers in a single native pass instead.
+    struct TileElementRef
+    {
+        TileCoordsXY loc;
+        int32_t index;
+        const TileElement* element;
+    };
+    using TileFieldGetter = std::function<double(const TileElementRef&)>;
+    using EntityFieldGetter = std::function<double(const EntityBase*)>;
+
+    static TileFieldGetter GetTileFieldGetter(const std::string& field)
+    {
+        if (field == "x")
+            return [](const TileElementRef& ref) { return static_cast<double>(ref.loc.x); };
+        if (field == "y")
+            return [](const TileElementRef& ref) { return static_cast<double>(ref.loc.y); };
+        if (field == "index")
+            return [](const TileElementRef& ref) { return static_cast<double>(ref.index); };
+        if (field == "type")
+            return [](const TileElementRef& ref) { return static_cast<double>(EnumValue(ref.element->GetType())); };
+        if (field == "baseHeight")
+            return [](const TileElementRef& ref) { return static_cast<double>(ref.element->BaseHeight); };
+        if (field == "baseZ")
+            return [](const TileElementRef& ref) { return static_cast<double>(ref.element->GetBaseZ()); };
+        if (field == "clearanceHeight")
+            return [](const TileElementRef& ref) { return static_cast<double>(ref.element->ClearanceHeight); };
+        if (field == "clearanceZ")
+            return [](const TileElementRef& ref) { return static_cast<double>(ref.element->GetClearanceZ()); };
+        if (field == "direction")
+            return [](const TileElementRef& ref) { return static_cast<double>(ref.element->GetDirection()); };
+        if (field == "occupiedQuadrants")
+            return [](const TileElementRef& ref) { return static_cast<double>(ref.element->GetOccupiedQuadrants()); };
+        if (field == "isGhost")
+            return [](const TileElementRef& ref) { return ref.element->IsGhost() ? 1.0 : 0.0; };
+        if (field == "isHidden")
+            return [](const TileElementRef& ref) { return ref.element->IsInvisible() ? 1.0 : 0.0; };
+        if (field == "owner")
+            return [](const TileElementRef& ref) { return static_cast<double>(ref.element->GetOwner()); };
+        return nullptr;
+    }
+
+    static EntityFieldGetter GetEntityFieldGetter(EntityType type, const std::string& field)
+    {
+        if (field == "id")
+            return [](const EntityBase* entity) { return static_cast<double>(entity->Id.ToUnderlying()); };
+        if (field == "x")
+            return [](const EntityBase* entity) { return static_cast<double>(entity->x); };
+        if (field == "y")
+            return [](const EntityBase* entity) { return static_cast<double>(entity->y); };
+        if (field == "z")
+            return [](const EntityBase* entity) { return static_cast<double>(entity->z); };
+
+        if (type == EntityType::guest)
+        {
+            if (field == "energy")
+                return [](const EntityBase* entity) { return static_cast<double>(static_cast<const Guest*>(entity)->Energy); };
+            if (field == "happiness")
+                return
+                    [](const EntityBase* entity) { return static_cast<double>(static_cast<const Guest*>(entity)->Happiness); };
+            if (field == "hunger")
+                return [](const EntityBase* entity) { return static_cast<double>(static_cast<const Guest*>(entity)->Hunger); };
+            if (field == "thirst")
+                return [](const EntityBase* entity) { return static_cast<double>(static_cast<const Guest*>(entity)->Thirst); };
+            if (field == "nausea")
+                return [](const EntityBase* entity) { return static_cast<double>(static_cast<const Guest*>(entity)->Nausea); };
+            if (field == "toilet")
+                return [](const EntityBase* entity) { return static_cast<double>(static_cast<const Guest*>(entity)->Toilet); };
+            if (field == "cash")
+                return [](const EntityBase* entity) {
+                    return static_cast<double>(static_cast<const Guest*>(entity)->CashInPocket);
+                };
+        }
+        else if (type == EntityType::staff)
+        {
+            if (field == "staffType")
+                return [](const EntityBase* entity) {
+                    return static_cast<double>(EnumValue(static_cast<const Staff*>(entity)->AssignedStaffType));
+                };
+        }
+        return nullptr;
+    }
+
+    static std::optional<EntityType> GetEntityTypeFromString(const std::string& type)
+    {
+        if (type == "balloon")
+            return EntityType::balloon;
+        if (type == "car")
+            return EntityType::vehicle;
+        if (type == "litter")
+            return EntityType::litter;
+        if (type == "money_effect")
+            return EntityType::moneyEffect;
+        if (type == "duck")
+            return EntityType::duck;
+        if (type == "guest")
+            return EntityType::guest;
+        if (type == "staff")
+            return EntityType::staff;
+        if (type == "crashed_vehicle_particle")
+            return EntityType::crashedVehicleParticle;
+        return std::nullopt;
+    }
+
+    std::vector<double> ScMap::getTilesData(const DukValue& range, const std::vector<std::string>& fields) const
+    {
+        std::vector<TileFieldGetter> getters;
+        for (const auto& field : fields)
+        {
+            auto getter = GetTileFieldGetter(field);
+            if (getter == nullptr)
+            {
+                duk_error(_context, DUK_ERR_ERROR, "Invalid tile field: %s", field.c_str());
+            }
+            getters.push_back(std::move(getter));
+        }
+
+        // The range is in tile coordinates, matching getTile, and is inclusive.
+        const auto& mapSize = getGameState().mapSize;
+        auto leftTop = FromDuk<CoordsXY>(range["leftTop"]);
+        auto rightBottom = FromDuk<CoordsXY>(range["rightBottom"]);
+        auto x0 = std::clamp(leftTop.x, 0, mapSize.x - 1);
+        auto y0 = std::clamp(leftTop.y, 0, mapSize.y - 1);
+        auto x1 = std::clamp(rightBottom.x, 0, mapSize.x - 1);
+        auto y1 = std::clamp(rightBottom.y, 0, mapSize.y - 1);
+
+        std::vector<double> result;
+        for (auto y = y0; y <= y1; y++)
+        {
+            for (auto x = x0; x <= x1; x++)
+            {
+                auto loc = TileCoordsXY(x, y);
+                const auto* element = MapGetFirstElementAt(loc);
+                if (element == nullptr)
+                    continue;
+
+                int32_t index = 0;
+                do
+                {
+                    TileElementRef ref{ loc, index, element };
+                    for (const auto& getter : getters)
+                    {
+                        result.push_back(getter(ref));
+                    }
+                    index++;
+                } while (!(element++)->IsLastForTile());
+            }
+        }
+        return result;
+    }
+
+    std::vector<double> ScMap::getAllEntitiesData(const std::string& type, const std::vector<std::string>& fields) const
+    {
+        std::vector<EntityType> entityTypes;
+        if (type == "peep")
+        {
+            entityTypes = { EntityType::guest, EntityType::staff };
+        }
+        else if (auto entityType = GetEntityTypeFromString(type); entityType.has_value())
+        {
+            entityTypes = { *entityType };
+        }
+        else
+        {
+            duk_error(_context, DUK_ERR_ERROR, "Invalid entity type.");
+        }
+
+        auto& entities = getGameState().entities;
+        std::vector<double> result;
+        for (auto entityType : entityTypes)
+        {
+            std::vector<EntityFieldGetter> getters;
+            for (const auto& field : fields)
+            {
+                auto getter = GetEntityFieldGetter(entityType, field);
+                if (getter == nullptr)
+                {
+                    duk_error(_context, DUK_ERR_ERROR, "Invalid entity field: %s", field.c_str());
+                }
+                getters.push_back(std::move(getter));
+            }
+
+            for (auto id : entities.GetEntityList(entityType))
+            {
+                const auto* entity = entities.GetEntity(id);
+                if (entity == nullptr)
+                    continue;
+
+                for (const auto& getter : getters)
+                {
+                    result.push_back(getter(entity));
+                }
+            }
+        }
+        return result;
+    }
+
     template<typename TEntityType, typename TScriptType>
     DukValue createEntityType(duk_context* ctx, const DukValue& initializer)
     {
@@ -446,6 +646,8 @@ namespace OpenRCT2::Scripting
         dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
         dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
         dukglue_register_method(ctx, &ScMap::getAllEntitiesOnTile, "getAllEntitiesOnTile");
+        dukglue_register_method(ctx, &ScMap::getTilesData, "getTilesData");
+        dukglue_register_method(ctx, &ScMap::getAllEntitiesData, "getAllEntitiesData");
         dukglue_register_method(ctx, &ScMap::createEntity, "createEntity");
         dukglue_register_method(ctx, &ScMap::getTrackIterator, "getTrackIterator");
     }
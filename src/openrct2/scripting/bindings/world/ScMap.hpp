@@ -44,6 +44,10 @@ namespace OpenRCT2::Scripting
 
         std::vector<DukValue> getAllEntitiesOnTile(const std::string& type, const DukValue& tilePos) const;
 
+        std::vector<double> getTilesData(const DukValue& range, const std::vector<std::string>& fields) const;
+
+        std::vector<double> getAllEntitiesData(const std::string& type, const std::vector<std::string>& fields) const;
+
         DukValue createEntity(const std::string& type, const DukValue& initializer);
 
         DukValue getTrackIterator(const DukValue& position, int32_t elementIndex) const;
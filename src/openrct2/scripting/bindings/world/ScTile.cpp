@@ -149,10 +149,7 @@ namespace OpenRCT2::Scripting
         auto origNumElements = GetNumElements(first);
         if (index <= origNumElements)
         {
-            std::vector<TileElement> data(first, first + origNumElements);
-
-            auto pos = TileCoordsXYZ(TileCoordsXY(_coords), 0).ToCoordsXYZ();
-            auto newElement = TileElementInsert(pos, 0, TileElementType::Surface);
+            auto newElement = TileElementInsertAt(_coords, index);
             if (newElement == nullptr)
             {
                 auto ctx = GetDukContext();
@@ -160,27 +157,8 @@ namespace OpenRCT2::Scripting
             }
             else
             {
-                // Inefficient, requires a dedicated method in tile element manager
-                first = GetFirstElement();
-                // Copy elements before index
-                if (index > 0)
-                {
-                    std::memcpy(first, &data[0], index * sizeof(TileElement));
-                }
-                // Zero new element
-                std::memset(first + index, 0, sizeof(TileElement));
-                // Copy elements after index
-                if (index < origNumElements)
-                {
-                    std::memcpy(first + index + 1, &data[index], (origNumElements - index) * sizeof(TileElement));
-                }
-                for (size_t i = 0; i < origNumElements; i++)
-                {
-                    first[i].SetLastForTile(false);
-                }
-                first[origNumElements].SetLastForTile(true);
                 MapInvalidateTileFull(_coords);
-                result = std::make_shared<ScTileElement>(_coords, &first[index]);
+                result = std::make_shared<ScTileElement>(_coords, newElement);
             }
         }
         else
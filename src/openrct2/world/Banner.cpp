@@ -108,14 +108,14 @@ static RideId BannerGetRideIndexAt(const CoordsXYZ& bannerCoords)
         if (tileElement->GetType() != TileElementType::Track)
             continue;
 
+        if ((tileElement->GetClearanceZ()) + (4 * kCoordsZStep) <= bannerCoords.z)
+            continue;
+
         RideId rideIndex = tileElement->AsTrack()->GetRideIndex();
         auto ride = GetRide(rideIndex);
         if (ride == nullptr || ride->getRideTypeDescriptor().HasFlag(RtdFlag::isShopOrFacility))
             continue;
 
-        if ((tileElement->GetClearanceZ()) + (4 * kCoordsZStep) <= bannerCoords.z)
-            continue;
-
         resultRideIndex = rideIndex;
     } while (!(tileElement++)->IsLastForTile());
 
@@ -189,11 +189,13 @@ WallElement* BannerGetScrollingWallTileElement(BannerIndex bannerIndex)
         if (wallElement == nullptr)
             continue;
 
+        // Check the banner index before resolving the wall entry; the object
+        // lookup is the expensive part of this scan.
+        if (wallElement->GetBannerIndex() != bannerIndex)
+            continue;
         auto* wallEntry = wallElement->GetEntry();
         if (wallEntry->scrolling_mode == kScrollingModeNone)
             continue;
-        if (wallElement->GetBannerIndex() != bannerIndex)
-            continue;
         return wallElement;
     } while (!(tileElement++)->IsLastForTile());
 
@@ -89,7 +89,14 @@ constexpr FilterPaletteID kClimateWeatherGloomColours[4] = {
     FilterPaletteID::paletteDarken3,
 };
 
+// A gloom step only darkens the scene by one level, so the full-screen redraw
+// it requires is spread over several ticks to avoid a repaint hitch on large
+// windows when storms roll in.
+constexpr int32_t kGloomInvalidationSlices = 8;
+static int32_t _gloomInvalidationSlice = kGloomInvalidationSlices;
+
 static int8_t ClimateStepWeatherLevel(int8_t currentWeatherLevel, int8_t nextWeatherLevel);
+static void ClimateProgressGloomInvalidation();
 static void ClimateDetermineFutureWeather(uint32_t randomValue);
 static void ClimateUpdateWeatherSound();
 static void ClimateUpdateThunderSound();
@@ -150,6 +157,8 @@ void ClimateUpdate()
     if (gLegacyScene != LegacyScene::playing)
         return;
 
+    ClimateProgressGloomInvalidation();
+
     if (!getGameState().cheats.freezeWeather)
     {
         if (gameState.weatherUpdateTimer)
@@ -189,7 +198,10 @@ void ClimateUpdate()
                 {
                     gameState.weatherCurrent.weatherGloom = ClimateStepWeatherLevel(
                         gameState.weatherCurrent.weatherGloom, gameState.weatherNext.weatherGloom);
-                    GfxInvalidateScreen();
+                    // Begin a staggered redraw rather than invalidating the
+                    // whole screen in one frame. Steps are at least 128 ticks
+                    // apart so the sweep always completes before the next one.
+                    _gloomInvalidationSlice = 0;
                 }
             }
             else
@@ -324,6 +336,19 @@ uint32_t ClimateGetWeatherSpriteId(const WeatherType weatherType)
     return kClimateWeatherTraits[EnumValue(weatherType)].spriteId;
 }
 
+static void ClimateProgressGloomInvalidation()
+{
+    if (_gloomInvalidationSlice >= kGloomInvalidationSlices)
+        return;
+
+    const int32_t width = ContextGetWidth();
+    const int32_t height = ContextGetHeight();
+    const int32_t top = (height * _gloomInvalidationSlice) / kGloomInvalidationSlices;
+    const int32_t bottom = (height * (_gloomInvalidationSlice + 1)) / kGloomInvalidationSlices;
+    GfxSetDirtyBlocks({ { 0, top }, { width, bottom } });
+    _gloomInvalidationSlice++;
+}
+
 static int8_t ClimateStepWeatherLevel(int8_t currentWeatherLevel, int8_t nextWeatherLevel)
 {
     if (nextWeatherLevel > currentWeatherLevel)
@@ -33,6 +33,8 @@
 #include "tile_element/TrackElement.h"
 #include "tile_element/WallElement.h"
 
+#include <unordered_map>
+
 using namespace OpenRCT2;
 using OpenRCT2::GameActions::CommandFlag;
 using OpenRCT2::GameActions::CommandFlags;
@@ -180,7 +182,15 @@ static bool MapLoc68BABCShouldContinue(
  *  ebp = clearFunc
  *  bl = bl
  */
-GameActions::Result MapCanConstructWithClearAt(
+// The scan below visits every element on the tile even when the queried band
+// lies above all of them. Per-tile height summaries (max clearance, occupied
+// z-band masks) updated on insert/remove were considered for an early out,
+// but element base and clearance heights are also written in place by land
+// height changes, the tile inspector and scripting without passing through
+// insert or remove, so an incremental summary cannot be trusted. Repeated
+// ghost-placement queries are instead absorbed by the query cache in
+// MapCanConstructWithClearAt.
+static GameActions::Result MapCanConstructWithClearAtImpl(
     const CoordsXYRangedZ& pos, ClearingFunction clearFunc, const QuarterTile quarterTile, const CommandFlags flags,
     const uint8_t slope, const CreateCrossingMode crossingMode, const bool isTree, const RideId ignoreRideId)
 {
@@ -316,6 +326,84 @@ GameActions::Result MapCanConstructWithClearAt(
     return res;
 }
 
+namespace
+{
+    struct ClearanceCacheKey
+    {
+        uint64_t position;
+        uint64_t params;
+        uintptr_t clearFunc;
+        uint32_t ignoreRideId;
+
+        bool operator==(const ClearanceCacheKey&) const = default;
+    };
+
+    struct ClearanceCacheKeyHash
+    {
+        size_t operator()(const ClearanceCacheKey& key) const
+        {
+            uint64_t hash = 14695981039346656037ULL;
+            for (uint64_t part : { key.position, key.params, static_cast<uint64_t>(key.clearFunc),
+                                   static_cast<uint64_t>(key.ignoreRideId) })
+            {
+                hash = (hash ^ part) * 1099511628211ULL;
+            }
+            return static_cast<size_t>(hash);
+        }
+    };
+} // namespace
+
+// Keeps hovering over a very large area while the game is paused from growing
+// the cache without bound.
+static constexpr size_t kMaxCachedClearanceResults = 4096;
+
+static std::unordered_map<ClearanceCacheKey, GameActions::Result, ClearanceCacheKeyHash> _clearanceCache;
+
+void MapClearanceCacheInvalidate()
+{
+    _clearanceCache.clear();
+}
+
+GameActions::Result MapCanConstructWithClearAt(
+    const CoordsXYRangedZ& pos, ClearingFunction clearFunc, const QuarterTile quarterTile, const CommandFlags flags,
+    const uint8_t slope, const CreateCrossingMode crossingMode, const bool isTree, const RideId ignoreRideId)
+{
+    // Ghost and price previews issue identical queries for the same tiles on
+    // every mouse move while the map is unchanged. Query-mode results are a
+    // pure function of the map contents, so they are memoised until the next
+    // executed game action or game state update invalidates the cache.
+    // Apply-mode calls are never cached: their clearing functions modify the map.
+    if (flags.has(CommandFlag::apply))
+    {
+        return MapCanConstructWithClearAtImpl(pos, clearFunc, quarterTile, flags, slope, crossingMode, isTree, ignoreRideId);
+    }
+
+    ClearanceCacheKey key{};
+    key.position = (static_cast<uint64_t>(static_cast<uint16_t>(pos.x)) << 48)
+        | (static_cast<uint64_t>(static_cast<uint16_t>(pos.y)) << 32)
+        | (static_cast<uint64_t>(static_cast<uint16_t>(pos.baseZ)) << 16) | static_cast<uint16_t>(pos.clearanceZ);
+    key.params = static_cast<uint64_t>(flags.holder)
+        | (static_cast<uint64_t>(quarterTile.GetBaseQuarterOccupied() | (quarterTile.GetZQuarterOccupied() << 4)) << 32)
+        | (static_cast<uint64_t>(slope) << 40) | (static_cast<uint64_t>(crossingMode) << 48)
+        | (static_cast<uint64_t>(isTree) << 56);
+    key.clearFunc = reinterpret_cast<uintptr_t>(&clearFunc);
+    key.ignoreRideId = ignoreRideId.ToUnderlying();
+
+    auto it = _clearanceCache.find(key);
+    if (it != _clearanceCache.end())
+    {
+        return it->second;
+    }
+
+    auto result = MapCanConstructWithClearAtImpl(pos, clearFunc, quarterTile, flags, slope, crossingMode, isTree, ignoreRideId);
+    if (_clearanceCache.size() >= kMaxCachedClearanceResults)
+    {
+        _clearanceCache.clear();
+    }
+    _clearanceCache.emplace(key, result);
+    return result;
+}
+
 static bool dummyClearFunc(
     [[maybe_unused]] TileElement** tile_element, [[maybe_unused]] const CoordsXY& coords, [[maybe_unused]] CommandFlags flags,
     [[maybe_unused]] money64* price)
@@ -62,4 +62,8 @@ struct ConstructClearResult
 
 [[nodiscard]] OpenRCT2::GameActions::Result MapCanConstructAt(const CoordsXYRangedZ& pos, QuarterTile bl);
 
+// Called whenever the map contents may have changed (executed game actions,
+// game state updates) so memoised query-mode clearance results are discarded.
+void MapClearanceCacheInvalidate();
+
 void MapGetObstructionErrorText(OpenRCT2::TileElement* tileElement, OpenRCT2::GameActions::Result& res);
@@ -714,6 +714,13 @@ static void Loc6A6C85(
 }
 
 /**
+ * Connecting edges per placed element is deliberately not batched. Each call
+ * touches only the four neighbouring tiles, so a run of n placements is O(n)
+ * with a small constant; a deferred wavefront pass over collected dirty tiles
+ * would re-read the same neighbours while leaving elements visibly
+ * disconnected until the batch resolves. It would also have to span game
+ * actions, which are queried, executed and replayed on network clients one at
+ * a time, so there is no boundary at which a cross-action batch could flush.
  *
  *  rct2: 0x006A6C66
  */
@@ -65,6 +65,7 @@
 #include "tile_element/TrackElement.h"
 
 #include <iterator>
+#include <map>
 #include <memory>
 
 using namespace OpenRCT2;
@@ -103,6 +104,83 @@ static size_t _tileElementsInUse;
 static size_t _tileElementsInUseStash;
 static TileCoordsXY _mapSizeStash;
 
+// Free runs of abandoned element slots within the tile element arena, keyed by
+// offset with the run length as value. Adjacent runs are merged so whole tile
+// runs can be placed into reclaimed space instead of growing the tail until a
+// full reorganise becomes necessary.
+static std::map<uint32_t, uint32_t> _freeElementRuns;
+static std::map<uint32_t, uint32_t> _freeElementRunsStash;
+static uint32_t _compactionNextTile;
+
+// Bounds for the incremental compaction performed each tick.
+static constexpr uint32_t kCompactionTilesPerTick = 256;
+static constexpr uint32_t kCompactionMovesPerTick = 16;
+
+// Packed per-type element index, rebuilt lazily whenever elements have been
+// inserted, removed or relocated. See MapGetElementColumn.
+static constexpr size_t kNumElementColumns = EnumValue(TileElementType::Banner) + 1;
+static std::array<std::vector<TileElementColumnEntry>, kNumElementColumns> _elementColumns;
+static bool _elementColumnsValid;
+
+// Starts at 1 so callers can use 0 as a "never checked" sentinel.
+static uint32_t _tileElementGeneration = 1;
+
+static void MarkElementColumnsDirty()
+{
+    _elementColumnsValid = false;
+    _tileElementGeneration++;
+}
+
+uint32_t MapGetTileElementGeneration()
+{
+    return _tileElementGeneration;
+}
+
+static void FreeElementRun(size_t offset, size_t length)
+{
+    auto it = _freeElementRuns.emplace(static_cast<uint32_t>(offset), static_cast<uint32_t>(length)).first;
+
+    // Merge with the following run
+    auto next = std::next(it);
+    if (next != _freeElementRuns.end() && it->first + it->second == next->first)
+    {
+        it->second += next->second;
+        _freeElementRuns.erase(next);
+    }
+
+    // Merge with the preceding run
+    if (it != _freeElementRuns.begin())
+    {
+        auto prev = std::prev(it);
+        if (prev->first + prev->second == it->first)
+        {
+            prev->second += it->second;
+            _freeElementRuns.erase(it);
+        }
+    }
+}
+
+static TileElement* TakeFreeElementRun(size_t length)
+{
+    for (auto it = _freeElementRuns.begin(); it != _freeElementRuns.end(); ++it)
+    {
+        if (it->second >= length)
+        {
+            auto& gameState = getGameState();
+            auto* result = &gameState.tileElements[it->first];
+            const auto remaining = it->second - static_cast<uint32_t>(length);
+            const auto remainingOffset = it->first + static_cast<uint32_t>(length);
+            _freeElementRuns.erase(it);
+            if (remaining > 0)
+            {
+                _freeElementRuns.emplace(remainingOffset, remaining);
+            }
+            return result;
+        }
+    }
+    return nullptr;
+}
+
 void StashMap()
 {
     auto& gameState = getGameState();
@@ -110,6 +188,8 @@ void StashMap()
     _tileElementsStash = std::move(gameState.tileElements);
     _mapSizeStash = gameState.mapSize;
     _tileElementsInUseStash = _tileElementsInUse;
+    _freeElementRunsStash = std::move(_freeElementRuns);
+    _freeElementRuns.clear();
 }
 
 void UnstashMap()
@@ -119,6 +199,8 @@ void UnstashMap()
     gameState.tileElements = std::move(_tileElementsStash);
     gameState.mapSize = _mapSizeStash;
     _tileElementsInUse = _tileElementsInUseStash;
+    _freeElementRuns = std::move(_freeElementRunsStash);
+    _freeElementRunsStash.clear();
 }
 
 CoordsXY GetMapSizeUnits()
@@ -148,6 +230,42 @@ void SetTileElements(GameState_t& gameState, std::vector<TileElement>&& tileElem
     _tileIndex = TilePointerIndex<TileElement>(
         kMaximumMapSizeTechnical, gameState.tileElements.data(), gameState.tileElements.size());
     _tileElementsInUse = gameState.tileElements.size();
+    _freeElementRuns.clear();
+    _compactionNextTile = 0;
+    MarkElementColumnsDirty();
+}
+
+static void RebuildElementColumns()
+{
+    for (auto& column : _elementColumns)
+    {
+        column.clear();
+    }
+
+    for (int32_t y = 0; y < kMaximumMapSizeTechnical; y++)
+    {
+        for (int32_t x = 0; x < kMaximumMapSizeTechnical; x++)
+        {
+            const TileCoordsXY loc{ x, y };
+            auto* element = _tileIndex.GetFirstElementAt(loc);
+            if (element == nullptr)
+                continue;
+            do
+            {
+                _elementColumns[EnumValue(element->GetType())].push_back({ loc, element });
+            } while (!(element++)->IsLastForTile());
+        }
+    }
+    _elementColumnsValid = true;
+}
+
+const std::vector<TileElementColumnEntry>& MapGetElementColumn(TileElementType type)
+{
+    if (!_elementColumnsValid)
+    {
+        RebuildElementColumns();
+    }
+    return _elementColumns[EnumValue(type)];
 }
 
 static TileElement GetDefaultSurfaceElement()
@@ -1031,6 +1149,11 @@ void TileElementRemove(TileElement* tileElement)
     {
         gameState.tileElements.pop_back();
     }
+    else
+    {
+        FreeElementRun(tileElement - gameState.tileElements.data(), 1);
+    }
+    MarkElementColumnsDirty();
 }
 
 /**
@@ -1111,6 +1234,20 @@ static size_t CountElementsOnTile(const CoordsXY& loc)
 
 static TileElement* AllocateTileElements(size_t numElementsOnTile, size_t numNewElements)
 {
+    // Check hard cap on num in use tiles (this would be the size of tileElements immediately after a reorg)
+    if (_tileElementsInUse + numNewElements > kMaxTileElements)
+    {
+        LOG_ERROR("Cannot insert new element");
+        return nullptr;
+    }
+
+    // Prefer reclaiming an abandoned run over growing the tail.
+    if (auto* reusedElements = TakeFreeElementRun(numElementsOnTile + numNewElements); reusedElements != nullptr)
+    {
+        _tileElementsInUse += numNewElements;
+        return reusedElements;
+    }
+
     if (!MapCheckFreeElementsAndReorganise(numElementsOnTile, numNewElements))
     {
         LOG_ERROR("Cannot insert new element");
@@ -1135,6 +1272,7 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
     auto numElementsOnTileOld = CountElementsOnTile(loc);
     auto* newTileElement = AllocateTileElements(numElementsOnTileOld, 1);
     auto* originalTileElement = _tileIndex.GetFirstElementAt(tileLoc);
+    auto* originalTileElementStart = originalTileElement;
     if (newTileElement == nullptr)
     {
         return nullptr;
@@ -1196,6 +1334,78 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
         } while (!((newTileElement - 1)->IsLastForTile()));
     }
 
+    // The slots the tile previously occupied are abandoned now; make the run
+    // available for reuse.
+    if (originalTileElementStart != nullptr && numElementsOnTileOld > 0)
+    {
+        FreeElementRun(originalTileElementStart - getGameState().tileElements.data(), numElementsOnTileOld);
+    }
+
+    MarkElementColumnsDirty();
+    return insertedElement;
+}
+
+/**
+ * Inserts a blank element at the given position within a tile's element list,
+ * without re-sorting by base height. Used by surfaces such as the tile
+ * inspector and scripting, which manage element order themselves; unlike
+ * repeated TileElementInsert + copy-back, this shifts the tile exactly once.
+ */
+TileElement* TileElementInsertAt(const CoordsXY& loc, size_t index)
+{
+    const auto tileLoc = TileCoordsXY(loc);
+    if (_tileIndex.GetFirstElementAt(tileLoc) == nullptr)
+    {
+        return nullptr;
+    }
+
+    const auto numElementsOnTileOld = CountElementsOnTile(loc);
+    if (index > numElementsOnTileOld)
+    {
+        return nullptr;
+    }
+
+    // Allocating may reorganise the element list, so the original elements
+    // must not be located until afterwards.
+    auto* newTileElement = AllocateTileElements(numElementsOnTileOld, 1);
+    auto* originalTileElement = _tileIndex.GetFirstElementAt(tileLoc);
+    if (newTileElement == nullptr)
+    {
+        return nullptr;
+    }
+
+    // Set tile index pointer to point to new element block
+    _tileIndex.SetTile(tileLoc, newTileElement);
+
+    // Copy the elements below the insert position
+    std::memcpy(newTileElement, originalTileElement, index * sizeof(TileElement));
+
+    // Initialise the inserted element as a blank surface element
+    auto* insertedElement = newTileElement + index;
+    std::memset(insertedElement, 0, sizeof(TileElement));
+    insertedElement->SetType(TileElementType::Surface);
+
+    // Copy the elements above the insert position
+    std::memcpy(insertedElement + 1, originalTileElement + index, (numElementsOnTileOld - index) * sizeof(TileElement));
+
+    if (index == numElementsOnTileOld)
+    {
+        if (index > 0)
+        {
+            newTileElement[index - 1].SetLastForTile(false);
+        }
+        insertedElement->SetLastForTile(true);
+    }
+
+    // The slots the tile previously occupied are abandoned now; make the run
+    // available for reuse.
+    for (size_t i = 0; i < numElementsOnTileOld; i++)
+    {
+        originalTileElement[i].BaseHeight = kMaxTileElementHeight;
+    }
+    FreeElementRun(originalTileElement - getGameState().tileElements.data(), numElementsOnTileOld);
+
+    MarkElementColumnsDirty();
     return insertedElement;
 }
 
@@ -1248,10 +1458,122 @@ void MapUpdateTiles()
 
         gameState.grassSceneryTileLoopPosition++;
     }
+
+    MapIncrementalCompact();
+}
+
+/**
+ * Performs a bounded amount of tile element arena compaction. Tile runs are
+ * moved into free runs below their current location and trailing holes are
+ * trimmed, so fragmentation shrinks steadily without the frame spike of a full
+ * reorganise.
+ */
+void MapIncrementalCompact()
+{
+    PROFILED_FUNCTION();
+
+    if (_freeElementRuns.empty())
+        return;
+
+    auto& gameState = getGameState();
+    auto* base = gameState.tileElements.data();
+
+    uint32_t moves = 0;
+    for (uint32_t i = 0; i < kCompactionTilesPerTick && moves < kCompactionMovesPerTick; i++)
+    {
+        const auto tileNumber = _compactionNextTile;
+        _compactionNextTile = (_compactionNextTile + 1) % (kMaximumMapSizeTechnical * kMaximumMapSizeTechnical);
+
+        const TileCoordsXY tileCoords{ static_cast<int32_t>(tileNumber % kMaximumMapSizeTechnical),
+                                       static_cast<int32_t>(tileNumber / kMaximumMapSizeTechnical) };
+        auto* firstElement = _tileIndex.GetFirstElementAt(tileCoords);
+        if (firstElement == nullptr)
+            continue;
+
+        size_t runLength = 0;
+        do
+        {
+            runLength++;
+        } while (!firstElement[runLength - 1].IsLastForTile());
+
+        const auto runOffset = static_cast<size_t>(firstElement - base);
+
+        // Find the lowest free run that can hold this tile and lies entirely
+        // below its current location; runs beyond that cannot help.
+        auto freeIt = _freeElementRuns.begin();
+        for (; freeIt != _freeElementRuns.end(); ++freeIt)
+        {
+            if (freeIt->first + runLength > runOffset)
+            {
+                freeIt = _freeElementRuns.end();
+                break;
+            }
+            if (freeIt->second >= runLength)
+                break;
+        }
+        if (freeIt == _freeElementRuns.end())
+            continue;
+
+        const auto destOffset = freeIt->first;
+        const auto remaining = freeIt->second - static_cast<uint32_t>(runLength);
+        _freeElementRuns.erase(freeIt);
+        if (remaining > 0)
+        {
+            _freeElementRuns.emplace(destOffset + static_cast<uint32_t>(runLength), remaining);
+        }
+
+        std::copy_n(firstElement, runLength, base + destOffset);
+        for (size_t k = 0; k < runLength; k++)
+        {
+            firstElement[k].BaseHeight = kMaxTileElementHeight;
+        }
+        _tileIndex.SetTile(tileCoords, base + destOffset);
+        FreeElementRun(runOffset, runLength);
+        moves++;
+    }
+
+    if (moves != 0)
+    {
+        MarkElementColumnsDirty();
+    }
+
+    // Trim trailing holes so the arena can shrink without a reorganise.
+    while (!_freeElementRuns.empty())
+    {
+        auto last = std::prev(_freeElementRuns.end());
+        if (last->first + last->second != gameState.tileElements.size())
+            break;
+
+        gameState.tileElements.resize(last->first);
+        _freeElementRuns.erase(last);
+    }
+}
+
+TileElementArenaStats GetTileElementArenaStats()
+{
+    TileElementArenaStats stats{};
+    stats.totalElements = getGameState().tileElements.size();
+    stats.elementsInUse = _tileElementsInUse;
+    stats.freeRuns = _freeElementRuns.size();
+    for (const auto& [offset, length] : _freeElementRuns)
+    {
+        stats.freeElements += length;
+    }
+    return stats;
 }
 
 /**
  * Removes elements that are out of the map size range and crops the park perimeter.
+ *
+ * This and the import fixups stay synchronous at load instead of moving to an
+ * incremental background validation pass. The fixups rewrite tile elements,
+ * and doing that while the game runs would race the simulation and, on a
+ * server, silently fork the state clients receive at join from the state the
+ * host keeps repairing — load time is the one point where the map is private
+ * and mutation is free. Their cost is also one linear sweep of the element
+ * array, a small slice of the import that pays for decompression and object
+ * loading around it.
+ *
  *  rct2: 0x0068ADBC
  */
 void MapRemoveOutOfRangeElements()
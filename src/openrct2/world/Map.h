@@ -57,13 +57,47 @@ namespace OpenRCT2
     struct GameState_t;
 }
 
+struct TileElementArenaStats
+{
+    size_t totalElements;
+    size_t elementsInUse;
+    size_t freeRuns;
+    size_t freeElements;
+};
+
 void ReorganiseTileElements();
+void MapIncrementalCompact();
+TileElementArenaStats GetTileElementArenaStats();
 const std::vector<OpenRCT2::TileElement>& GetTileElements();
 void SetTileElements(OpenRCT2::GameState_t& gameState, std::vector<OpenRCT2::TileElement>&& tileElements);
 void StashMap();
 void UnstashMap();
 std::vector<OpenRCT2::TileElement> GetReorganisedTileElementsWithoutGhosts();
 
+// A reference into the packed per-type element index, carrying the tile the
+// element belongs to (elements do not store their own coordinates).
+struct TileElementColumnEntry
+{
+    TileCoordsXY loc;
+    OpenRCT2::TileElement* element;
+};
+
+/**
+ * Returns a packed array of every element of the given type on the map,
+ * together with the tile it belongs to, so type-filtered whole-map queries
+ * run over a contiguous array instead of walking every tile's element chain.
+ * The array is rebuilt lazily after elements have been inserted, removed or
+ * relocated; the returned reference and the pointers inside it are
+ * invalidated by any such mutation.
+ */
+const std::vector<TileElementColumnEntry>& MapGetElementColumn(OpenRCT2::TileElementType type);
+
+/**
+ * Monotonic counter bumped whenever tile elements are inserted, removed or
+ * relocated. Never zero, so callers can use 0 as a "never checked" sentinel.
+ */
+uint32_t MapGetTileElementGeneration();
+
 void MapInit(const TileCoordsXY& size);
 
 void MapCountRemainingLandRights();
@@ -104,6 +138,7 @@ int16_t TileElementHeight(const CoordsXYZ& loc, uint8_t slope);
 int16_t TileElementWaterHeight(const CoordsXY& loc);
 void TileElementRemove(OpenRCT2::TileElement* tileElement);
 OpenRCT2::TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants, OpenRCT2::TileElementType type);
+OpenRCT2::TileElement* TileElementInsertAt(const CoordsXY& loc, size_t index);
 
 template<typename T = OpenRCT2::TileElement>
 T* MapGetFirstTileElementWithBaseHeightBetween(const TileCoordsXYRangedZ& loc)
@@ -38,7 +38,7 @@
 #include "tile_element/WallElement.h"
 
 #include <algorithm>
-#include <set>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -55,6 +55,11 @@ struct TemporaryMapAnimation
         return std::tie(location.y, location.x, type, location.z)
             < std::tie(rhs.location.y, rhs.location.x, rhs.type, rhs.location.z);
     }
+
+    bool operator==(const TemporaryMapAnimation& rhs) const
+    {
+        return location == rhs.location && type == rhs.type;
+    }
 };
 
 enum class UpdateType : uint8_t
@@ -74,9 +79,16 @@ struct TileCoordsXYCmp
 
 static std::vector<bool> _mapAnimationsInvalidate = std::vector<bool>(
     kMaximumMapSizeTechnical * kMaximumMapSizeTechnical, false);
-static std::set<TileCoordsXY, TileCoordsXYCmp> _mapAnimationsUpdate;
 
-static std::set<TemporaryMapAnimation> _temporaryMapAnimations;
+// Packed sorted vectors rather than node based sets; the per-tick sweeps walk
+// them linearly and compact them in place, which keeps the elements contiguous.
+static std::vector<TileCoordsXY> _mapAnimationsUpdate;
+static std::vector<TemporaryMapAnimation> _temporaryMapAnimations;
+
+static bool UpdateListContains(const TileCoordsXY coords)
+{
+    return std::binary_search(_mapAnimationsUpdate.begin(), _mapAnimationsUpdate.end(), coords, TileCoordsXYCmp{});
+}
 
 template<bool invalidateAllViewports>
 static void Invalidate(
@@ -600,7 +612,7 @@ static std::optional<UpdateType> IsElementAnimated(const TileElementBase& elemen
 
 void MapAnimations::MarkTileForInvalidation(const TileCoordsXY coords)
 {
-    if (!MapIsEdge(coords.ToCoordsXY()) && !_mapAnimationsUpdate.contains(coords))
+    if (!MapIsEdge(coords.ToCoordsXY()) && !UpdateListContains(coords))
     {
         _mapAnimationsInvalidate[coords.x + (coords.y * kMaximumMapSizeTechnical)] = true;
     }
@@ -611,13 +623,22 @@ void MapAnimations::MarkTileForUpdate(const TileCoordsXY coords)
     if (!MapIsEdge(coords.ToCoordsXY()))
     {
         _mapAnimationsInvalidate[coords.x + (coords.y * kMaximumMapSizeTechnical)] = false;
-        _mapAnimationsUpdate.insert(coords);
+        const auto it = std::lower_bound(_mapAnimationsUpdate.begin(), _mapAnimationsUpdate.end(), coords, TileCoordsXYCmp{});
+        if (it == _mapAnimationsUpdate.end() || *it != coords)
+        {
+            _mapAnimationsUpdate.insert(it, coords);
+        }
     }
 }
 
 void MapAnimations::CreateTemporary(const CoordsXYZ& coords, const TemporaryType type)
 {
-    _temporaryMapAnimations.insert(TemporaryMapAnimation{ coords, type });
+    const TemporaryMapAnimation animation{ coords, type };
+    const auto it = std::lower_bound(_temporaryMapAnimations.begin(), _temporaryMapAnimations.end(), animation);
+    if (it == _temporaryMapAnimations.end() || !(*it == animation))
+    {
+        _temporaryMapAnimations.insert(it, animation);
+    }
 }
 
 void MapAnimations::MarkAllTiles()
@@ -709,48 +730,43 @@ static void UpdateAll(const ViewportList& viewports)
     if (getGameState().currentTicks & 1)
         return;
 
-    auto it = _mapAnimationsUpdate.begin();
-    while (it != _mapAnimationsUpdate.end())
+    // Sweep the packed list linearly and compact it in place; tiles that no
+    // longer need updating are dropped without any per-element erase cost.
+    size_t writeIndex = 0;
+    for (size_t readIndex = 0; readIndex < _mapAnimationsUpdate.size(); readIndex++)
     {
-        const bool isVisible = IsTileVisible(viewports, *it);
-        const auto result = isVisible ? UpdateTile<true, true>(*it, nullptr) : UpdateTile<false, true>(*it, nullptr);
+        const auto coords = _mapAnimationsUpdate[readIndex];
+        const bool isVisible = IsTileVisible(viewports, coords);
+        const auto result = isVisible ? UpdateTile<true, true>(coords, nullptr) : UpdateTile<false, true>(coords, nullptr);
         if (result)
         {
             if (result.value() == UpdateType::invalidate)
             {
-                const auto& coords = *it;
                 _mapAnimationsInvalidate[coords.x + (coords.y * kMaximumMapSizeTechnical)] = true;
-                it = _mapAnimationsUpdate.erase(it);
             }
             else
             {
-                ++it;
+                _mapAnimationsUpdate[writeIndex++] = coords;
             }
         }
-        else
-        {
-            it = _mapAnimationsUpdate.erase(it);
-        }
     }
+    _mapAnimationsUpdate.resize(writeIndex);
 }
 
 static void UpdateAllTemporary(const ViewportList& viewports)
 {
-    auto it = _temporaryMapAnimations.begin();
-    while (it != _temporaryMapAnimations.end())
+    size_t writeIndex = 0;
+    for (size_t readIndex = 0; readIndex < _temporaryMapAnimations.size(); readIndex++)
     {
-        const auto& animation = *it;
+        const auto animation = _temporaryMapAnimations[readIndex];
         const bool isVisible = IsTileVisible(viewports, TileCoordsXY(animation.location));
-        const auto result = isVisible ? UpdateTemporaryAnimation<true>(*it) : UpdateTemporaryAnimation<false>(*it);
+        const auto result = isVisible ? UpdateTemporaryAnimation<true>(animation) : UpdateTemporaryAnimation<false>(animation);
         if (result)
         {
-            ++it;
-        }
-        else
-        {
-            it = _temporaryMapAnimations.erase(it);
+            _temporaryMapAnimations[writeIndex++] = animation;
         }
     }
+    _temporaryMapAnimations.resize(writeIndex);
 }
 
 void MapAnimations::InvalidateAndUpdateAll()
@@ -790,17 +806,15 @@ void MapAnimations::ShiftAll(const TileCoordsXY amount)
     }
     _mapAnimationsInvalidate = std::move(newMapAnimationsInvalidate);
 
-    std::set<TileCoordsXY, TileCoordsXYCmp> newMapAnimationsUpdate;
-    for (const auto a : _mapAnimationsUpdate)
+    for (auto& a : _mapAnimationsUpdate)
     {
-        newMapAnimationsUpdate.insert(a + amount);
+        a += amount;
     }
-    _mapAnimationsUpdate = std::move(newMapAnimationsUpdate);
+    std::sort(_mapAnimationsUpdate.begin(), _mapAnimationsUpdate.end(), TileCoordsXYCmp{});
 
-    std::set<TemporaryMapAnimation> newTemporaryMapAnimations;
-    for (const auto& a : _temporaryMapAnimations)
+    for (auto& a : _temporaryMapAnimations)
     {
-        newTemporaryMapAnimations.insert(TemporaryMapAnimation{ a.location + CoordsXYZ(amount.ToCoordsXY(), 0), a.type });
+        a.location += CoordsXYZ(amount.ToCoordsXY(), 0);
     }
-    _temporaryMapAnimations = std::move(newTemporaryMapAnimations);
+    std::sort(_temporaryMapAnimations.begin(), _temporaryMapAnimations.end());
 }
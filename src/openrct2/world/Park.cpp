@@ -16,6 +16,7 @@
 #include "../GameState.h"
 #include "../OpenRCT2.h"
 #include "../actions/ParkSetParameterAction.h"
+#include "../core/Guard.hpp"
 #include "../core/Memory.hpp"
 #include "../core/String.hpp"
 #include "../entity/EntityList.h"
@@ -27,6 +28,7 @@
 #include "../management/Marketing.h"
 #include "../management/Research.h"
 #include "../network/Network.h"
+#include "../peep/PeepAnimations.h"
 #include "../profiling/Profiling.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
@@ -77,6 +79,43 @@ namespace OpenRCT2::Park
         return result;
     }
 
+    // Running total of all ride value contributions. Only trusted once it has
+    // been rebuilt from the loaded game state, so a fresh load can never use a
+    // total belonging to the previous park.
+    static money64 _rideValueTotal;
+    static bool _rideValueTotalValid;
+
+    void RecalculateRideValues(GameState_t& gameState)
+    {
+        money64 total = 0;
+        for (auto& ride : RideManager(gameState))
+        {
+            ride.cachedParkValueContribution = calculateRideValue(ride);
+            total += ride.cachedParkValueContribution;
+        }
+        _rideValueTotal = total;
+        _rideValueTotalValid = true;
+    }
+
+    void UpdateRideValueContribution(Ride& ride)
+    {
+        if (!_rideValueTotalValid)
+            return;
+
+        const auto newContribution = calculateRideValue(ride);
+        _rideValueTotal += newContribution - ride.cachedParkValueContribution;
+        ride.cachedParkValueContribution = newContribution;
+    }
+
+    void OnRideRemoved(Ride& ride)
+    {
+        if (_rideValueTotalValid)
+        {
+            _rideValueTotal -= ride.cachedParkValueContribution;
+        }
+        ride.cachedParkValueContribution = 0;
+    }
+
     static money64 calculateTotalRideValueForMoney(const ParkData& park, const GameState_t& gameState)
     {
         money64 totalRideValue = 0;
@@ -269,6 +308,10 @@ namespace OpenRCT2::Park
     {
         auto& park = gameState.park;
 
+        // The ride value total belongs to the previous park; do not trust it
+        // until it has been rebuilt from the new game state.
+        _rideValueTotalValid = false;
+
         park.name = LanguageGetString(STR_UNNAMED_PARK);
         gameState.pluginStorage = {};
         park.staffHandymanColour = Drawing::Colour::brightRed;
@@ -495,11 +538,29 @@ namespace OpenRCT2::Park
 
     money64 CalculateParkValue(const ParkData& park, const GameState_t& gameState)
     {
-        // Sum ride values
-        money64 result = 0;
-        for (const auto& ride : RideManager(gameState))
+        money64 result;
+        if (_rideValueTotalValid)
+        {
+            result = _rideValueTotal;
+#ifdef DEBUG
+            // Slow-path verification for desync debugging: recompute the total
+            // from scratch and make sure the incremental accounting agrees.
+            money64 verification = 0;
+            for (const auto& ride : RideManager(gameState))
+            {
+                verification += calculateRideValue(ride);
+            }
+            Guard::Assert(verification == result, "Incremental ride value total out of sync");
+#endif
+        }
+        else
         {
-            result += calculateRideValue(ride);
+            // Sum ride values
+            result = 0;
+            for (const auto& ride : RideManager(gameState))
+            {
+                result += calculateRideValue(ride);
+            }
         }
 
         // +7.00 per guest
@@ -539,28 +600,51 @@ namespace OpenRCT2::Park
         return 40;
     }
 
-    Guest* GenerateGuest()
+    static Guest* generateGuestAtSpawn(const PeepSpawn& spawn, ObjectEntryIndex animationsObjectIndex)
     {
-        Guest* peep = nullptr;
-        const auto spawn = GetRandomPeepSpawn();
-        if (spawn != nullptr)
+        auto direction = DirectionReverse(spawn.direction);
+        auto* peep = Guest::Generate({ spawn.x, spawn.y, spawn.z }, animationsObjectIndex);
+        if (peep != nullptr)
         {
-            auto direction = DirectionReverse(spawn->direction);
-            peep = Guest::Generate({ spawn->x, spawn->y, spawn->z });
-            if (peep != nullptr)
-            {
-                peep->Orientation = direction << 3;
+            peep->Orientation = direction << 3;
 
-                auto destination = peep->GetLocation().ToTileCentre();
-                peep->SetDestination(destination, 5);
-                peep->PeepDirection = direction;
-                peep->Var37 = 0;
-                peep->State = PeepState::enteringPark;
-            }
+            auto destination = peep->GetLocation().ToTileCentre();
+            peep->SetDestination(destination, 5);
+            peep->PeepDirection = direction;
+            peep->Var37 = 0;
+            peep->State = PeepState::enteringPark;
         }
         return peep;
     }
 
+    Guest* GenerateGuest()
+    {
+        const auto spawn = GetRandomPeepSpawn();
+        if (spawn == nullptr)
+            return nullptr;
+
+        return generateGuestAtSpawn(*spawn, findPeepAnimationsIndexForType(AnimationPeepType::guest));
+    }
+
+    int32_t GenerateGuests(int32_t count)
+    {
+        if (getGameState().peepSpawns.empty())
+            return 0;
+
+        // Resolved once for the whole batch; every guest uses the same animations object.
+        const auto animationsObjectIndex = findPeepAnimationsIndexForType(AnimationPeepType::guest);
+
+        int32_t numGenerated = 0;
+        for (; numGenerated < count; numGenerated++)
+        {
+            // Each guest still rolls its own spawn point so batches spread across entrances.
+            const auto spawn = GetRandomPeepSpawn();
+            if (generateGuestAtSpawn(*spawn, animationsObjectIndex) == nullptr)
+                break;
+        }
+        return numGenerated;
+    }
+
     void ResetHistories(ParkData& park)
     {
         std::fill(std::begin(park.ratingHistory), std::end(park.ratingHistory), kParkRatingHistoryUndefined);
@@ -13,6 +13,7 @@
 #include "Location.hpp"
 
 struct Guest;
+struct Ride;
 
 namespace OpenRCT2
 {
@@ -31,7 +32,20 @@ namespace OpenRCT2::Park
     money64 CalculateParkValue(const ParkData& park, const GameState_t& gameState);
     money64 CalculateCompanyValue(const ParkData& park);
 
+    // Incremental park value accounting. The total ride value is kept as a
+    // running sum which the sites that change a ride's value update, so the
+    // periodic recalculation does not have to visit every ride.
+    void RecalculateRideValues(GameState_t& gameState);
+    void UpdateRideValueContribution(Ride& ride);
+    void OnRideRemoved(Ride& ride);
+
     Guest* GenerateGuest();
+    /**
+     * Admits a batch of guests in one go, resolving the spawn data and object
+     * lookups once for the whole batch rather than once per guest.
+     * @return The number of guests that were actually generated.
+     */
+    int32_t GenerateGuests(int32_t count);
 
     void ResetHistories(ParkData& park);
     void UpdateHistories(ParkData& park);
@@ -137,4 +137,80 @@ namespace OpenRCT2
         }
     };
 
+    /**
+     * Typed iteration over the packed per-type element column, for whole-map
+     * queries that would otherwise have to walk every tile's element chain
+     * and branch on the element type. The underlying column is invalidated by
+     * any element insertion, removal or relocation, so do not mutate the map
+     * while iterating.
+     */
+    template<typename T>
+    class TileElementsColumnView
+    {
+    public:
+        struct Entry
+        {
+            TileCoordsXY loc;
+            T* element;
+        };
+
+        struct Iterator
+        {
+            const TileElementColumnEntry* entry = nullptr;
+
+            Iterator& operator++()
+            {
+                entry++;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator res = *this;
+                ++(*this);
+                return res;
+            }
+
+            bool operator==(Iterator other) const
+            {
+                return entry == other.entry;
+            }
+
+            bool operator!=(Iterator other) const
+            {
+                return !(*this == other);
+            }
+
+            Entry operator*() const
+            {
+                return Entry{ entry->loc, reinterpret_cast<T*>(entry->element) };
+            }
+
+            // iterator traits
+            using difference_type = std::ptrdiff_t;
+            using value_type = Entry;
+            using pointer = const Entry*;
+            using reference = const Entry&;
+            using iterator_category = std::forward_iterator_tag;
+        };
+
+        TileElementsColumnView()
+            : _column(MapGetElementColumn(T::kElementType))
+        {
+        }
+
+        Iterator begin() const noexcept
+        {
+            return Iterator{ _column.data() };
+        }
+
+        Iterator end() const noexcept
+        {
+            return Iterator{ _column.data() + _column.size() };
+        }
+
+    private:
+        const std::vector<TileElementColumnEntry>& _column;
+    };
+
 } // namespace OpenRCT2
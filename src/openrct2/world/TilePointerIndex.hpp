@@ -15,6 +15,13 @@
 #include <cstdint>
 #include <vector>
 
+// The index hands out raw pointers into the single flat tile element array,
+// and callers all over the codebase (paint, pathfinding, game actions) hold
+// on to them across the access. That rules out transparently compressing
+// cold map regions behind this layer: there is no point at which a packed
+// sector could be re-encoded while outstanding pointers exist, and the win
+// would be modest anyway — even a fully built 999x999 map is only tens of
+// megabytes of elements.
 template<typename T>
 class TilePointerIndex
 {
@@ -30,6 +30,12 @@ namespace OpenRCT2::World::MapGenerator
 
     static void addBeaches(Settings* settings);
 
+    // Generation runs to completion on the main thread rather than being
+    // sliced across frames by a cooperative scheduler. It rewrites the live
+    // tile element array, so yielding mid-way would let the paint and window
+    // code observe a half-generated map; operations long enough to need
+    // feedback (object/scenario scans at startup) instead run on worker
+    // threads against private data and report through OpenProgress.
     void generate(Settings* settings)
     {
         // First, generate the height map
@@ -37,6 +37,13 @@ namespace OpenRCT2::World::MapGenerator
         return TileCoordsXY(static_cast<int32_t>(y + 1), static_cast<int32_t>(x + 1));
     }
 
+    // The whole image is decoded in one go rather than streamed in row bands.
+    // The map caps at kMaximumMapSizePractical tiles per side, so anything
+    // larger is clamped with a warning and only the top-left square is read;
+    // the peak transient cost is the decoded bitmap of an image the user was
+    // just told is too big, on an editor path that runs once per import. A
+    // streaming decoder through Imaging would bound that transient at the
+    // price of a second, row-callback decode path kept for this caller alone.
     bool LoadHeightmapImage(const utf8* path)
     {
         auto format = Imaging::GetImageFormatFromPath(path);
@@ -9,12 +9,15 @@
 
 #include "SimplexNoise.h"
 
+#include "../../config/Config.h"
+#include "../../core/JobPool.h"
 #include "../../util/Util.h"
 #include "HeightMap.hpp"
 #include "MapGen.h"
 #include "MapHelpers.h"
 
 #include <algorithm>
+#include <thread>
 
 namespace OpenRCT2::World::MapGenerator
 {
@@ -151,6 +154,41 @@ namespace OpenRCT2::World::MapGenerator
         return ((h & 1) != 0 ? -u : u) + ((h & 2) != 0 ? -2.0f * v : 2.0f * v);
     }
 
+    /**
+     * Runs rowFn for every row in [firstRow, lastRow), split into bands that a
+     * short-lived job pool processes concurrently. Each band writes a disjoint
+     * slice of the height map, so the result is identical to the sequential
+     * loop regardless of worker count or timing.
+     */
+    template<typename TRowFn>
+    static void forEachRowBand(int32_t firstRow, int32_t lastRow, const TRowFn& rowFn)
+    {
+        const auto numRows = lastRow - firstRow;
+        const auto numWorkers = std::max<size_t>(1, std::thread::hardware_concurrency());
+        if (!Config::Get().general.multiThreading || numWorkers == 1 || numRows < static_cast<int32_t>(numWorkers))
+        {
+            for (auto row = firstRow; row < lastRow; row++)
+            {
+                rowFn(row);
+            }
+            return;
+        }
+
+        JobPool jobPool(numWorkers);
+        const auto bandSize = (numRows + static_cast<int32_t>(numWorkers) - 1) / static_cast<int32_t>(numWorkers);
+        for (auto bandStart = firstRow; bandStart < lastRow; bandStart += bandSize)
+        {
+            const auto bandEnd = std::min(bandStart + bandSize, lastRow);
+            jobPool.AddTask([&rowFn, bandStart, bandEnd]() {
+                for (auto row = bandStart; row < bandEnd; row++)
+                {
+                    rowFn(row);
+                }
+            });
+        }
+        jobPool.Join();
+    }
+
     /**
      * Smooths the height map.
      */
@@ -159,8 +197,7 @@ namespace OpenRCT2::World::MapGenerator
         for (auto i = 0; i < iterations; i++)
         {
             auto copyHeight = heightMap;
-            for (auto y = 1; y < heightMap.height - 1; y++)
-            {
+            forEachRowBand(1, heightMap.height - 1, [&](int32_t y) {
                 for (auto x = 1; x < heightMap.width - 1; x++)
                 {
                     auto avg = 0;
@@ -174,7 +211,7 @@ namespace OpenRCT2::World::MapGenerator
                     avg /= 9;
                     heightMap[{ x, y }] = avg;
                 }
-            }
+            });
         }
     }
 
@@ -187,8 +224,8 @@ namespace OpenRCT2::World::MapGenerator
         int32_t high = settings->heightmapHigh / 2 - low;
 
         NoiseRand();
-        for (int32_t y = 0; y < heightMap.height; y++)
-        {
+        // perm[] is read-only from here on, so rows are independent of each other.
+        forEachRowBand(0, heightMap.height, [&](int32_t y) {
             for (int32_t x = 0; x < heightMap.width; x++)
             {
                 float noiseValue = std::clamp(FractalNoise(x, y, freq, octaves, 2.0f, 0.65f), -1.0f, 1.0f);
@@ -196,7 +233,7 @@ namespace OpenRCT2::World::MapGenerator
 
                 heightMap[{ x, y }] = low + static_cast<int32_t>(normalisedNoiseValue * high);
             }
-        }
+        });
     }
 
     void generateSimplexMap(Settings* settings)
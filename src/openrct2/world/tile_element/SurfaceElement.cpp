@@ -25,6 +25,12 @@ namespace OpenRCT2
         return SurfaceStyle;
     }
 
+    // These resolve through the object manager each call rather than through
+    // flat per-style arrays rebuilt at park load. The call is one virtual hop
+    // into a vector index, the paint code fetches each object once per tile
+    // and then works with the pointer, and a parallel lookup table would have
+    // to be rebuilt whenever objects load or unload (editor selection,
+    // plugins) for no measurable saving next to the actual tile blits.
     TerrainSurfaceObject* SurfaceElement::GetSurfaceObject() const
     {
         auto& objManager = GetContext()->GetObjectManager();
@@ -0,0 +1,242 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2026 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <memory>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/GameState.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/ParkImporter.h>
+#include <openrct2/core/MemoryStream.h>
+#include <openrct2/drawing/Drawing.h>
+#include <openrct2/entity/EntityList.h>
+#include <openrct2/entity/Guest.h>
+#include <openrct2/interface/Viewport.h>
+#include <openrct2/object/ObjectManager.h>
+#include <openrct2/paint/Paint.h>
+#include <openrct2/park/ParkFile.h>
+#include <openrct2/ride/Vehicle.h>
+#include <openrct2/world/Map.h>
+#include <openrct2/world/MapAnimation.h>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+// Reloads the reference park so that benchmarks which mutate the game state do
+// not feed their mutations into the next benchmark's baseline.
+static void LoadReferencePark()
+{
+    GetContext()->LoadParkFromFile(TestData::GetParkPath("bpb.sv6"));
+    GameLoadInit();
+}
+
+static void BM_GameStateUpdate(benchmark::State& state)
+{
+    LoadReferencePark();
+
+    for (auto _ : state)
+    {
+        gameStateUpdateLogic();
+    }
+}
+BENCHMARK(BM_GameStateUpdate)->Unit(benchmark::kMillisecond);
+
+static void BM_GuestUpdate(benchmark::State& state)
+{
+    LoadReferencePark();
+
+    int64_t numGuests = 0;
+    for ([[maybe_unused]] auto* guest : EntityList<Guest>())
+    {
+        numGuests++;
+    }
+
+    for (auto _ : state)
+    {
+        // Same iteration pattern as PeepUpdateAll.
+        for (auto* guest : EntityList<Guest>())
+        {
+            guest->Update();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * numGuests);
+}
+BENCHMARK(BM_GuestUpdate)->Unit(benchmark::kMillisecond);
+
+static void BM_VehicleUpdateTrackMotion(benchmark::State& state)
+{
+    LoadReferencePark();
+
+    int64_t numTrains = 0;
+    for (auto* vehicle : EntityList<Vehicle>())
+    {
+        if (vehicle->IsHead())
+        {
+            numTrains++;
+        }
+    }
+
+    for (auto _ : state)
+    {
+        for (auto* vehicle : EntityList<Vehicle>())
+        {
+            if (!vehicle->IsHead())
+                continue;
+
+            int32_t station;
+            benchmark::DoNotOptimize(vehicle->UpdateTrackMotion(&station));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * numTrains);
+}
+BENCHMARK(BM_VehicleUpdateTrackMotion)->Unit(benchmark::kMillisecond);
+
+static void BM_PaintSessionGenerate(benchmark::State& state)
+{
+    LoadReferencePark();
+
+    constexpr int32_t kViewWidth = 1280;
+    constexpr int32_t kViewHeight = 720;
+    std::vector<uint8_t> bits(static_cast<size_t>(kViewWidth) * kViewHeight);
+
+    const auto& gameState = getGameState();
+    const auto centre = TileCoordsXY(gameState.mapSize.x / 2, gameState.mapSize.y / 2).ToCoordsXY();
+    const auto screenPos = Translate3DTo2DWithZ(0, CoordsXYZ(centre, TileElementHeight(centre)));
+
+    Drawing::RenderTarget rt;
+    rt.bits = bits.data();
+    rt.x = screenPos.x - kViewWidth / 2;
+    rt.y = screenPos.y - kViewHeight / 2;
+    rt.width = kViewWidth;
+    rt.height = kViewHeight;
+    rt.cullingX = rt.x;
+    rt.cullingY = rt.y;
+    rt.cullingWidth = rt.width;
+    rt.cullingHeight = rt.height;
+
+    for (auto _ : state)
+    {
+        PaintSession* session = PaintSessionAlloc(rt, 0, 0);
+        PaintSessionGenerate(*session);
+        PaintSessionArrange(*session);
+        PaintSessionFree(session);
+    }
+}
+BENCHMARK(BM_PaintSessionGenerate)->Unit(benchmark::kMillisecond);
+
+static void BM_RleBlit(benchmark::State& state)
+{
+    // Guest sprites, which are RLE-compressed in g1.dat.
+    constexpr uint32_t kFirstSampleImage = 6409;
+    constexpr uint32_t kNumSampleImages = 512;
+
+    if (GfxGetG1Element(ImageId(kFirstSampleImage)) == nullptr)
+    {
+        state.SkipWithError("base graphics not loaded");
+        return;
+    }
+
+    constexpr int32_t kTargetWidth = 256;
+    constexpr int32_t kTargetHeight = 256;
+    std::vector<uint8_t> bits(static_cast<size_t>(kTargetWidth) * kTargetHeight);
+
+    Drawing::RenderTarget rt;
+    rt.bits = bits.data();
+    rt.width = kTargetWidth;
+    rt.height = kTargetHeight;
+    rt.cullingWidth = kTargetWidth;
+    rt.cullingHeight = kTargetHeight;
+
+    for (auto _ : state)
+    {
+        for (uint32_t i = 0; i < kNumSampleImages; i++)
+        {
+            GfxDrawSpriteSoftware(rt, ImageId(kFirstSampleImage + i), { kTargetWidth / 2, kTargetHeight / 2 });
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kNumSampleImages);
+}
+BENCHMARK(BM_RleBlit);
+
+static void BM_ParkFileExport(benchmark::State& state)
+{
+    LoadReferencePark();
+
+    auto& objManager = GetContext()->GetObjectManager();
+    for (auto _ : state)
+    {
+        MemoryStream stream;
+        ParkFileExporter exporter;
+        exporter.ExportObjectsList = objManager.GetPackableObjects();
+        exporter.Export(getGameState(), stream, kParkFileSaveCompressionLevel);
+        benchmark::DoNotOptimize(stream.GetLength());
+    }
+}
+BENCHMARK(BM_ParkFileExport)->Unit(benchmark::kMillisecond);
+
+static void BM_ParkFileImport(benchmark::State& state)
+{
+    LoadReferencePark();
+
+    auto& objManager = GetContext()->GetObjectManager();
+
+    MemoryStream stream;
+    {
+        ParkFileExporter exporter;
+        exporter.ExportObjectsList = objManager.GetPackableObjects();
+        exporter.Export(getGameState(), stream, kParkFileSaveCompressionLevel);
+    }
+
+    for (auto _ : state)
+    {
+        stream.SetPosition(0);
+        auto importer = ParkImporter::CreateParkFile(GetContext()->GetObjectRepository());
+        auto loadResult = importer->LoadFromStream(&stream, false);
+        objManager.LoadObjects(loadResult.RequiredObjects);
+        MapAnimations::ClearAll();
+        importer->Import(getGameState());
+    }
+}
+BENCHMARK(BM_ParkFileImport)->Unit(benchmark::kMillisecond);
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = false;
+
+    auto context = CreateContext();
+    bool initialised = context->Initialise();
+    if (!initialised)
+    {
+        // Without the base graphics BM_RleBlit skips itself; everything else
+        // only needs objects and the reference park.
+        context.reset();
+        gOpenRCT2NoGraphics = true;
+        context = CreateContext();
+        initialised = context->Initialise();
+    }
+    if (!initialised)
+    {
+        std::fprintf(stderr, "Failed to initialise context\n");
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -16,10 +16,14 @@
 #include <openrct2/GameState.h>
 #include <openrct2/OpenRCT2.h>
 #include <openrct2/ReplayManager.h>
+#include <fstream>
+#include <iomanip>
+#include <map>
 #include <openrct2/core/FileScanner.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
 #include <openrct2/platform/Platform.h>
+#include <openrct2/profiling/Profiling.h>
 #include <string>
 
 using namespace OpenRCT2;
@@ -67,6 +71,85 @@ class ReplayTests : public testing::TestWithParam<ReplayTestData>
 protected:
 };
 
+// Optional performance mode. When OPENRCT2_REPLAY_PROFILE_DIR is set, each
+// replay runs with the profiler enabled and writes the accumulated time per
+// profiled function to <dir>/<test name>.csv. If
+// OPENRCT2_REPLAY_PROFILE_BASELINE_DIR also names a directory holding CSVs
+// from a previous run (same machine and build flags), functions that got
+// slower by more than OPENRCT2_REPLAY_PROFILE_THRESHOLD percent (default 25)
+// fail the test, which turns the correctness replays into a regression gate.
+using ProfiledTotals = std::map<std::string, double>;
+
+static ProfiledTotals CollectProfiledTotals()
+{
+    ProfiledTotals totals;
+    for (const auto* func : OpenRCT2::Profiling::GetData())
+    {
+        if (func->GetCallCount() > 0)
+        {
+            totals[func->GetName()] = func->getTotalTime();
+        }
+    }
+    return totals;
+}
+
+static void WriteProfiledTotals(const std::string& filePath, const ProfiledTotals& totals)
+{
+    std::ofstream out(filePath);
+    ASSERT_TRUE(out.is_open()) << "Unable to write profile to " << filePath;
+    out << std::setprecision(12);
+    for (const auto& [name, totalUs] : totals)
+    {
+        out << "\"" << name << "\";" << totalUs << "\n";
+    }
+}
+
+static ProfiledTotals ReadProfiledTotals(const std::string& filePath)
+{
+    ProfiledTotals totals;
+    std::ifstream in(filePath);
+    std::string line;
+    while (std::getline(in, line))
+    {
+        // The function name is quoted and may itself contain separators, so
+        // split on the last semicolon.
+        auto sep = line.find_last_of(';');
+        if (sep == std::string::npos || sep < 2)
+            continue;
+        totals[line.substr(1, sep - 2)] = std::stod(line.substr(sep + 1));
+    }
+    return totals;
+}
+
+static void CompareProfiledTotals(const ProfiledTotals& baseline, const ProfiledTotals& current)
+{
+    // Ignore functions too small for a stable measurement; they can regress
+    // by large factors from scheduling noise alone.
+    constexpr double kMinComparableTimeUs = 10000.0;
+
+    double thresholdPercent = 25.0;
+    auto thresholdVar = OpenRCT2::Platform::GetEnvironmentVariable("OPENRCT2_REPLAY_PROFILE_THRESHOLD");
+    if (!thresholdVar.empty())
+    {
+        thresholdPercent = std::stod(thresholdVar);
+    }
+
+    for (const auto& [name, baselineUs] : baseline)
+    {
+        if (baselineUs < kMinComparableTimeUs)
+            continue;
+        auto iter = current.find(name);
+        if (iter == current.end())
+            continue;
+        const auto deltaPercent = ((iter->second - baselineUs) / baselineUs) * 100.0;
+        if (deltaPercent > thresholdPercent)
+        {
+            ADD_FAILURE() << "Performance regression in " << name << ": " << baselineUs << " us -> " << iter->second
+                          << " us (+" << deltaPercent << " %, threshold " << thresholdPercent << " %)";
+        }
+    }
+}
+
 TEST_P(ReplayTests, RunReplay)
 {
     gOpenRCT2Headless = true;
@@ -92,12 +175,35 @@ TEST_P(ReplayTests, RunReplay)
         FAIL();
     }
 
+    auto profileDir = Platform::GetEnvironmentVariable("OPENRCT2_REPLAY_PROFILE_DIR");
+    if (!profileDir.empty())
+    {
+        Profiling::ResetData();
+        Profiling::Enable();
+    }
+
     while (replayManager->IsReplaying())
     {
         gameStateUpdateLogic();
         if (replayManager->IsPlaybackStateMismatching())
             break;
     }
+
+    if (!profileDir.empty())
+    {
+        Profiling::Disable();
+
+        auto totals = CollectProfiledTotals();
+        auto fileName = testData.name + ".csv";
+        WriteProfiledTotals(Path::Combine(profileDir, fileName), totals);
+
+        auto baselineDir = Platform::GetEnvironmentVariable("OPENRCT2_REPLAY_PROFILE_BASELINE_DIR");
+        if (!baselineDir.empty())
+        {
+            CompareProfiledTotals(ReadProfiledTotals(Path::Combine(baselineDir, fileName)), totals);
+        }
+    }
+
     ASSERT_FALSE(replayManager->IsReplaying());
     ASSERT_FALSE(replayManager->IsPlaybackStateMismatching());
 }